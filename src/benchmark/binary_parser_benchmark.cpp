@@ -0,0 +1,34 @@
+#include <filesystem>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "storage/encoding_type.hpp"
+#include "synthetic_table_generator.hpp"
+
+namespace opossum {
+
+/**
+ * Measures how long BinaryParser takes to load a table of 10 integer columns with one million rows. The file is
+ * written once and then read repeatedly, so it is served from the page cache. The benchmark therefore measures the
+ * parsing and copying of the data, not the disk.
+ */
+static void BM_BinaryParser(benchmark::State& state, const SegmentEncodingSpec segment_encoding_spec) {  // NOLINT
+  const auto table =
+      SyntheticTableGenerator{}.generate_table(10, 1'000'000, Chunk::DEFAULT_SIZE, segment_encoding_spec);
+  const auto filename = (std::filesystem::temp_directory_path() / "binary_parser_benchmark.bin").string();
+  BinaryWriter::write(*table, filename);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(BinaryParser::parse(filename));
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(filename)));
+  std::filesystem::remove(filename);
+}
+BENCHMARK_CAPTURE(BM_BinaryParser, Unencoded, SegmentEncodingSpec{EncodingType::Unencoded});
+BENCHMARK_CAPTURE(BM_BinaryParser, Dictionary, SegmentEncodingSpec{EncodingType::Dictionary});
+
+}  // namespace opossum
@@ -4,8 +4,12 @@
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "micro_benchmark_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "synthetic_table_generator.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -28,4 +32,46 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Aggregate)(benchmark::State& state) {
   }
 }
 
+/**
+ * Aggregates a table of 10 million rows into 100'000 groups with the given number of cores (state.range(0)) to show how
+ * the parallel pre-aggregation and merge of AggregateHash scale. With a single core, the ImmediateExecutionScheduler
+ * is used, i.e., the serial aggregation.
+ */
+static void BM_AggregateHashScaling(benchmark::State& state) {
+  const auto core_count = static_cast<uint32_t>(state.range(0));
+  constexpr auto ROW_COUNT = size_t{10'000'000};
+  constexpr auto GROUP_COUNT = 100'000;
+
+  const auto column_specifications = std::vector<ColumnSpecification>{
+      ColumnSpecification(ColumnDataDistribution::make_uniform_config(0.0, GROUP_COUNT), DataType::Int),
+      ColumnSpecification(ColumnDataDistribution::make_uniform_config(0.0, 1'000'000.0), DataType::Double)};
+  const auto table = SyntheticTableGenerator::generate_table(column_specifications, ROW_COUNT, ChunkOffset{100'000});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Double, false, "b");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::static_pointer_cast<AggregateExpression>(min_(column_b)),
+      std::static_pointer_cast<AggregateExpression>(sum_(column_b)),
+      std::make_shared<AggregateExpression>(AggregateFunction::Count,
+                                            pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0} /* "a" */};
+
+  if (core_count > 1) {
+    Hyrise::get().topology.use_default_topology(core_count);
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  }
+
+  for (auto _ : state) {
+    micro_benchmark_clear_cache();
+    auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+    aggregate->execute();
+  }
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::reset();
+}
+BENCHMARK(BM_AggregateHashScaling)->RangeMultiplier(2)->Range(1, 32)->UseRealTime()->Unit(benchmark::kMillisecond);
+
 }  // namespace opossum
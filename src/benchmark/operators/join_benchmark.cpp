@@ -58,16 +58,32 @@ std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
   return table_wrapper;
 }
 
+// Generates a table with a single column whose values are uniformly distributed between 0 and max_value
+std::shared_ptr<TableWrapper> generate_table_with_value_range(const size_t number_of_rows, const int32_t max_value) {
+  const auto chunk_size = static_cast<ChunkOffset>(number_of_rows / NUMBER_OF_CHUNKS);
+  Assert(chunk_size > 0, "The chunk size is 0 or less, can not generate such a table");
+
+  const auto column_specification =
+      ColumnSpecification{ColumnDataDistribution::make_uniform_config(0.0, max_value), DataType::Int,
+                          SegmentEncodingSpec{EncodingType::Dictionary}};
+  auto table = SyntheticTableGenerator::generate_table({column_specification}, number_of_rows, chunk_size);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  return table_wrapper;
+}
+
 template <class C>
 void bm_join_impl(benchmark::State& state, std::shared_ptr<TableWrapper> table_wrapper_left,
-                  std::shared_ptr<TableWrapper> table_wrapper_right) {
+                  std::shared_ptr<TableWrapper> table_wrapper_right, const JoinMode mode = JoinMode::Inner) {
   clear_cache();
 
-  auto warm_up = std::make_shared<C>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+  auto warm_up = std::make_shared<C>(table_wrapper_left, table_wrapper_right, mode,
                                      OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
   warm_up->execute();
   for (auto _ : state) {
-    auto join = std::make_shared<C>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+    auto join = std::make_shared<C>(table_wrapper_left, table_wrapper_right, mode,
                                     OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
     join->execute();
   }
@@ -99,6 +115,41 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+template <class C>
+void BM_Join_FullOuter_SmallAndBig(benchmark::State& state) {  // NOLINT 1,000 x 10,000,000
+  auto table_wrapper_left = generate_table(TABLE_SIZE_SMALL);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_BIG);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right, JoinMode::FullOuter);
+}
+
+template <class C>
+void BM_Join_FullOuter_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100,000
+  auto table_wrapper_left = generate_table(TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_MEDIUM);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right, JoinMode::FullOuter);
+}
+
+// Only about 0.1% of the probe rows find a join partner, so that the runtime filter of the hash join discards most of
+// the probe side
+template <class C>
+void BM_Join_Selective_SmallAndBig(benchmark::State& state) {  // NOLINT 1,000 x 10,000,000
+  auto table_wrapper_left = generate_table_with_value_range(TABLE_SIZE_SMALL, 1'000'000);
+  auto table_wrapper_right = generate_table_with_value_range(TABLE_SIZE_BIG, 1'000'000);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
+// Almost all probe rows find a join partner, so that the runtime filter of the hash join switches itself off
+template <class C>
+void BM_Join_NotSelective_MediumAndBig(benchmark::State& state) {  // NOLINT 100,000 x 10,000,000
+  auto table_wrapper_left = generate_table_with_value_range(TABLE_SIZE_MEDIUM, 10'000);
+  auto table_wrapper_right = generate_table_with_value_range(TABLE_SIZE_BIG, 10'000);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -113,4 +164,16 @@ BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinSortMerge);
 
+BENCHMARK_TEMPLATE(BM_Join_FullOuter_SmallAndBig, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_FullOuter_MediumAndMedium, JoinHash);
+
+BENCHMARK_TEMPLATE(BM_Join_FullOuter_SmallAndBig, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_FullOuter_MediumAndMedium, JoinSortMerge);
+
+BENCHMARK_TEMPLATE(BM_Join_Selective_SmallAndBig, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_NotSelective_MediumAndBig, JoinHash);
+
+BENCHMARK_TEMPLATE(BM_Join_Selective_SmallAndBig, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_NotSelective_MediumAndBig, JoinSortMerge);
+
 }  // namespace opossum
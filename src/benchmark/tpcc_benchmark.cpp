@@ -1,9 +1,11 @@
 #include "tpcc/tpcc_table_generator.hpp"
 
 #include <algorithm>
+#include <chrono>
 
 #include "benchmark_runner.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "tpcc/constants.hpp"
 #include "tpcc/tpcc_benchmark_item_runner.hpp"
@@ -19,7 +21,9 @@ using namespace opossum;  // NOLINT
  * Other limitations (that may be removed in the future):
  *  - No primary / foreign keys are used as they are currently unsupported
  *  - Values that are "retrieved" by the terminal are just selected, but not necessarily materialized
- *  - Data is not persisted as logging is currently unsupported; this means that the durability tests are not executed
+ *  - Write-ahead logging is disabled by default and can be enabled with --wal to compare the throughput with and
+ *    without logging. Recovery from checkpoints and the log is covered by Hyrise's tests. The durability tests of
+ *    the standard, which require failing the system under load, are not executed
  *  - As decimals are not supported, we use floats instead
  *  - The delivery transaction is not executed in a "deferred" mode; as such, no delivery result file is written
  *  - We do not execute the isolation tests, as we consider our MVCC tests to be sufficient
@@ -41,12 +45,15 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("wal", "Enable write-ahead logging to the given file", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("group_commit_delay", "Microseconds the logger waits for more transactions before syncing the log", cxxopts::value<size_t>()->default_value("0")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> config;
   size_t num_warehouses;
   bool consistency_checks;
+  std::string wal_path;
 
   // Parse command line args
   const auto cli_parse_result = cli_options.parse(argc, argv);
@@ -55,6 +62,7 @@ int main(int argc, char* argv[]) {
 
   num_warehouses = cli_parse_result["scale"].as<size_t>();
   consistency_checks = cli_parse_result["consistency_checks"].as<bool>();
+  wal_path = cli_parse_result["wal"].as<std::string>();
 
   config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
 
@@ -69,12 +77,31 @@ int main(int argc, char* argv[]) {
   // Add TPC-C-specific information
   context.emplace("scale_factor", num_warehouses);
 
+  // The tables are generated without Insert operators, so only the modifications of the benchmark items are logged
+  if (!wal_path.empty()) {
+    const auto group_commit_delay = std::chrono::microseconds{cli_parse_result["group_commit_delay"].as<size_t>()};
+    std::cout << "- Write-ahead logging to " << wal_path << " with a group commit delay of "
+              << group_commit_delay.count() << " microseconds" << std::endl;
+    Hyrise::get().log_manager.enable(wal_path, group_commit_delay);
+    context.emplace("wal", wal_path);
+    context.emplace("group_commit_delay_us", group_commit_delay.count());
+  } else {
+    std::cout << "- Write-ahead logging is disabled" << std::endl;
+  }
+
   // Run the benchmark
   auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
   BenchmarkRunner(*config, std::move(item_runner), std::make_unique<TPCCTableGenerator>(num_warehouses, config),
                   context)
       .run();
 
+  if (!wal_path.empty()) {
+    auto& log_manager = Hyrise::get().log_manager;
+    std::cout << "- Logged " << log_manager.logged_transaction_count() << " transactions with "
+              << log_manager.flush_count() << " log syncs" << std::endl;
+    log_manager.disable();
+  }
+
   if (consistency_checks || config->verify) {
     std::cout << "- Running consistency checks at the end of the benchmark" << std::endl;
     check_consistency(num_warehouses);
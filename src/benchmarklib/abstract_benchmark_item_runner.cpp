@@ -65,6 +65,7 @@ std::tuple<bool, std::vector<SQLPipelineMetrics>, bool> AbstractBenchmarkItemRun
   }
 
   BenchmarkSQLExecutor sql_executor(_sqlite_wrapper, visualize_prefix);
+  if (_config->morsel_pipelines) sql_executor.use_morsel_pipelines = UseMorselPipelines::Yes;
   auto success = _on_execute_item(item_id, sql_executor);
   return {success, std::move(sql_executor.metrics), sql_executor.any_verification_failed};
 }
@@ -7,10 +7,11 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
                                  const int64_t init_max_runs, const Duration& init_max_duration,
                                  const Duration& init_warmup_duration,
                                  const std::optional<std::string>& init_output_file_path,
-                                 const bool init_enable_scheduler, const uint32_t init_cores,
-                                 const uint32_t init_clients, const bool init_enable_visualization,
-                                 const bool init_verify, const bool init_cache_binary_tables,
-                                 const bool init_sql_metrics)
+                                 const bool init_enable_scheduler, const bool init_work_stealing,
+                                 const bool init_morsel_pipelines, const uint32_t init_cores,
+                                 const uint32_t init_clients,
+                                 const bool init_enable_visualization, const bool init_verify,
+                                 const bool init_cache_binary_tables, const bool init_sql_metrics)
     : benchmark_mode(init_benchmark_mode),
       chunk_size(init_chunk_size),
       encoding_config(init_encoding_config),
@@ -20,6 +21,8 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
       warmup_duration(init_warmup_duration),
       output_file_path(init_output_file_path),
       enable_scheduler(init_enable_scheduler),
+      work_stealing(init_work_stealing),
+      morsel_pipelines(init_morsel_pipelines),
       cores(init_cores),
       clients(init_clients),
       enable_visualization(init_enable_visualization),
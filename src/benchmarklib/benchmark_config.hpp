@@ -21,7 +21,8 @@ class BenchmarkConfig {
   BenchmarkConfig(const BenchmarkMode benchmark_mode, const ChunkOffset chunk_size,
                   const EncodingConfig& encoding_config, const bool indexes, const int64_t max_runs,
                   const Duration& max_duration, const Duration& warmup_duration,
-                  const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
+                  const std::optional<std::string>& output_file_path, const bool enable_scheduler,
+                  const bool work_stealing, const bool morsel_pipelines, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
                   const bool cache_binary_tables, const bool sql_metrics);
 
@@ -36,6 +37,8 @@ class BenchmarkConfig {
   Duration warmup_duration = std::chrono::seconds(0);
   std::optional<std::string> output_file_path = std::nullopt;
   bool enable_scheduler = false;
+  bool work_stealing = false;  // Use the WorkStealingScheduler instead of the NodeQueueScheduler
+  bool morsel_pipelines = false;  // Fuse chunk-local operators into MorselPipelines
   uint32_t cores = 0;
   uint32_t clients = 1;
   bool enable_visualization = false;
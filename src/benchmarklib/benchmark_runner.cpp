@@ -11,6 +11,7 @@
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/chunk.hpp"
 #include "tpch/tpch_table_generator.hpp"
@@ -44,8 +45,11 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
     }
     _context.push_back({"utilized_cores_per_numa_node", numa_cores_per_node});
 
-    const auto scheduler = std::make_shared<NodeQueueScheduler>();
-    Hyrise::get().set_scheduler(scheduler);
+    if (config.work_stealing) {
+      Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+    } else {
+      Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+    }
   }
 
   _table_generator->generate_and_store();
@@ -418,6 +422,8 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("compression", "Specify vector compression as a string. Options: " + compression_strings_option, cxxopts::value<std::string>()->default_value(""))  // NOLINT
     ("indexes", "Create indexes (where defined by benchmark)", cxxopts::value<bool>()->default_value("false"))  // NOLINT
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("work_stealing", "Use per-worker work-stealing deques instead of per-node queues (if the scheduler is active)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("morsel_pipelines", "Fuse chunk-local operators (e.g., scans and projections) into pipelines that process one chunk at a time", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("cores", "Specify the number of cores used by the scheduler (if active). 0 means all available cores", cxxopts::value<uint32_t>()->default_value("0")) // NOLINT
     ("clients", "Specify how many items should run in parallel if the scheduler is active", cxxopts::value<uint32_t>()->default_value("1")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query, do not properly run the benchmark", cxxopts::value<bool>()->default_value("false")) // NOLINT
@@ -459,6 +465,8 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"max_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(config.max_duration).count()},
       {"warmup_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(config.warmup_duration).count()},
       {"using_scheduler", config.enable_scheduler},
+      {"work_stealing", config.work_stealing},
+      {"morsel_pipelines", config.morsel_pipelines},
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
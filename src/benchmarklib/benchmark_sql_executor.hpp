@@ -37,6 +37,9 @@ class BenchmarkSQLExecutor {
   // Can optionally be set by the caller. Otherwise, pipelines are auto-committed
   std::shared_ptr<TransactionContext> transaction_context = nullptr;
 
+  // Can optionally be set by the caller to fuse chunk-local operators into MorselPipelines
+  UseMorselPipelines use_morsel_pipelines = UseMorselPipelines::No;
+
  private:
   void _compare_tables(const std::shared_ptr<const Table>& actual_result_table,
                        const std::shared_ptr<const Table>& expected_result_table,
@@ -134,6 +134,15 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
   for (auto& thread : threads) thread.join();
 
+  // Shared dictionaries span all chunks of a column and are thus built after the chunks were encoded
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    if (!chunk_encoding_spec[column_id].shared_dictionary) continue;
+    if (find_shared_dictionary_segment(*table, column_id)) continue;
+
+    ChunkEncoder::encode_column_with_shared_dictionary(table, column_id, chunk_encoding_spec[column_id]);
+    encoding_performed = true;
+  }
+
   generate_chunk_pruning_statistics(table);
 
   return encoding_performed;
@@ -23,12 +23,26 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
   }
 
   const auto enable_scheduler = parse_result["scheduler"].as<bool>();
+  const auto work_stealing = parse_result["work_stealing"].as<bool>();
   const auto cores = parse_result["cores"].as<uint32_t>();
   const auto number_of_cores_str = (cores == 0) ? "all available" : std::to_string(cores);
   const auto core_info = enable_scheduler ? " using " + number_of_cores_str + " cores" : "";
   std::cout << "- Running in " + std::string(enable_scheduler ? "multi" : "single") + "-threaded mode" << core_info
             << std::endl;
 
+  if (work_stealing) {
+    if (enable_scheduler) {
+      std::cout << "- Using per-worker work-stealing deques" << std::endl;
+    } else {
+      PerformanceWarning("'--work_stealing' specified but ignored, because '--scheduler' is false");
+    }
+  }
+
+  const auto morsel_pipelines = parse_result["morsel_pipelines"].as<bool>();
+  if (morsel_pipelines) {
+    std::cout << "- Fusing chunk-local operators into morsel pipelines" << std::endl;
+  }
+
   const auto clients = parse_result["clients"].as<uint32_t>();
   std::cout << "- " + std::to_string(clients) + " simulated clients are scheduling items in parallel" << std::endl;
 
@@ -130,9 +144,10 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
   }
 
   return BenchmarkConfig{
-      benchmark_mode,  chunk_size,          *encoding_config, indexes, max_runs, timeout_duration,
-      warmup_duration, output_file_path,    enable_scheduler, cores,   clients,  enable_visualization,
-      verify,          cache_binary_tables, sql_metrics};
+      benchmark_mode,      chunk_size,      *encoding_config, indexes,              max_runs,
+      timeout_duration,    warmup_duration, output_file_path, enable_scheduler,     work_stealing,
+      morsel_pipelines,    cores,           clients,          enable_visualization, verify,
+      cache_binary_tables, sql_metrics};
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
@@ -146,7 +161,9 @@ EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encodin
     Assert(json_spec.count("encoding"), "Need to specify encoding type.");
     const auto encoding_str = json_spec["encoding"];
     const auto compression_str = json_spec.value("compression", "");
-    return EncodingConfig::encoding_spec_from_strings(encoding_str, compression_str);
+    auto encoding_spec = EncodingConfig::encoding_spec_from_strings(encoding_str, compression_str);
+    encoding_spec.shared_dictionary = json_spec.value("shared_dictionary", false);
+    return encoding_spec;
   };
 
   Assert(encoding_config_json.count("default"), "Config must contain default encoding.");
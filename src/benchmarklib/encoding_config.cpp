@@ -48,6 +48,9 @@ nlohmann::json EncodingConfig::to_json() const {
     if (spec.vector_compression_type) {
       mapping["compression"] = vector_compression_type_to_string.left.at(spec.vector_compression_type.value());
     }
+    if (spec.shared_dictionary) {
+      mapping["shared_dictionary"] = true;
+    }
     return mapping;
   };
 
@@ -96,11 +99,14 @@ look like this:
 All encoding/compression types can be viewed with the `help` command or seen
 in constant_mappings.cpp.
 The encoding is always required, the compression is optional.
+With "shared_dictionary", all chunks of a column use a single dictionary. This
+requires Dictionary or FixedStringDictionary encoding.
 
 {
   "default": {
     "encoding": <ENCODING_TYPE_STRING>,               // required
     "compression": <VECTOR_COMPRESSION_TYPE_STRING>,  // optional
+    "shared_dictionary": <BOOLEAN>                    // optional
   },
 
   "type": {
@@ -35,6 +35,7 @@
 #include "pagination.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -431,7 +432,7 @@ int Console::_help(const std::string&) {
   out("  quit                                    - Exit the HYRISE Console\n");
   out("  help                                    - Show this message\n\n");
   out("  setting [property] [value]              - Change a runtime setting\n\n");
-  out("           scheduler (on|off)             - Turn the scheduler on (default) or off\n\n");
+  out("           scheduler (on|work_stealing|off) - Turn the scheduler on (default), on with work-stealing deques, or off\n\n");  // NOLINT
   // clang-format on
 
   return Console::ReturnCode::Ok;
@@ -783,11 +784,14 @@ int Console::_change_runtime_setting(const std::string& input) {
     if (value == "on") {
       Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
       out("Scheduler turned on\n");
+    } else if (value == "work_stealing") {
+      Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+      out("Scheduler with work-stealing deques turned on\n");
     } else if (value == "off") {
       Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
       out("Scheduler turned off\n");
     } else {
-      out("Usage: scheduler (on|off)\n");
+      out("Usage: scheduler (on|work_stealing|off)\n");
       return 1;
     }
     return 0;
@@ -1033,7 +1037,7 @@ char* Console::_command_generator_setting(const char* text, int state) {
 }
 
 char* Console::_command_generator_setting_scheduler(const char* text, int state) {
-  return _command_generator(text, state, {"on", "off"});
+  return _command_generator(text, state, {"on", "work_stealing", "off"});
 }
 
 bool Console::_handle_rollback() {
@@ -2,6 +2,7 @@
 
 #include "hyrise.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
 #include "server/server.hpp"
 
 cxxopts::Options get_server_cli_options() {
@@ -13,6 +14,9 @@ cxxopts::Options get_server_cli_options() {
     ("address", "Specify the address to run on", cxxopts::value<std::string>()->default_value("0.0.0.0"))  // NOLINT
     ("p,port", "Specify the port number. 0 means randomly select an available one. If no port is specified, the the server will start on PostgreSQL's official port", cxxopts::value<uint16_t>()->default_value("5432"))  // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("async_sessions", "Wait for requests asynchronously on a fixed pool of I/O threads instead of using one thread per connection", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("io_threads", "Specify the number of I/O threads for asynchronous sessions", cxxopts::value<uint32_t>()->default_value("2")) // NOLINT
+    ("work_stealing", "Use per-worker work-stealing deques instead of per-node task queues", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -38,9 +42,19 @@ int main(int argc, char* argv[]) {
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
   // Set scheduler so that the server can execute the tasks on separate threads.
-  opossum::Hyrise::get().set_scheduler(std::make_shared<opossum::NodeQueueScheduler>());
+  if (parsed_options["work_stealing"].as<bool>()) {
+    opossum::Hyrise::get().set_scheduler(std::make_shared<opossum::WorkStealingScheduler>());
+  } else {
+    opossum::Hyrise::get().set_scheduler(std::make_shared<opossum::NodeQueueScheduler>());
+  }
+
+  const auto session_mode = parsed_options["async_sessions"].as<bool>() ? opossum::SessionMode::Asynchronous
+                                                                        : opossum::SessionMode::Threaded;
+  const auto io_thread_count =
+      session_mode == opossum::SessionMode::Asynchronous ? parsed_options["io_threads"].as<uint32_t>() : uint32_t{1};
 
-  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info)};
+  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info), session_mode,
+                                io_thread_count};
   server.run();
 
   return 0;
@@ -5,6 +5,7 @@
 
 #include "commit_context.hpp"
 #include "hyrise.hpp"
+#include "logging/log_records.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "utils/assert.hpp"
 
@@ -87,6 +88,23 @@ void TransactionContext::commit_async(const std::function<void(TransactionID)>&
     op->commit_records(commit_id());
   }
 
+  // With logging enabled, the transaction is only marked as pending (and thus becomes visible once all previous
+  // transactions are committed) after its log records are durable. The LogManager calls back from its logger thread.
+  auto& log_manager = Hyrise::get().log_manager;
+  if (log_manager.is_enabled()) {
+    auto log_writer = TransactionLogWriter{};
+    for (const auto& op : _read_write_operators) {
+      op->log_records(log_writer);
+    }
+
+    if (log_writer.record_count() > 0) {
+      log_manager.log_commit(commit_id(), log_writer, [context = shared_from_this(), callback]() {
+        context->_mark_as_pending_and_try_commit(callback);
+      });
+      return;
+    }
+  }
+
   _mark_as_pending_and_try_commit(callback);
 }
 
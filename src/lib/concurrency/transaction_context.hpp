@@ -96,7 +96,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   void rollback();
 
   /**
-   * Commits the transaction.
+   * Commits the transaction. If logging is enabled, the commit completes after the transaction's log records have been
+   * synced to the log file (see LogManager).
    *
    * @param callback called when transaction is actually committed
    */
@@ -67,6 +67,7 @@ class TransactionManager : public Noncopyable {
   TransactionManager();
   ~TransactionManager();
 
+  friend class Checkpoint;
   friend class Hyrise;
   friend class TransactionContext;
 
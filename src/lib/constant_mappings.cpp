@@ -45,6 +45,11 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
 const boost::bimap<FileType, std::string> file_type_to_string = make_bimap<FileType, std::string>(
     {{FileType::Tbl, "Tbl"}, {FileType::Csv, "Csv"}, {FileType::Binary, "Binary"}, {FileType::Auto, "Auto"}});
 
+const boost::bimap<SchedulingClass, std::string> scheduling_class_to_string =
+    make_bimap<SchedulingClass, std::string>({{SchedulingClass::Interactive, "Interactive"},
+                                              {SchedulingClass::Default, "Default"},
+                                              {SchedulingClass::Background, "Background"}});
+
 const boost::bimap<VectorCompressionType, std::string> vector_compression_type_to_string =
     make_bimap<VectorCompressionType, std::string>({
         {VectorCompressionType::FixedSizeByteAligned, "Fixed-size byte-aligned"},
@@ -71,6 +76,10 @@ std::ostream& operator<<(std::ostream& stream, const FileType file_type) {
   return stream << file_type_to_string.left.at(file_type);
 }
 
+std::ostream& operator<<(std::ostream& stream, const SchedulingClass scheduling_class) {
+  return stream << scheduling_class_to_string.left.at(scheduling_class);
+}
+
 std::ostream& operator<<(std::ostream& stream, const VectorCompressionType vector_compression_type) {
   return stream << vector_compression_type_to_string.left.at(vector_compression_type);
 }
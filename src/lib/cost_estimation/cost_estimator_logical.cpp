@@ -1,5 +1,7 @@
 #include "cost_estimator_logical.hpp"
 
+#include <algorithm>
+
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
@@ -31,6 +33,10 @@ Cost CostEstimatorLogical::estimate_node_cost(const std::shared_ptr<AbstractLQPN
     case LQPNodeType::Sort:
       return left_input_row_count * std::log(left_input_row_count);
 
+    case LQPNodeType::TopN:
+      // Every input row is compared to the heap of the output rows
+      return left_input_row_count * std::log(std::max(output_row_count, 2.0f));
+
     case LQPNodeType::Union: {
       const auto union_node = std::static_pointer_cast<UnionNode>(node);
 
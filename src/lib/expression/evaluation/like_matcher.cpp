@@ -8,6 +8,11 @@ namespace opossum {
 
 LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
 
+std::optional<pmr_string> LikeMatcher::prefix() const {
+  if (!std::holds_alternative<StartsWithPattern>(_pattern_variant)) return std::nullopt;
+  return std::get<StartsWithPattern>(_pattern_variant).string;
+}
+
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <experimental/functional>
+#include <optional>
 #include <regex>
 #include <string>
 #include <variant>
@@ -76,6 +77,12 @@ class LikeMatcher {
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
+  /**
+   * @return the prefix if the pattern is a StartsWithPattern (e.g., "hello" for 'hello%'), std::nullopt otherwise.
+   *         In a sorted dictionary, all strings starting with the prefix form a contiguous range.
+   */
+  std::optional<pmr_string> prefix() const;
+
   /**
    * The functor will be called with a concrete matcher.
    * Usage example:
@@ -16,9 +16,11 @@ Hyrise::Hyrise() {
   plugin_manager = PluginManager{};
   storage_manager = StorageManager{};
   transaction_manager = TransactionManager{};
+  log_manager = LogManager{};
   meta_table_manager = MetaTableManager{};
   settings_manager = SettingsManager{};
   topology = Topology{};
+  memory_budget = std::make_shared<MemoryBudget>();
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
@@ -2,6 +2,8 @@
 
 #include "boost/container/pmr/memory_resource.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "logging/log_manager.hpp"
+#include "memory/memory_budget.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -34,10 +36,14 @@ class Hyrise : public Singleton<Hyrise> {
   PluginManager plugin_manager;
   StorageManager storage_manager;
   TransactionManager transaction_manager;
+  LogManager log_manager;
   MetaTableManager meta_table_manager;
   SettingsManager settings_manager;
   Topology topology;
 
+  // Limits the memory of the intermediate data structures of all operators together (see MemoryBudget)
+  std::shared_ptr<MemoryBudget> memory_budget;
+
   // Plan caches used by the SQLPipelineBuilder if `with_{l/p}qp_cache()` are not used. Both default caches can be
   // nullptr themselves. If both default_{l/p}qp_cache and _{l/p}qp_cache are nullptr, no plan caching is used.
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
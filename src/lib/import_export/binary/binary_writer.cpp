@@ -230,13 +230,13 @@ void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment,
   export_values(ofstream, *run_length_segment.end_positions());
 }
 
-template <>
-void BinaryWriter::_write_segment(const FrameOfReferenceSegment<int32_t>& frame_of_reference_segment,
+template <typename T>
+void BinaryWriter::_write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment,
                                   std::ofstream& ofstream) {
   export_value(ofstream, EncodingType::FrameOfReference);
 
   // Write attribute vector width
-  const auto offset_value_vector_width = _compressed_vector_width<int32_t>(frame_of_reference_segment);
+  const auto offset_value_vector_width = _compressed_vector_width<T>(frame_of_reference_segment);
   export_value(ofstream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
 
   // Write number of blocks and block minima
@@ -252,6 +252,15 @@ void BinaryWriter::_write_segment(const FrameOfReferenceSegment<int32_t>& frame_
   // Write offset values
   _export_compressed_vector(ofstream, *frame_of_reference_segment.compressed_vector_type(),
                             frame_of_reference_segment.offset_values());
+
+  // Write high offset values (only for 64-bit types)
+  if constexpr (sizeof(T) == sizeof(uint64_t)) {
+    const auto* high_offset_values = frame_of_reference_segment.high_offset_values();
+    export_value(ofstream, static_cast<BoolAsByteType>(high_offset_values != nullptr));
+    if (high_offset_values) {
+      _export_compressed_vector(ofstream, *frame_of_reference_segment.compressed_vector_type(), *high_offset_values);
+    }
+  }
 }
 
 template <typename T>
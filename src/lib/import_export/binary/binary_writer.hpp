@@ -159,10 +159,15 @@ class BinaryWriter {
    * Block minima                | T                                   | Number of blocks * sizeof(T)
    * Size                        | uint32_t                            | 4
    * NULL values                 | vector<bool> (BoolAsByteType)       | size * 1
-   * Offset values               | uint32_t                            | size * 4
+   * Offset values               | uint32_t                            | size * width of offset vector
+   * Has high offset values¹     | BoolAsByteType                      | 1
+   * High offset values¹²        | uint32_t                            | size * width of offset vector
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written for 64-bit data types (i.e., long and double)
+   * ²: This field is only written if "Has high offset values" is true
    */
   template <typename T>
   static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, std::ofstream& ofstream);
@@ -0,0 +1,51 @@
+#include "mapped_file_reader.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFileReader::MappedFileReader(const std::string& filename) : _filename(filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open file " + filename);
+
+  struct stat file_status {};
+  if (fstat(file_descriptor, &file_status) != 0) {
+    close(file_descriptor);
+    Fail("Could not determine size of file " + filename);
+  }
+  _size = static_cast<size_t>(file_status.st_size);
+
+  // Empty files cannot be mapped, reading from them fails as for any other file that is too short
+  if (_size > 0) {
+    auto* const mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    // The mapping remains valid after the file descriptor is closed
+    close(file_descriptor);
+    Assert(mapping != MAP_FAILED, "Could not map file " + filename);
+    _data = static_cast<const char*>(mapping);
+
+    // Advisory only, the file is read correctly even if the kernel ignores this
+    madvise(mapping, _size, MADV_SEQUENTIAL);
+  } else {
+    close(file_descriptor);
+  }
+}
+
+MappedFileReader::~MappedFileReader() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MappedFileReader::read(const size_t byte_count) {
+  Assert(byte_count <= _size - _position, "Unexpected end of file " + _filename);
+  const auto* const data = _data + _position;
+  _position += byte_count;
+  return data;
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Sequential reader over a file that is mapped into memory. Compared to an std::ifstream, reading does not copy the
+ * file's content into the stream's buffer and from there into the caller's buffer. Instead, callers receive pointers
+ * into the mapping and copy the bytes they need out of it. The mapping itself is read-only and backed by the OS page
+ * cache, and it is read ahead as the file is expected to be read sequentially. Data structures built from the
+ * returned pointers do not reference the mapping, they hold their own copy.
+ *
+ * Pointers returned by read() remain valid as long as the reader exists. Reading beyond the end of the file fails.
+ */
+class MappedFileReader : private Noncopyable {
+ public:
+  explicit MappedFileReader(const std::string& filename);
+  ~MappedFileReader();
+
+  // Returns a pointer to the next byte_count bytes of the file and advances the read position accordingly
+  const char* read(const size_t byte_count);
+
+ private:
+  const std::string _filename;
+  const char* _data{nullptr};
+  size_t _size{0};
+  size_t _position{0};
+};
+
+}  // namespace opossum
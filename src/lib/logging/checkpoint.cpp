@@ -0,0 +1,596 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "concurrency/commit_context.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "logging/log_records.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/statistics_serialization.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto MANIFEST_FILE_NAME = std::string{"manifest"};
+
+enum class CheckpointChunkState : uint8_t {
+  Missing,      // The chunk was physically deleted, no file is written
+  Encoded,      // The chunk is written and recovered with its segments as they are
+  Materialized  // The chunk is written as ValueSegments and recovered as a mutable chunk that the log tail can modify
+};
+
+struct CheckpointChunk {
+  CheckpointChunkState state{CheckpointChunkState::Missing};
+  bool is_mutable{false};
+  ChunkOffset row_count{0};
+  std::optional<std::pair<ColumnID, OrderByMode>> ordered_by;
+  // Rows that are not visible at the snapshot
+  std::vector<ChunkOffset> invalid_chunk_offsets;
+  std::optional<ChunkPruningStatistics> pruning_statistics;
+};
+
+struct CheckpointTable {
+  std::string name;
+  ChunkOffset target_chunk_size;
+  TableColumnDefinitions column_definitions;
+  std::vector<CheckpointChunk> chunks;
+  std::shared_ptr<TableStatistics> table_statistics;
+};
+
+struct Manifest {
+  CommitID snapshot_commit_id;
+  std::vector<CheckpointTable> tables;
+};
+
+std::string chunk_file_path(const std::string& directory, const size_t table_index, const ChunkID chunk_id) {
+  return (std::filesystem::path{directory} /
+          ("table_" + std::to_string(table_index) + "_chunk_" + std::to_string(chunk_id) + ".bin"))
+      .string();
+}
+
+// A record of the log tail that is replayed for a single table
+struct ReplayStep {
+  CommitID commit_id;
+  const InsertLogRecord* insert_record;
+  const DeleteLogRecord* delete_record;
+};
+
+// Makes sure that a file (or a directory entry) has reached the disk
+void sync_file(const std::string& path) {
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open " + path);
+  const auto result = fsync(file_descriptor);
+  close(file_descriptor);
+  Assert(result == 0, "Could not sync " + path);
+}
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    write_value(stream, static_cast<uint64_t>(value.size()));
+    stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+  } else {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
+template <typename T>
+T read_value(std::istream& stream) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto value = std::string(read_value<uint64_t>(stream), '\0');
+    stream.read(value.data(), static_cast<std::streamsize>(value.size()));
+    return value;
+  } else {
+    auto value = T{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+}
+
+void write_manifest(const Manifest& manifest, std::ostream& stream) {
+  write_value(stream, static_cast<uint32_t>(manifest.snapshot_commit_id));
+  write_value(stream, static_cast<uint64_t>(manifest.tables.size()));
+
+  for (const auto& table : manifest.tables) {
+    write_value(stream, table.name);
+    write_value(stream, static_cast<uint32_t>(table.target_chunk_size));
+
+    write_value(stream, static_cast<uint16_t>(table.column_definitions.size()));
+    for (const auto& column_definition : table.column_definitions) {
+      write_value(stream, column_definition.name);
+      write_value(stream, static_cast<uint8_t>(column_definition.data_type));
+      write_value(stream, static_cast<uint8_t>(column_definition.nullable));
+    }
+
+    write_value(stream, static_cast<uint32_t>(table.chunks.size()));
+    for (const auto& chunk : table.chunks) {
+      write_value(stream, static_cast<uint8_t>(chunk.state));
+      write_value(stream, static_cast<uint8_t>(chunk.is_mutable));
+      write_value(stream, static_cast<uint32_t>(chunk.row_count));
+
+      write_value(stream, static_cast<uint8_t>(chunk.ordered_by.has_value()));
+      if (chunk.ordered_by) {
+        write_value(stream, static_cast<uint16_t>(chunk.ordered_by->first));
+        write_value(stream, static_cast<uint8_t>(chunk.ordered_by->second));
+      }
+
+      write_value(stream, static_cast<uint32_t>(chunk.invalid_chunk_offsets.size()));
+      for (const auto chunk_offset : chunk.invalid_chunk_offsets) {
+        write_value(stream, static_cast<uint32_t>(chunk_offset));
+      }
+
+      write_value(stream, static_cast<uint8_t>(chunk.pruning_statistics.has_value()));
+      if (chunk.pruning_statistics) serialize_chunk_pruning_statistics(*chunk.pruning_statistics, stream);
+    }
+
+    write_value(stream, static_cast<uint8_t>(table.table_statistics != nullptr));
+    if (table.table_statistics) serialize_table_statistics(*table.table_statistics, stream);
+  }
+}
+
+Manifest read_manifest(std::istream& stream) {
+  auto manifest = Manifest{};
+  manifest.snapshot_commit_id = CommitID{read_value<uint32_t>(stream)};
+  manifest.tables.resize(read_value<uint64_t>(stream));
+
+  for (auto& table : manifest.tables) {
+    table.name = read_value<std::string>(stream);
+    table.target_chunk_size = ChunkOffset{read_value<uint32_t>(stream)};
+
+    table.column_definitions.resize(read_value<uint16_t>(stream));
+    for (auto& column_definition : table.column_definitions) {
+      column_definition.name = read_value<std::string>(stream);
+      column_definition.data_type = static_cast<DataType>(read_value<uint8_t>(stream));
+      column_definition.nullable = read_value<uint8_t>(stream) != 0;
+    }
+
+    table.chunks.resize(read_value<uint32_t>(stream));
+    for (auto& chunk : table.chunks) {
+      chunk.state = static_cast<CheckpointChunkState>(read_value<uint8_t>(stream));
+      chunk.is_mutable = read_value<uint8_t>(stream) != 0;
+      chunk.row_count = ChunkOffset{read_value<uint32_t>(stream)};
+
+      if (read_value<uint8_t>(stream)) {
+        const auto column_id = ColumnID{read_value<uint16_t>(stream)};
+        const auto order_by_mode = static_cast<OrderByMode>(read_value<uint8_t>(stream));
+        chunk.ordered_by = std::make_pair(column_id, order_by_mode);
+      }
+
+      chunk.invalid_chunk_offsets.resize(read_value<uint32_t>(stream));
+      for (auto& chunk_offset : chunk.invalid_chunk_offsets) {
+        chunk_offset = ChunkOffset{read_value<uint32_t>(stream)};
+      }
+
+      if (read_value<uint8_t>(stream)) chunk.pruning_statistics = deserialize_chunk_pruning_statistics(stream);
+    }
+
+    if (read_value<uint8_t>(stream)) table.table_statistics = deserialize_table_statistics(stream);
+  }
+
+  return manifest;
+}
+
+/**
+ * Copies the values of the rows that are visible at the snapshot into a ValueSegment with the given capacity. Other
+ * rows might still be written by their transaction and are not accessed.
+ */
+template <typename ColumnDataType>
+std::shared_ptr<ValueSegment<ColumnDataType>> materialize_segment(const std::shared_ptr<const BaseSegment>& segment,
+                                                                  const bool nullable, const ChunkOffset row_count,
+                                                                  const std::vector<bool>& row_is_visible,
+                                                                  const ChunkOffset capacity) {
+  auto values = pmr_vector<ColumnDataType>{};
+  auto null_values = pmr_vector<bool>{};
+  values.reserve(capacity);
+  values.resize(row_count);
+  if (nullable) {
+    null_values.reserve(capacity);
+    null_values.resize(row_count);
+  }
+
+  if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(segment)) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      if (!row_is_visible[chunk_offset]) continue;
+      values[chunk_offset] = value_segment->values()[chunk_offset];
+      if (nullable) null_values[chunk_offset] = value_segment->null_values()[chunk_offset];
+    }
+  } else {
+    const auto accessor = create_segment_accessor<ColumnDataType>(segment);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      if (!row_is_visible[chunk_offset]) continue;
+      const auto typed_value = accessor->access(chunk_offset);
+      if (typed_value) {
+        values[chunk_offset] = *typed_value;
+      } else {
+        null_values[chunk_offset] = true;
+      }
+    }
+  }
+
+  if (nullable) return std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+  return std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+}
+
+// Writes the chunk file and returns the chunk's entry of the manifest
+CheckpointChunk checkpoint_chunk(const Table& table, const std::shared_ptr<Chunk>& chunk,
+                                 const CommitID snapshot_commit_id, const std::string& file_path) {
+  auto checkpoint_chunk = CheckpointChunk{};
+  if (!chunk) return checkpoint_chunk;
+
+  // Determine the mutability before the size, as a finalized chunk does not grow anymore
+  checkpoint_chunk.is_mutable = chunk->is_mutable();
+  checkpoint_chunk.row_count = chunk->size();
+  checkpoint_chunk.ordered_by = chunk->ordered_by();
+
+  auto row_is_visible = std::vector<bool>(checkpoint_chunk.row_count);
+  auto all_rows_settled = true;
+  {
+    const auto mvcc_data = chunk->mvcc_data();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < checkpoint_chunk.row_count; ++chunk_offset) {
+      // Rows with a begin_cid above the snapshot were inserted by transactions that committed after the snapshot or
+      // are still active. All other rows were either committed or rolled back before the snapshot.
+      const auto begin_cid = mvcc_data->get_begin_cid(chunk_offset);
+      const auto end_cid = mvcc_data->get_end_cid(chunk_offset);
+      all_rows_settled &= begin_cid <= snapshot_commit_id;
+      row_is_visible[chunk_offset] = begin_cid <= snapshot_commit_id && end_cid > snapshot_commit_id;
+      if (!row_is_visible[chunk_offset]) checkpoint_chunk.invalid_chunk_offsets.emplace_back(chunk_offset);
+    }
+  }
+
+  auto segments = Segments{};
+  const auto column_count = table.column_count();
+  if (!checkpoint_chunk.is_mutable && all_rows_settled && checkpoint_chunk.row_count > 0) {
+    checkpoint_chunk.state = CheckpointChunkState::Encoded;
+    checkpoint_chunk.pruning_statistics = chunk->pruning_statistics();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+  } else {
+    checkpoint_chunk.state = CheckpointChunkState::Materialized;
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        segments.emplace_back(materialize_segment<ColumnDataType>(
+            chunk->get_segment(column_id), table.column_is_nullable(column_id), checkpoint_chunk.row_count,
+            row_is_visible, checkpoint_chunk.row_count));
+      });
+    }
+  }
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{std::make_shared<Chunk>(segments)};
+  BinaryWriter::write(Table{table.column_definitions(), TableType::Data, std::move(chunks)}, file_path);
+  sync_file(file_path);
+
+  return checkpoint_chunk;
+}
+
+// Creates the chunk of the recovered table from the chunk file
+std::pair<Segments, std::shared_ptr<MvccData>> recover_chunk(const CheckpointTable& checkpoint_table,
+                                                             const CheckpointChunk& checkpoint_chunk,
+                                                             const std::string& file_path) {
+  const auto chunk_table = BinaryParser::parse(file_path);
+  Assert(chunk_table->chunk_count() == 1 && chunk_table->row_count() == checkpoint_chunk.row_count,
+         "Checkpoint file " + file_path + " does not match the manifest");
+  const auto chunk = chunk_table->get_chunk(ChunkID{0});
+  const auto column_count = static_cast<ColumnID>(checkpoint_table.column_definitions.size());
+
+  auto segments = Segments{};
+  auto mvcc_data = std::shared_ptr<MvccData>{};
+  if (checkpoint_chunk.state == CheckpointChunkState::Encoded) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+    mvcc_data = std::make_shared<MvccData>(checkpoint_chunk.row_count, CommitID{0});
+  } else {
+    // Reserve the entire chunk so that the log tail and later inserts can append to the chunk
+    const auto capacity = checkpoint_table.target_chunk_size;
+    const auto row_is_visible = std::vector<bool>(checkpoint_chunk.row_count, true);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(checkpoint_table.column_definitions[column_id].data_type, [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        segments.emplace_back(materialize_segment<ColumnDataType>(
+            chunk->get_segment(column_id), checkpoint_table.column_definitions[column_id].nullable,
+            checkpoint_chunk.row_count, row_is_visible, capacity));
+      });
+    }
+
+    mvcc_data = std::make_shared<MvccData>(capacity, MvccData::MAX_COMMIT_ID);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < checkpoint_chunk.row_count; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+    }
+  }
+
+  // Rows that are invalid at the snapshot are treated like rolled back rows, unless the log tail inserts them
+  for (const auto chunk_offset : checkpoint_chunk.invalid_chunk_offsets) {
+    mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+    mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+  }
+
+  return {segments, mvcc_data};
+}
+
+void replay_insert(Table& table, const InsertLogRecord& record, const CommitID commit_id) {
+  while (table.chunk_count() <= record.chunk_id) {
+    table.append_mutable_chunk();
+  }
+
+  const auto chunk = table.get_chunk(record.chunk_id);
+  Assert(chunk && chunk->is_mutable(), "Log record of table " + record.table_name + " refers to an immutable chunk");
+
+  const auto end_chunk_offset = static_cast<ChunkOffset>(record.begin_chunk_offset + record.rows.size());
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto& value_segment = static_cast<ValueSegment<ColumnDataType>&>(*chunk->get_segment(column_id));
+      if (value_segment.size() < end_chunk_offset) value_segment.resize(end_chunk_offset);
+
+      for (auto row_index = size_t{0}; row_index < record.rows.size(); ++row_index) {
+        const auto& value = record.rows[row_index][column_id];
+        const auto chunk_offset = record.begin_chunk_offset + row_index;
+        if (variant_is_null(value)) {
+          value_segment.null_values()[chunk_offset] = true;
+        } else {
+          value_segment.values()[chunk_offset] = boost::get<ColumnDataType>(value);
+          if (value_segment.is_nullable()) value_segment.null_values()[chunk_offset] = false;
+        }
+      }
+    });
+  }
+
+  const auto mvcc_data = chunk->mvcc_data();
+  for (auto chunk_offset = record.begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+    mvcc_data->set_begin_cid(chunk_offset, commit_id);
+    mvcc_data->set_end_cid(chunk_offset, MvccData::MAX_COMMIT_ID);
+  }
+}
+
+void replay_delete(Table& table, const DeleteLogRecord& record, const CommitID commit_id) {
+  for (const auto& row_id : record.row_ids) {
+    const auto chunk = table.get_chunk(row_id.chunk_id);
+    Assert(chunk, "Log record of table " + record.table_name + " refers to a deleted chunk");
+    chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
+  }
+}
+
+// Prepares a recovered chunk for use after the log tail has been replayed
+void complete_chunk(const std::shared_ptr<Chunk>& chunk, const CheckpointChunk* checkpoint_chunk) {
+  auto invalid_row_count = ChunkOffset{0};
+  {
+    const auto mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      // Rows that the log tail skipped belong to transactions that did not commit
+      if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) {
+        mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+        mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+      }
+      if (mvcc_data->get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) ++invalid_row_count;
+    }
+  }
+  if (invalid_row_count > 0) chunk->increase_invalid_row_count(invalid_row_count);
+
+  // Chunks that were appended by the log tail remain mutable
+  if (!checkpoint_chunk) return;
+
+  if (checkpoint_chunk->ordered_by) chunk->set_ordered_by(*checkpoint_chunk->ordered_by);
+  if (!checkpoint_chunk->is_mutable) {
+    chunk->finalize();
+    // Chunks that are recovered as they were written have not been modified by the log tail. For other chunks, the
+    // pruning statistics are recreated by the StorageManager.
+    if (checkpoint_chunk->state == CheckpointChunkState::Encoded) {
+      chunk->set_pruning_statistics(checkpoint_chunk->pruning_statistics);
+    }
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+CommitID Checkpoint::write(const std::string& directory) {
+  std::filesystem::create_directories(directory);
+
+  // The transaction context prevents the snapshot's rows from being cleaned up while the checkpoint is written
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  auto manifest = Manifest{snapshot_commit_id, {}};
+  auto tables = std::vector<std::shared_ptr<Table>>{};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    manifest.tables.emplace_back(CheckpointTable{table_name, table->target_chunk_size(), table->column_definitions(),
+                                                 std::vector<CheckpointChunk>(table->chunk_count()),
+                                                 table->table_statistics()});
+    tables.emplace_back(table);
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto table_index = size_t{0}; table_index < tables.size(); ++table_index) {
+    auto& checkpoint_chunks = manifest.tables[table_index].chunks;
+    const auto chunk_count = static_cast<ChunkID>(checkpoint_chunks.size());
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, table_index, chunk_id]() {
+        const auto& table = tables[table_index];
+        checkpoint_chunks[chunk_id] = checkpoint_chunk(*table, table->get_chunk(chunk_id), snapshot_commit_id,
+                                                       chunk_file_path(directory, table_index, chunk_id));
+      }));
+      jobs.back()->schedule();
+    }
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // Replace the manifest of a previous checkpoint in the same directory atomically
+  const auto manifest_path = (std::filesystem::path{directory} / MANIFEST_FILE_NAME).string();
+  const auto temporary_manifest_path = manifest_path + ".tmp";
+  {
+    auto stream = std::ofstream{temporary_manifest_path, std::ios::binary};
+    stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    write_manifest(manifest, stream);
+  }
+  sync_file(temporary_manifest_path);
+  std::filesystem::rename(temporary_manifest_path, manifest_path);
+  sync_file(directory);
+
+  // The log entries that are part of the checkpoint are no longer needed for recovery
+  auto& log_manager = Hyrise::get().log_manager;
+  if (log_manager.is_enabled()) log_manager.truncate(snapshot_commit_id);
+
+  transaction_context->commit();
+  return snapshot_commit_id;
+}
+
+void Checkpoint::recover(const std::string& directory, const std::string& log_file_path) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  Assert(transaction_manager.last_commit_id() == TransactionManager::INITIAL_COMMIT_ID,
+         "Recovery expects that no transaction has committed yet");
+
+  const auto manifest = [&]() {
+    auto stream = std::ifstream{(std::filesystem::path{directory} / MANIFEST_FILE_NAME).string(), std::ios::binary};
+    Assert(stream.is_open(), "No checkpoint found in " + directory);
+    stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    return read_manifest(stream);
+  }();
+
+  // 1. Load all chunks in parallel
+  auto recovered_chunks = std::vector<std::vector<std::pair<Segments, std::shared_ptr<MvccData>>>>{};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto table_index = size_t{0}; table_index < manifest.tables.size(); ++table_index) {
+    recovered_chunks.emplace_back(manifest.tables[table_index].chunks.size());
+  }
+
+  for (auto table_index = size_t{0}; table_index < manifest.tables.size(); ++table_index) {
+    const auto& checkpoint_table = manifest.tables[table_index];
+    const auto chunk_count = static_cast<ChunkID>(checkpoint_table.chunks.size());
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (checkpoint_table.chunks[chunk_id].state == CheckpointChunkState::Missing) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, table_index, chunk_id]() {
+        recovered_chunks[table_index][chunk_id] =
+            recover_chunk(checkpoint_table, checkpoint_table.chunks[chunk_id],
+                          chunk_file_path(directory, table_index, chunk_id));
+      }));
+      jobs.back()->schedule();
+    }
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  auto tables = std::vector<std::shared_ptr<Table>>{};
+  for (auto table_index = size_t{0}; table_index < manifest.tables.size(); ++table_index) {
+    const auto& checkpoint_table = manifest.tables[table_index];
+    const auto table = std::make_shared<Table>(checkpoint_table.column_definitions, TableType::Data,
+                                               checkpoint_table.target_chunk_size, UseMvcc::Yes);
+
+    const auto chunk_count = static_cast<ChunkID>(checkpoint_table.chunks.size());
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (checkpoint_table.chunks[chunk_id].state == CheckpointChunkState::Missing) {
+        // Keep the ChunkIDs of the subsequent chunks stable
+        table->append_mutable_chunk();
+        table->remove_chunk(chunk_id);
+        continue;
+      }
+
+      const auto& [segments, mvcc_data] = recovered_chunks[table_index][chunk_id];
+      table->append_chunk(segments, mvcc_data);
+    }
+    tables.emplace_back(table);
+  }
+  recovered_chunks.clear();
+
+  // 2. Replay the log tail in commit order. Log records refer to disjoint rows of a single table, so that the tables
+  //    are replayed in parallel. The records are grouped by their table first.
+  auto log_tail = std::vector<TransactionLogEntry>{};
+  if (!log_file_path.empty()) {
+    for (auto& entry : read_log_file(log_file_path)) {
+      if (entry.commit_id > manifest.snapshot_commit_id) log_tail.emplace_back(std::move(entry));
+    }
+  }
+  std::sort(log_tail.begin(), log_tail.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.commit_id < rhs.commit_id; });
+
+  auto table_indices = std::unordered_map<std::string, size_t>{};
+  for (auto table_index = size_t{0}; table_index < manifest.tables.size(); ++table_index) {
+    table_indices.emplace(manifest.tables[table_index].name, table_index);
+  }
+
+  const auto table_index_of = [&](const std::string& table_name) {
+    const auto iter = table_indices.find(table_name);
+    // Tables that were created after the checkpoint cannot be recovered, as their creation is not logged. Dropping
+    // their modifications silently would lose committed data.
+    Assert(iter != table_indices.end(), "Log contains records for table " + table_name +
+                                            ", which is not part of the checkpoint. Write a checkpoint after creating "
+                                            "a table to make it recoverable.");
+    return iter->second;
+  };
+
+  // Within an entry, inserts are replayed before deletes, as deletes may refer to rows that the same transaction
+  // inserted
+  auto log_tail_per_table = std::vector<std::vector<ReplayStep>>(tables.size());
+  for (const auto& entry : log_tail) {
+    for (const auto& record : entry.insert_records) {
+      log_tail_per_table[table_index_of(record.table_name)].emplace_back(ReplayStep{entry.commit_id, &record, nullptr});
+    }
+    for (const auto& record : entry.delete_records) {
+      log_tail_per_table[table_index_of(record.table_name)].emplace_back(ReplayStep{entry.commit_id, nullptr, &record});
+    }
+  }
+
+  jobs.clear();
+  for (auto table_index = size_t{0}; table_index < tables.size(); ++table_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, table_index]() {
+      auto& table = *tables[table_index];
+      for (const auto& step : log_tail_per_table[table_index]) {
+        if (step.insert_record) replay_insert(table, *step.insert_record, step.commit_id);
+        if (step.delete_record) replay_delete(table, *step.delete_record, step.commit_id);
+      }
+
+      const auto chunk_count = table.chunk_count();
+      const auto& checkpoint_chunks = manifest.tables[table_index].chunks;
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table.get_chunk(chunk_id);
+        if (!chunk) continue;
+        complete_chunk(chunk, chunk_id < checkpoint_chunks.size() ? &checkpoint_chunks[chunk_id] : nullptr);
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // 3. Add the tables. The persisted statistics are used unless the log tail modified the table, as they would be
+  //    outdated otherwise. Only then does the StorageManager build them from the table.
+  for (auto table_index = size_t{0}; table_index < tables.size(); ++table_index) {
+    const auto& checkpoint_table = manifest.tables[table_index];
+    const auto table_statistics =
+        log_tail_per_table[table_index].empty() ? checkpoint_table.table_statistics : nullptr;
+    Hyrise::get().storage_manager.add_table(checkpoint_table.name, tables[table_index], table_statistics);
+  }
+
+  // Transactions that start after the recovery see all recovered rows
+  const auto last_commit_id = log_tail.empty() ? manifest.snapshot_commit_id : log_tail.back().commit_id;
+  transaction_manager._last_commit_id = std::max(last_commit_id, TransactionManager::INITIAL_COMMIT_ID);
+  transaction_manager._last_commit_context = std::make_shared<CommitContext>(transaction_manager._last_commit_id);
+}
+
+}  // namespace opossum
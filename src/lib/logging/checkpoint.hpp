@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A checkpoint is a transaction-consistent snapshot of all tables in the StorageManager. Together with the log tail,
+ * i.e., the entries of the write-ahead log (see LogManager) that were committed after the checkpoint's snapshot, it is
+ * used to recover the database after a restart or crash.
+ *
+ * Checkpoints are written while transactions continue to run. The snapshot commit ID of a transaction context that is
+ * created when the checkpoint starts decides which rows are part of the checkpoint. Every chunk is written to a file
+ * of its own using the BinaryWriter format, so that chunks are written and recovered in parallel by the scheduler:
+ *  - Immutable chunks whose rows were all either committed or rolled back at the snapshot are written as they are,
+ *    i.e., in their encoded form. They are recovered without being re-encoded.
+ *  - Mutable chunks and chunks that contain rows of transactions that committed after the snapshot (or had not yet
+ *    committed) are materialized as ValueSegments. Such rows are written as invalid placeholders, as their values
+ *    cannot be read safely while their transaction is active. The log tail overwrites the placeholders of committed
+ *    transactions during recovery.
+ * RowIDs are preserved, as the log records refer to them. Finally, a manifest is written that contains the snapshot
+ * commit ID, the table definitions, the rows that are invalid at the snapshot, and the table and chunk pruning
+ * statistics (see statistics_serialization.hpp). The table statistics are only used during recovery if the log tail
+ * does not modify the table, otherwise they are rebuilt. A checkpoint is only valid once its manifest exists. Once it
+ * does, the log entries that are part of the checkpoint are removed from the log file (see LogManager::truncate).
+ *
+ * As the creation of tables is not logged, tables must exist at the time of the checkpoint to be recovered. Recovery
+ * fails if the log tail contains records for other tables. Modifications are only recovered if logging was enabled
+ * when they were committed.
+ */
+class Checkpoint {
+ public:
+  /**
+   * Writes a checkpoint of all stored tables to the given directory (which is created if it does not exist) and
+   * returns its snapshot commit ID.
+   */
+  static CommitID write(const std::string& directory);
+
+  /**
+   * Adds the tables of the checkpoint in the given directory to the StorageManager and replays all log entries that
+   * were committed after the checkpoint's snapshot. Expects the StorageManager and TransactionManager to be in their
+   * initial state. The log file is optional.
+   */
+  static void recover(const std::string& directory, const std::string& log_file_path = "");
+};
+
+}  // namespace opossum
@@ -0,0 +1,133 @@
+#include "group_commit_logger.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "logging/log_records.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupCommitLogger::GroupCommitLogger(const std::string& file_path, const std::chrono::microseconds group_commit_delay)
+    : _file_path(file_path), _group_commit_delay(group_commit_delay) {
+  _file_descriptor = open(_file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Could not open log file " + _file_path + ": " + std::strerror(errno));
+
+  _thread = std::thread([this] { _run(); });
+}
+
+GroupCommitLogger::~GroupCommitLogger() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown_requested = true;
+  }
+  _condition_variable.notify_one();
+  _thread.join();
+
+  close(_file_descriptor);
+}
+
+void GroupCommitLogger::append(std::vector<char>&& entry, std::function<void()>&& on_durable) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    DebugAssert(!_shutdown_requested, "Cannot append to a logger that is shutting down");
+    _pending_entries.insert(_pending_entries.end(), entry.begin(), entry.end());
+    _pending_callbacks.emplace_back(std::move(on_durable));
+  }
+  _condition_variable.notify_one();
+}
+
+void GroupCommitLogger::truncate(const CommitID commit_id) {
+  const auto lock = std::lock_guard<std::mutex>{_file_mutex};
+
+  // Write the remaining entries to a temporary file and replace the log file with it. A crash in between leaves either
+  // the old or the new file, both of which are valid logs for the checkpoint that triggered the truncation.
+  const auto temporary_file_path = _file_path + ".tmp";
+  const auto temporary_file_descriptor = open(temporary_file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  Assert(temporary_file_descriptor >= 0,
+         "Could not open log file " + temporary_file_path + ": " + std::strerror(errno));
+
+  close(_file_descriptor);
+  _file_descriptor = temporary_file_descriptor;
+  _write(read_log_entries_after(_file_path, commit_id));
+  std::filesystem::rename(temporary_file_path, _file_path);
+
+  // Make the rename durable
+  const auto directory = std::filesystem::absolute(_file_path).parent_path().string();
+  const auto directory_file_descriptor = open(directory.c_str(), O_RDONLY);
+  Assert(directory_file_descriptor >= 0, "Could not open " + directory + ": " + std::strerror(errno));
+  const auto sync_result = fsync(directory_file_descriptor);
+  close(directory_file_descriptor);
+  Assert(sync_result == 0, "Could not sync " + directory + ": " + std::strerror(errno));
+
+  // Subsequent entries are appended to the new file
+  close(_file_descriptor);
+  _file_descriptor = open(_file_path.c_str(), O_WRONLY | O_APPEND);
+  Assert(_file_descriptor >= 0, "Could not open log file " + _file_path + ": " + std::strerror(errno));
+}
+
+size_t GroupCommitLogger::flush_count() const { return _flush_count; }
+
+size_t GroupCommitLogger::entry_count() const { return _entry_count; }
+
+void GroupCommitLogger::_run() {
+  auto entries = std::vector<char>{};
+  auto callbacks = std::vector<std::function<void()>>{};
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition_variable.wait(lock, [&] { return !_pending_callbacks.empty() || _shutdown_requested; });
+      if (_pending_callbacks.empty()) return;
+
+      if (_group_commit_delay.count() > 0 && !_shutdown_requested) {
+        _condition_variable.wait_for(lock, _group_commit_delay, [&] { return _shutdown_requested; });
+      }
+
+      std::swap(entries, _pending_entries);
+      std::swap(callbacks, _pending_callbacks);
+    }
+
+    {
+      const auto lock = std::lock_guard<std::mutex>{_file_mutex};
+      _write(entries);
+    }
+    ++_flush_count;
+    _entry_count += callbacks.size();
+
+    for (const auto& callback : callbacks) {
+      callback();
+    }
+
+    entries.clear();
+    callbacks.clear();
+  }
+}
+
+void GroupCommitLogger::_write(const std::vector<char>& buffer) {
+  auto bytes_written = size_t{0};
+  while (bytes_written < buffer.size()) {
+    const auto result = write(_file_descriptor, buffer.data() + bytes_written, buffer.size() - bytes_written);
+    if (result < 0 && errno == EINTR) continue;
+    Assert(result >= 0, std::string{"Could not write to log file: "} + std::strerror(errno));
+    bytes_written += static_cast<size_t>(result);
+  }
+
+  // The entries are only durable once they have reached the disk. fdatasync does not sync metadata that is not
+  // required to read the file, such as the modification time. It is not available on macOS.
+#ifdef __APPLE__
+  const auto sync_result = fsync(_file_descriptor);
+#else
+  const auto sync_result = fdatasync(_file_descriptor);
+#endif
+  Assert(sync_result == 0, std::string{"Could not sync log file: "} + std::strerror(errno));
+}
+
+}  // namespace opossum
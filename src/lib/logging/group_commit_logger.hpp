@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Appends log entries to a log file using group commit. Committing transactions hand their serialized entry to append()
+ * and continue once their callback was called. A background thread writes all entries that were appended since its
+ * last write and syncs the file once for all of them. While it waits for the sync, new entries are collected for the
+ * next write. This way, the cost of a sync is amortized across all concurrently committing transactions.
+ *
+ * Optionally, the thread waits for group_commit_delay before each write so that more transactions join a group. This
+ * trades commit latency for fewer syncs under low contention.
+ */
+class GroupCommitLogger : public Noncopyable {
+ public:
+  GroupCommitLogger(const std::string& file_path, const std::chrono::microseconds group_commit_delay);
+
+  // Writes and syncs all outstanding entries before returning
+  ~GroupCommitLogger();
+
+  // Called from the committing threads. on_durable is called by the logger thread once the entry has been synced.
+  void append(std::vector<char>&& entry, std::function<void()>&& on_durable);
+
+  // Atomically replaces the log file with one that only contains the entries committed after commit_id. Entries that
+  // are appended meanwhile are written to the new file.
+  void truncate(const CommitID commit_id);
+
+  // Number of syncs and of entries written so far
+  size_t flush_count() const;
+  size_t entry_count() const;
+
+ private:
+  void _run();
+  void _write(const std::vector<char>& buffer);
+
+  const std::string _file_path;
+  const std::chrono::microseconds _group_commit_delay;
+
+  // Held while the file is written to or replaced
+  std::mutex _file_mutex;
+  int _file_descriptor;
+
+  std::mutex _mutex;
+  std::condition_variable _condition_variable;
+  std::vector<char> _pending_entries;
+  std::vector<std::function<void()>> _pending_callbacks;
+  bool _shutdown_requested{false};
+
+  std::atomic<size_t> _flush_count{0};
+  std::atomic<size_t> _entry_count{0};
+
+  std::thread _thread;
+};
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#include "log_manager.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "group_commit_logger.hpp"
+#include "log_records.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+LogManager::LogManager() = default;
+
+LogManager::~LogManager() = default;
+
+LogManager& LogManager::operator=(LogManager&& log_manager) noexcept = default;
+
+void LogManager::enable(const std::string& log_file_path, const std::chrono::microseconds group_commit_delay) {
+  Assert(!_logger, "Logging is already enabled");
+  _logger = std::make_unique<GroupCommitLogger>(log_file_path, group_commit_delay);
+}
+
+void LogManager::disable() {
+  Assert(_logger, "Logging is not enabled");
+  _logger.reset();
+}
+
+bool LogManager::is_enabled() const { return static_cast<bool>(_logger); }
+
+void LogManager::log_commit(const CommitID commit_id, TransactionLogWriter& log_writer,
+                            std::function<void()>&& on_durable) {
+  DebugAssert(_logger, "Logging is not enabled");
+  _logger->append(log_writer.finish(commit_id), std::move(on_durable));
+}
+
+void LogManager::truncate(const CommitID commit_id) {
+  Assert(_logger, "Logging is not enabled");
+  _logger->truncate(commit_id);
+}
+
+size_t LogManager::flush_count() const { return _logger ? _logger->flush_count() : 0; }
+
+size_t LogManager::logged_transaction_count() const { return _logger ? _logger->entry_count() : 0; }
+
+}  // namespace opossum
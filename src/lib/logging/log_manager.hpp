@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class GroupCommitLogger;
+class TransactionLogWriter;
+
+/**
+ * The LogManager provides write-ahead logging for committing transactions (see logging/log_records.hpp for the log
+ * format). Logging is disabled by default. Once it is enabled, TransactionContext::commit_async() hands the log records
+ * of every transaction that modified data to the LogManager and only makes the modifications visible after they have
+ * been written to the log file and synced (see GroupCommitLogger).
+ */
+class LogManager : public Noncopyable {
+ public:
+  // Appends to the given file, which is created if it does not exist
+  void enable(const std::string& log_file_path,
+              const std::chrono::microseconds group_commit_delay = std::chrono::microseconds{0});
+
+  // Waits until all outstanding log entries are durable
+  void disable();
+
+  bool is_enabled() const;
+
+  // Serializes the log records of a committing transaction and calls on_durable once they have been synced
+  void log_commit(const CommitID commit_id, TransactionLogWriter& log_writer, std::function<void()>&& on_durable);
+
+  // Removes the entries committed at or before commit_id from the log file, called once a checkpoint with this
+  // snapshot commit ID has been written
+  void truncate(const CommitID commit_id);
+
+  // Number of syncs and of logged transactions since logging was enabled
+  size_t flush_count() const;
+  size_t logged_transaction_count() const;
+
+ private:
+  LogManager();
+  ~LogManager();
+
+  friend class Hyrise;
+
+  LogManager& operator=(LogManager&& log_manager) noexcept;
+
+  std::unique_ptr<GroupCommitLogger> _logger;
+};
+
+}  // namespace opossum
@@ -0,0 +1,261 @@
+#include "log_records.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "boost/crc.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/segment_accessor.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto ENTRY_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+template <typename T>
+void write_value(std::vector<char>& buffer, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, std::string>) {
+    Assert(value.size() <= std::numeric_limits<uint32_t>::max(), "String is too long to be logged");
+    write_value(buffer, static_cast<uint32_t>(value.size()));
+    buffer.insert(buffer.end(), value.begin(), value.end());
+  } else {
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+}
+
+uint32_t checksum(const char* data, const size_t size) {
+  auto crc = boost::crc_32_type{};
+  crc.process_bytes(data, size);
+  return crc.checksum();
+}
+
+std::vector<char> read_file(const std::string& file_path) {
+  auto file = std::ifstream{file_path, std::ios::binary};
+  Assert(file.is_open(), "Could not open log file " + file_path);
+  return std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+// Calls functor with the position and size of the payload of each entry. Stops at the first entry that is incomplete or
+// whose checksum does not match.
+template <typename Functor>
+void for_each_complete_entry(const std::vector<char>& log, const Functor& functor) {
+  auto position = size_t{0};
+  while (position + ENTRY_HEADER_SIZE <= log.size()) {
+    auto payload_size = uint32_t{};
+    auto expected_checksum = uint32_t{};
+    std::memcpy(&payload_size, log.data() + position, sizeof(uint32_t));
+    std::memcpy(&expected_checksum, log.data() + position + sizeof(uint32_t), sizeof(uint32_t));
+
+    const auto payload_begin = position + ENTRY_HEADER_SIZE;
+    if (payload_begin + payload_size > log.size()) break;
+    if (checksum(log.data() + payload_begin, payload_size) != expected_checksum) break;
+
+    functor(payload_begin, payload_size);
+    position = payload_begin + payload_size;
+  }
+}
+
+// Reads the records of an entry whose checksum has already been validated
+class LogEntryReader {
+ public:
+  LogEntryReader(const char* data, const size_t size) : _position(data), _end(data + size) {}
+
+  template <typename T>
+  T read_value() {
+    if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, std::string>) {
+      const auto size = read_value<uint32_t>();
+      Assert(_position + size <= _end, "Log entry is malformed");
+      auto value = T{_position, size};
+      _position += size;
+      return value;
+    } else {
+      Assert(_position + sizeof(T) <= _end, "Log entry is malformed");
+      auto value = T{};
+      std::memcpy(&value, _position, sizeof(T));
+      _position += sizeof(T);
+      return value;
+    }
+  }
+
+  TransactionLogEntry read_entry() {
+    auto entry = TransactionLogEntry{};
+    entry.commit_id = CommitID{read_value<uint32_t>()};
+
+    const auto record_count = read_value<uint32_t>();
+    for (auto record_index = uint32_t{0}; record_index < record_count; ++record_index) {
+      const auto record_type = static_cast<LogRecordType>(read_value<uint8_t>());
+      switch (record_type) {
+        case LogRecordType::Insert:
+          entry.insert_records.emplace_back(_read_insert_record());
+          break;
+        case LogRecordType::Delete:
+          entry.delete_records.emplace_back(_read_delete_record());
+          break;
+        default:
+          Fail("Unknown log record type");
+      }
+    }
+
+    Assert(_position == _end, "Log entry is malformed");
+    return entry;
+  }
+
+ private:
+  InsertLogRecord _read_insert_record() {
+    auto record = InsertLogRecord{};
+    record.table_name = read_value<std::string>();
+    record.chunk_id = ChunkID{read_value<uint32_t>()};
+    record.begin_chunk_offset = ChunkOffset{read_value<uint32_t>()};
+
+    const auto row_count = read_value<uint32_t>();
+    const auto column_count = read_value<uint16_t>();
+    record.rows.resize(row_count, std::vector<AllTypeVariant>(column_count));
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto data_type = static_cast<DataType>(read_value<uint8_t>());
+      const auto nullable = read_value<uint8_t>() != 0;
+
+      resolve_data_type(data_type, [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        for (auto& row : record.rows) {
+          if (nullable && read_value<uint8_t>() != 0) {
+            row[column_id] = NULL_VALUE;
+          } else {
+            row[column_id] = read_value<ColumnDataType>();
+          }
+        }
+      });
+    }
+
+    return record;
+  }
+
+  DeleteLogRecord _read_delete_record() {
+    auto record = DeleteLogRecord{};
+    record.table_name = read_value<std::string>();
+
+    const auto row_count = read_value<uint32_t>();
+    record.row_ids.reserve(row_count);
+    for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+      const auto chunk_id = ChunkID{read_value<uint32_t>()};
+      const auto chunk_offset = ChunkOffset{read_value<uint32_t>()};
+      record.row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+
+    return record;
+  }
+
+  const char* _position;
+  const char* const _end;
+};
+
+}  // namespace
+
+namespace opossum {
+
+void TransactionLogWriter::add_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                                      const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  DebugAssert(begin_chunk_offset <= end_chunk_offset, "Invalid chunk range");
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto column_count = table.column_count();
+
+  write_value(_records, static_cast<uint8_t>(LogRecordType::Insert));
+  write_value(_records, table_name);
+  write_value(_records, static_cast<uint32_t>(chunk_id));
+  write_value(_records, static_cast<uint32_t>(begin_chunk_offset));
+  write_value(_records, static_cast<uint32_t>(end_chunk_offset - begin_chunk_offset));
+  write_value(_records, static_cast<uint16_t>(column_count));
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto data_type = table.column_data_type(column_id);
+    const auto nullable = table.column_is_nullable(column_id);
+    write_value(_records, static_cast<uint8_t>(data_type));
+    write_value(_records, static_cast<uint8_t>(nullable));
+
+    resolve_data_type(data_type, [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto accessor = create_segment_accessor<ColumnDataType>(chunk->get_segment(column_id));
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        const auto typed_value = accessor->access(chunk_offset);
+        if (nullable) write_value(_records, static_cast<uint8_t>(!typed_value));
+        if (typed_value) write_value(_records, *typed_value);
+      }
+    });
+  }
+
+  ++_record_count;
+}
+
+void TransactionLogWriter::add_delete(const std::string& table_name, const AbstractPosList& row_ids) {
+  write_value(_records, static_cast<uint8_t>(LogRecordType::Delete));
+  write_value(_records, table_name);
+  write_value(_records, static_cast<uint32_t>(row_ids.size()));
+
+  for (const auto& row_id : row_ids) {
+    write_value(_records, static_cast<uint32_t>(row_id.chunk_id));
+    write_value(_records, static_cast<uint32_t>(row_id.chunk_offset));
+  }
+
+  ++_record_count;
+}
+
+size_t TransactionLogWriter::record_count() const { return _record_count; }
+
+std::vector<char> TransactionLogWriter::finish(const CommitID commit_id) {
+  auto payload = std::vector<char>{};
+  payload.reserve(2 * sizeof(uint32_t) + _records.size());
+  write_value(payload, static_cast<uint32_t>(commit_id));
+  write_value(payload, _record_count);
+  payload.insert(payload.end(), _records.begin(), _records.end());
+  Assert(payload.size() <= std::numeric_limits<uint32_t>::max(), "Log entry is too large");
+
+  auto entry = std::vector<char>{};
+  entry.reserve(ENTRY_HEADER_SIZE + payload.size());
+  write_value(entry, static_cast<uint32_t>(payload.size()));
+  write_value(entry, checksum(payload.data(), payload.size()));
+  entry.insert(entry.end(), payload.begin(), payload.end());
+
+  _records = {};
+  _record_count = 0;
+  return entry;
+}
+
+std::vector<TransactionLogEntry> read_log_file(const std::string& file_path) {
+  const auto log = read_file(file_path);
+
+  auto entries = std::vector<TransactionLogEntry>{};
+  for_each_complete_entry(log, [&](const size_t payload_begin, const uint32_t payload_size) {
+    entries.emplace_back(LogEntryReader{log.data() + payload_begin, payload_size}.read_entry());
+  });
+
+  return entries;
+}
+
+std::vector<char> read_log_entries_after(const std::string& file_path, const CommitID commit_id) {
+  const auto log = read_file(file_path);
+
+  auto entries = std::vector<char>{};
+  for_each_complete_entry(log, [&](const size_t payload_begin, const uint32_t payload_size) {
+    // The commit ID is the first value of the payload
+    auto entry_commit_id = uint32_t{};
+    std::memcpy(&entry_commit_id, log.data() + payload_begin, sizeof(uint32_t));
+    if (CommitID{entry_commit_id} <= commit_id) return;
+
+    entries.insert(entries.end(), log.begin() + (payload_begin - ENTRY_HEADER_SIZE),
+                   log.begin() + (payload_begin + payload_size));
+  });
+
+  return entries;
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The write-ahead log consists of one entry per committed transaction that modified data. An entry holds logical log
+ * records, i.e., the values of inserted rows and the RowIDs of deleted rows, which are sufficient to redo the
+ * modifications of the transaction. Updates are logged as the records of the Delete and Insert operators they consist
+ * of.
+ *
+ * Inserted rows are logged together with their position in the target table. Rows are appended to a table in the order
+ * in which the Insert operators allocate them, not in the order of the commits. Storing the position allows a replay
+ * to reproduce the same RowIDs, which are then referenced by the logged deletes.
+ *
+ * Binary format of an entry (all integers in native byte order):
+ *
+ *   uint32_t payload_size
+ *   uint32_t checksum (CRC-32 of the payload)
+ *   payload:
+ *     uint32_t commit_id
+ *     uint32_t record_count
+ *     records, each starting with a uint8_t LogRecordType:
+ *       Insert: string table_name, uint32_t chunk_id, uint32_t begin_chunk_offset, uint32_t row_count,
+ *               uint16_t column_count, per column: uint8_t data_type, uint8_t nullable, per row: value
+ *       Delete: string table_name, uint32_t row_count, per row: uint32_t chunk_id, uint32_t chunk_offset
+ *
+ * Strings are stored as a uint32_t length followed by their characters, values of other types are stored as is. Values
+ * of nullable columns are preceded by a uint8_t NULL flag, NULLs themselves are not stored. The checksum allows readers
+ * to detect an entry that was only partially written before a crash.
+ */
+enum class LogRecordType : uint8_t { Insert, Delete };
+
+struct InsertLogRecord {
+  std::string table_name;
+  ChunkID chunk_id;
+  ChunkOffset begin_chunk_offset;
+  std::vector<std::vector<AllTypeVariant>> rows;
+};
+
+struct DeleteLogRecord {
+  std::string table_name;
+  std::vector<RowID> row_ids;
+};
+
+/**
+ * Decoded log entry of a transaction. A transaction can only delete rows that existed before it or that it inserted
+ * itself. Thus, applying all inserts before all deletes redoes the transaction.
+ */
+struct TransactionLogEntry {
+  CommitID commit_id;
+  std::vector<InsertLogRecord> insert_records;
+  std::vector<DeleteLogRecord> delete_records;
+};
+
+/**
+ * Collects the log records of a transaction while it commits (see AbstractReadWriteOperator::log_records) and
+ * serializes them into a log entry.
+ */
+class TransactionLogWriter {
+ public:
+  // Logs the values of the rows [begin_chunk_offset, end_chunk_offset) of the given chunk
+  void add_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                  const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  void add_delete(const std::string& table_name, const AbstractPosList& row_ids);
+
+  size_t record_count() const;
+
+  // Returns the complete entry including its header and clears the writer
+  std::vector<char> finish(const CommitID commit_id);
+
+ private:
+  uint32_t _record_count{0};
+  std::vector<char> _records;
+};
+
+/**
+ * Reads all entries of a log file. Reading stops at the first entry that is incomplete or whose checksum does not
+ * match, as this is the entry that was being written when the system crashed.
+ */
+std::vector<TransactionLogEntry> read_log_file(const std::string& file_path);
+
+/**
+ * Returns the serialized entries of a log file that were committed after commit_id, e.g., those that are not yet part
+ * of a checkpoint, as they are stored in the file. Like read_log_file, it stops at the first incomplete entry.
+ */
+std::vector<char> read_log_entries_after(const std::string& file_path, const CommitID commit_id);
+
+}  // namespace opossum
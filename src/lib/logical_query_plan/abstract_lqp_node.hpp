@@ -32,6 +32,7 @@ enum class LQPNodeType {
   Sort,
   StaticTable,
   StoredTable,
+  TopN,
   Update,
   Union,
   Validate,
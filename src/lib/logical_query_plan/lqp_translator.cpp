@@ -21,6 +21,7 @@
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -31,6 +32,7 @@
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
@@ -49,6 +51,7 @@
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
+#include "operators/morsel_pipeline.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/product.hpp"
@@ -56,6 +59,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
@@ -65,6 +69,7 @@
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
 #include "stored_table_node.hpp"
+#include "top_n_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 
@@ -72,6 +77,9 @@ using namespace std::string_literals;  // NOLINT
 
 namespace opossum {
 
+LQPTranslator::LQPTranslator(const UseMorselPipelines use_morsel_pipelines)
+    : _use_morsel_pipelines(use_morsel_pipelines) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -90,6 +98,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
    * would result in multiple operators created from predicate_c and thus in performance drops
    */
 
+  if (!_counted_lqp_nodes.count(node)) _count_outputs(node);
+
   const auto operator_iter = _operator_by_lqp_node.find(node);
   if (operator_iter != _operator_by_lqp_node.end()) {
     return operator_iter->second;
@@ -101,6 +111,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   // _translate_predicate_node_to_index_scan() as well, because the function creates two scans operators and returns
   // only the merging union node (all three PQP nodes share the same originating LQP node).
   pqp->lqp_node = node;
+
+  if (_use_morsel_pipelines == UseMorselPipelines::Yes) {
+    pqp = _fuse_into_morsel_pipeline(node, pqp);
+  }
+
   _operator_by_lqp_node.emplace(node, pqp);
 
   return pqp;
@@ -115,6 +130,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::Predicate:          return _translate_predicate_node(node);
     case LQPNodeType::Projection:         return _translate_projection_node(node);
     case LQPNodeType::Sort:               return _translate_sort_node(node);
+    case LQPNodeType::TopN:               return _translate_top_n_node(node);
     case LQPNodeType::Join:               return _translate_join_node(node);
     case LQPNodeType::Aggregate:          return _translate_aggregate_node(node);
     case LQPNodeType::Limit:              return _translate_limit_node(node);
@@ -152,20 +168,78 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_node = node->left_input();
-  const auto input_operator = translate_node(input_node);
   const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
 
   switch (predicate_node->scan_type) {
     case ScanType::TableScan:
-      return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
+      return _translate_predicate_chain_to_table_scan(predicate_node);
     case ScanType::IndexScan:
-      return _translate_predicate_node_to_index_scan(predicate_node, input_operator);
+      return _translate_predicate_node_to_index_scan(predicate_node, translate_node(node->left_input()));
   }
 
   Fail("Invalid enum value");
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_chain_to_table_scan(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * The PredicateSplitUpRule splits conjunctions into chains of PredicateNodes, so that the optimizer can place and
+   * order the predicates individually. Executing such a chain as one TableScan per PredicateNode would create an
+   * intermediate reference table per predicate and make later predicates access their values through
+   * ReferenceSegments. Instead, we fuse the chain into a single TableScan that evaluates the conjunction of the
+   * predicates chunk by chunk (see ConjunctionTableScanImpl), starting with the lowest one.
+   */
+  if (!_is_fusable_predicate_node(node)) {
+    return _translate_predicate_node_to_table_scan(node, translate_node(node->left_input()));
+  }
+
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{node};
+  auto input_node = node->left_input();
+  while (_is_fusable_predicate_node(input_node) && _output_count_by_lqp_node.at(input_node) == 1 &&
+         !_operator_by_lqp_node.count(input_node)) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(input_node));
+    input_node = input_node->left_input();
+  }
+
+  const auto input_operator = translate_node(input_node);
+  if (predicate_nodes.size() == 1) return _translate_predicate_node_to_table_scan(node, input_operator);
+
+  // PredicateNodes do not change the columns, so all predicates can be resolved against the input of the chain
+  auto conjuncts = std::vector<std::shared_ptr<AbstractExpression>>{};
+  conjuncts.reserve(predicate_nodes.size());
+  for (auto node_iter = predicate_nodes.crbegin(); node_iter != predicate_nodes.crend(); ++node_iter) {
+    conjuncts.emplace_back(_translate_expression((*node_iter)->predicate(), input_node));
+  }
+
+  return std::make_shared<TableScan>(input_operator, inflate_logical_expressions(conjuncts, LogicalOperator::And));
+}
+
+bool LQPTranslator::_is_fusable_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (node->type != LQPNodeType::Predicate) return false;
+
+  const auto& predicate_node = static_cast<const PredicateNode&>(*node);
+  if (predicate_node.scan_type != ScanType::TableScan) return false;
+
+  // Predicates with subqueries are evaluated by the ExpressionEvaluator for all rows of a chunk. Keeping them in a
+  // TableScan of their own makes sure that they only see the rows that passed the previous predicates.
+  auto contains_subquery = false;
+  auto predicate = predicate_node.predicate();
+  visit_expression(predicate, [&](const auto& expression) {
+    if (expression->type == ExpressionType::LQPSubquery) contains_subquery = true;
+    return contains_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return !contains_subquery;
+}
+
+void LQPTranslator::_count_outputs(const std::shared_ptr<AbstractLQPNode>& root) const {
+  visit_lqp(root, [&](const auto& node) {
+    if (!_counted_lqp_nodes.emplace(node).second) return LQPVisitation::DoNotVisitInputs;
+
+    _output_count_by_lqp_node[node] += node->output_count();
+    return LQPVisitation::VisitInputs;
+  });
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   /**
@@ -267,27 +341,22 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
-  auto input_operator = translate_node(node->left_input());
-
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
-
-  auto pqp_expression_iter = pqp_expressions.begin();
-  auto order_by_mode_iter = sort_node->order_by_modes.begin();
+  const auto input_operator = translate_node(node->left_input());
 
-  std::vector<SortColumnDefinition> column_definitions;
-  column_definitions.reserve(pqp_expressions.size());
-  for (; pqp_expression_iter != pqp_expressions.end(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
-    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
-    Assert(pqp_column_expression,
-           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
+  return std::make_shared<Sort>(
+      input_operator,
+      _translate_sort_definitions(sort_node->node_expressions, sort_node->order_by_modes, node->left_input()));
+}
 
-    column_definitions.emplace_back(SortColumnDefinition{pqp_column_expression->column_id, *order_by_mode_iter});
-  }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_top_n_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto top_n_node = std::dynamic_pointer_cast<TopNNode>(node);
+  const auto input_operator = translate_node(node->left_input());
 
-  return current_pqp;
+  return std::make_shared<TopN>(
+      input_operator,
+      _translate_sort_definitions(top_n_node->sort_expressions(), top_n_node->order_by_modes, node->left_input()),
+      _translate_expression(top_n_node->num_rows_expression(), node->left_input()));
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -438,6 +507,39 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_fuse_into_morsel_pipeline(
+    const std::shared_ptr<AbstractLQPNode>& node, const std::shared_ptr<AbstractOperator>& op) const {
+  if (!MorselPipeline::is_pipelineable(*op)) return op;
+
+  // If the input is consumed by other operators as well, it has to be materialized anyway. As PredicateNodes might
+  // have been fused into a TableScan, the input operator does not necessarily belong to node->left_input().
+  const auto input_operator = op->mutable_input_left();
+  if (input_operator->lqp_node->output_count() != 1) return op;
+
+  auto pipeline_input = std::shared_ptr<const AbstractOperator>{};
+  auto stages = std::vector<std::shared_ptr<AbstractOperator>>{};
+
+  if (const auto input_pipeline = std::dynamic_pointer_cast<MorselPipeline>(input_operator)) {
+    // Extend the existing pipeline by a copy of the operator that consumes the last stage instead of the pipeline
+    pipeline_input = input_pipeline->input_left();
+    stages = input_pipeline->stages;
+
+    auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+    copied_ops.emplace(input_pipeline.get(), stages.back());
+    stages.emplace_back(op->deep_copy(copied_ops));
+    stages.back()->lqp_node = node;
+  } else if (MorselPipeline::is_pipelineable(*input_operator)) {
+    pipeline_input = input_operator->input_left();
+    stages = {input_operator, op};
+  } else {
+    return op;
+  }
+
+  const auto pipeline = std::make_shared<MorselPipeline>(pipeline_input, stages);
+  pipeline->lqp_node = node;
+  return pipeline;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_change_meta_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator_left = translate_node(node->left_input());
@@ -592,4 +694,23 @@ std::vector<std::shared_ptr<AbstractExpression>> LQPTranslator::_translate_expre
   return pqp_expressions;
 }
 
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_definitions(
+    const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
+    const std::vector<OrderByMode>& order_by_modes, const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto pqp_expressions = _translate_expressions(lqp_expressions, node);
+
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  sort_definitions.reserve(pqp_expressions.size());
+  for (auto expression_idx = size_t{0}; expression_idx < pqp_expressions.size(); ++expression_idx) {
+    const auto& pqp_expression = pqp_expressions[expression_idx];
+    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
+    Assert(pqp_column_expression,
+           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
+
+    sort_definitions.emplace_back(pqp_column_expression->column_id, order_by_modes[expression_idx]);
+  }
+
+  return sort_definitions;
+}
+
 }  // namespace opossum
@@ -2,6 +2,8 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -16,13 +18,19 @@ class PredicateNode;
 class TableScan;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
+struct SortColumnDefinition;
 
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * With UseMorselPipelines::Yes, chains of chunk-local operators (see MorselPipeline::is_pipelineable) are fused into
+ * MorselPipelines, so that their intermediate results are not materialized for the entire table.
  */
 class LQPTranslator {
  public:
+  explicit LQPTranslator(const UseMorselPipelines use_morsel_pipelines = UseMorselPipelines::No);
+
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -37,9 +45,15 @@ class LQPTranslator {
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+
+  // Fuses a chain of PredicateNodes into a single TableScan on their conjunction, where possible
+  std::shared_ptr<AbstractOperator> _translate_predicate_chain_to_table_scan(
+      const std::shared_ptr<PredicateNode>& node) const;
+  static bool _is_fusable_predicate_node(const std::shared_ptr<AbstractLQPNode>& node);
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_top_n_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -53,6 +67,10 @@ class LQPTranslator {
       const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_validate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Fuses the operator translated from `node` with its input into a MorselPipeline, if possible
+  std::shared_ptr<AbstractOperator> _fuse_into_morsel_pipeline(const std::shared_ptr<AbstractLQPNode>& node,
+                                                               const std::shared_ptr<AbstractOperator>& op) const;
+
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_show_columns_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -72,10 +90,24 @@ class LQPTranslator {
       const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Translate the sort expressions of a SortNode or TopNNode to SortColumnDefinitions
+  std::vector<SortColumnDefinition> _translate_sort_definitions(
+      const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
+      const std::vector<OrderByMode>& order_by_modes, const std::shared_ptr<AbstractLQPNode>& node) const;
+
   // Cache operator subtrees by LQP node to avoid redundantly executing
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  // Number of outputs of each LQP node, summed up over all nodes that are equal to it (and are thus translated into the
+  // same operator, see above). A PredicateNode is only fused into the TableScan of its output if that is its only
+  // consumer.
+  void _count_outputs(const std::shared_ptr<AbstractLQPNode>& root) const;
+  mutable LQPNodeUnorderedMap<size_t> _output_count_by_lqp_node;
+  mutable std::unordered_set<std::shared_ptr<AbstractLQPNode>> _counted_lqp_nodes;
+
+  const UseMorselPipelines _use_morsel_pipelines;
 };
 
 }  // namespace opossum
@@ -229,6 +229,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::Sort:
       case LQPNodeType::StaticTable:
       case LQPNodeType::StoredTable:
+      case LQPNodeType::TopN:
       case LQPNodeType::Union:
       case LQPNodeType::Mock:
         return LQPVisitation::VisitInputs;
@@ -282,6 +283,7 @@ std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression_impl(
     case LQPNodeType::Sort:
     case LQPNodeType::Validate:
     case LQPNodeType::Limit:
+    case LQPNodeType::TopN:
       return lqp_subplan_to_boolean_expression_impl(begin->left_input(), end, subsequent_expression);
 
     default:
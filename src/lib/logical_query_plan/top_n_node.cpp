@@ -0,0 +1,64 @@
+#include "top_n_node.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TopNNode::TopNNode(const std::vector<std::shared_ptr<AbstractExpression>>& sort_expressions,
+                   const std::vector<OrderByMode>& init_order_by_modes,
+                   const std::shared_ptr<AbstractExpression>& num_rows_expression)
+    : AbstractLQPNode(LQPNodeType::TopN, sort_expressions), order_by_modes(init_order_by_modes) {
+  Assert(sort_expressions.size() == order_by_modes.size(), "Expected as many Expressions as OrderByModes");
+  Assert(!sort_expressions.empty(), "Expected at least one sort expression");
+  node_expressions.emplace_back(num_rows_expression);
+}
+
+std::string TopNNode::description(const DescriptionMode mode) const {
+  const auto expression_mode = _expression_description_mode(mode);
+
+  std::stringstream stream;
+  stream << "[TopN] " << num_rows_expression()->description(expression_mode) << " rows by ";
+
+  for (auto expression_idx = size_t{0}; expression_idx < order_by_modes.size(); ++expression_idx) {
+    stream << node_expressions[expression_idx]->description(expression_mode) << " ";
+    stream << "(" << order_by_modes[expression_idx] << ")";
+
+    if (expression_idx + 1 < order_by_modes.size()) stream << ", ";
+  }
+  return stream.str();
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> TopNNode::sort_expressions() const {
+  return {node_expressions.begin(), node_expressions.end() - 1};
+}
+
+std::shared_ptr<AbstractExpression> TopNNode::num_rows_expression() const { return node_expressions.back(); }
+
+size_t TopNNode::_on_shallow_hash() const {
+  size_t hash{0};
+  for (const auto& order_by_mode : order_by_modes) {
+    boost::hash_combine(hash, order_by_mode);
+  }
+  return hash;
+}
+
+std::shared_ptr<AbstractLQPNode> TopNNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  return TopNNode::make(expressions_copy_and_adapt_to_different_lqp(sort_expressions(), node_mapping), order_by_modes,
+                        expression_copy_and_adapt_to_different_lqp(*num_rows_expression(), node_mapping));
+}
+
+bool TopNNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& top_n_node = static_cast<const TopNNode&>(rhs);
+
+  return expressions_equal_to_expressions_in_different_lqp(node_expressions, top_n_node.node_expressions,
+                                                           node_mapping) &&
+         order_by_modes == top_n_node.order_by_modes;
+}
+
+}  // namespace opossum
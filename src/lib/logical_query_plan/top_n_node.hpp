@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * This node type represents an ORDER BY clause combined with a LIMIT clause, i.e., it returns the first rows of its
+ * input according to the sort expressions. TopNNodes are not created by the SQLTranslator, but by the
+ * SortLimitFusionRule, which replaces a LimitNode on top of a SortNode.
+ *
+ * The node_expressions hold the sort expressions followed by the num_rows_expression.
+ */
+class TopNNode : public EnableMakeForLQPNode<TopNNode>, public AbstractLQPNode {
+ public:
+  TopNNode(const std::vector<std::shared_ptr<AbstractExpression>>& sort_expressions,
+           const std::vector<OrderByMode>& init_order_by_modes,
+           const std::shared_ptr<AbstractExpression>& num_rows_expression);
+
+  std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
+
+  std::vector<std::shared_ptr<AbstractExpression>> sort_expressions() const;
+  std::shared_ptr<AbstractExpression> num_rows_expression() const;
+
+  const std::vector<OrderByMode> order_by_modes;
+
+ protected:
+  size_t _on_shallow_hash() const override;
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#include "memory_budget.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryBudget::MemoryBudget(const size_t limit, const std::shared_ptr<MemoryBudget>& parent)
+    : _limit(limit), _parent(parent) {}
+
+bool MemoryBudget::try_reserve(const size_t bytes) {
+  const auto limit = _limit.load();
+  auto reserved_bytes = _reserved_bytes.load();
+  do {
+    if (bytes > limit || reserved_bytes > limit - bytes) return false;
+  } while (!_reserved_bytes.compare_exchange_weak(reserved_bytes, reserved_bytes + bytes));
+
+  if (_parent && !_parent->try_reserve(bytes)) {
+    _reserved_bytes -= bytes;
+    return false;
+  }
+
+  return true;
+}
+
+void MemoryBudget::release(const size_t bytes) {
+  DebugAssert(_reserved_bytes >= bytes, "Cannot release more bytes than were reserved");
+  _reserved_bytes -= bytes;
+  if (_parent) _parent->release(bytes);
+}
+
+size_t MemoryBudget::limit() const { return _limit; }
+
+void MemoryBudget::set_limit(const size_t limit) { _limit = limit; }
+
+size_t MemoryBudget::reserved_bytes() const { return _reserved_bytes; }
+
+size_t MemoryBudget::available_bytes() const {
+  const auto limit = _limit.load();
+  const auto reserved_bytes = _reserved_bytes.load();
+  const auto available_bytes = reserved_bytes < limit ? limit - reserved_bytes : size_t{0};
+  return _parent ? std::min(available_bytes, _parent->available_bytes()) : available_bytes;
+}
+
+MemoryReservation::MemoryReservation(const std::shared_ptr<MemoryBudget>& budget, const size_t bytes)
+    : _budget(budget), _bytes(bytes) {}
+
+MemoryReservation::MemoryReservation(MemoryReservation&& other) noexcept
+    : _budget(std::move(other._budget)), _bytes(std::exchange(other._bytes, 0)) {}
+
+MemoryReservation& MemoryReservation::operator=(MemoryReservation&& other) noexcept {
+  if (this != &other) {
+    if (_budget) _budget->release(_bytes);
+    _budget = std::move(other._budget);
+    _bytes = std::exchange(other._bytes, 0);
+  }
+  return *this;
+}
+
+MemoryReservation::~MemoryReservation() {
+  if (_budget) _budget->release(_bytes);
+}
+
+MemoryReservation MemoryReservation::try_reserve(const std::shared_ptr<MemoryBudget>& budget, const size_t bytes) {
+  if (!budget->try_reserve(bytes)) return MemoryReservation{};
+  return MemoryReservation{budget, bytes};
+}
+
+bool MemoryReservation::is_granted() const { return static_cast<bool>(_budget); }
+
+size_t MemoryReservation::bytes() const { return _bytes; }
+
+}  // namespace opossum
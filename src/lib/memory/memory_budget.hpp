@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Limits the memory that operators use for their intermediate data structures, e.g., the materialized columns and
+ * hash tables of JoinHash. Operators reserve memory before they allocate it and release it once it has been freed.
+ * If a reservation would exceed the limit, it is not granted and the operator has to fall back to an algorithm that
+ * needs less memory (e.g., JoinHash spills its radix partitions to disk) instead of running out of memory.
+ *
+ * Budgets form a hierarchy: Hyrise::memory_budget limits the memory of all queries together and each SQLPipeline
+ * statement gets a budget of its own (see SQLPipelineBuilder::with_memory_limit()) whose reservations also count
+ * towards the global budget. Both are unlimited by default.
+ */
+class MemoryBudget : private Noncopyable {
+ public:
+  static constexpr auto UNLIMITED = std::numeric_limits<size_t>::max();
+
+  explicit MemoryBudget(const size_t limit = UNLIMITED, const std::shared_ptr<MemoryBudget>& parent = nullptr);
+
+  // Reserves bytes in this budget and all of its ancestors. Returns false (and reserves nothing) if any of them would
+  // exceed its limit.
+  bool try_reserve(const size_t bytes);
+
+  // Releases bytes that were reserved before
+  void release(const size_t bytes);
+
+  size_t limit() const;
+  void set_limit(const size_t limit);
+
+  size_t reserved_bytes() const;
+
+  // Number of bytes that can still be reserved, considering the ancestors as well
+  size_t available_bytes() const;
+
+ private:
+  std::atomic<size_t> _limit;
+  std::atomic<size_t> _reserved_bytes{0};
+  const std::shared_ptr<MemoryBudget> _parent;
+};
+
+/**
+ * Reservation in a MemoryBudget that is released when the object is destroyed
+ */
+class MemoryReservation {
+ public:
+  MemoryReservation() = default;
+
+  MemoryReservation(const MemoryReservation&) = delete;
+  MemoryReservation& operator=(const MemoryReservation&) = delete;
+  MemoryReservation(MemoryReservation&& other) noexcept;
+  MemoryReservation& operator=(MemoryReservation&& other) noexcept;
+
+  ~MemoryReservation();
+
+  // Returns an empty reservation if the budget cannot grant the requested bytes
+  static MemoryReservation try_reserve(const std::shared_ptr<MemoryBudget>& budget, const size_t bytes);
+
+  bool is_granted() const;
+  size_t bytes() const;
+
+ private:
+  MemoryReservation(const std::shared_ptr<MemoryBudget>& budget, const size_t bytes);
+
+  std::shared_ptr<MemoryBudget> _budget;
+  size_t _bytes{0};
+};
+
+}  // namespace opossum
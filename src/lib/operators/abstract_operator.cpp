@@ -7,6 +7,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/base_non_query_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
 #include "storage/table.hpp"
@@ -126,6 +127,11 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
   return _deep_copy_impl(copied_ops);
 }
 
+std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy(
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return _deep_copy_impl(copied_ops);
+}
+
 std::shared_ptr<const Table> AbstractOperator::input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::input_table_right() const { return _input_right->get_output(); }
@@ -151,6 +157,21 @@ void AbstractOperator::set_transaction_context_recursively(
   if (_input_right) mutable_input_right()->set_transaction_context_recursively(transaction_context);
 }
 
+std::shared_ptr<MemoryBudget> AbstractOperator::memory_budget() const {
+  return _memory_budget ? _memory_budget : Hyrise::get().memory_budget;
+}
+
+void AbstractOperator::set_memory_budget(const std::shared_ptr<MemoryBudget>& memory_budget) {
+  _memory_budget = memory_budget;
+}
+
+void AbstractOperator::set_memory_budget_recursively(const std::shared_ptr<MemoryBudget>& memory_budget) {
+  set_memory_budget(memory_budget);
+
+  if (_input_left) mutable_input_left()->set_memory_budget_recursively(memory_budget);
+  if (_input_right) mutable_input_right()->set_memory_budget_recursively(memory_budget);
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_left() const {
   return std::const_pointer_cast<AbstractOperator>(_input_left);
 }
@@ -187,6 +208,7 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
 
   const auto copied_op = _on_deep_copy(copied_input_left, copied_input_right);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  if (_memory_budget) copied_op->set_memory_budget(_memory_budget);
 
   copied_ops.emplace(this, copied_op);
 
@@ -11,6 +11,7 @@
 
 namespace opossum {
 
+class MemoryBudget;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -32,12 +33,14 @@ enum class OperatorType {
   JoinSortMerge,
   JoinVerification,
   Limit,
+  MorselPipeline,
   Print,
   Product,
   Projection,
   Sort,
   TableScan,
   TableWrapper,
+  TopN,
   UnionAll,
   UnionPositions,
   Update,
@@ -99,11 +102,24 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  // Returns the budget that limits the memory of the operator's intermediate data structures. Unless a budget was set
+  // (e.g., the per-query budget of an SQLPipelineStatement), this is the global Hyrise::memory_budget.
+  std::shared_ptr<MemoryBudget> memory_budget() const;
+  void set_memory_budget(const std::shared_ptr<MemoryBudget>& memory_budget);
+
+  // Calls set_memory_budget on itself and both input operators recursively
+  void set_memory_budget_recursively(const std::shared_ptr<MemoryBudget>& memory_budget);
+
   // Returns a new instance of the same operator with the same configuration.
   // Recursively copies the input operators.
   // An operator needs to implement this method in order to be cacheable.
   std::shared_ptr<AbstractOperator> deep_copy() const;
 
+  // Same as deep_copy(), but operators that are found in @param copied_ops are not copied but replaced by the mapped
+  // operator. Used to copy a PQP onto different inputs.
+  std::shared_ptr<AbstractOperator> deep_copy(
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
@@ -127,6 +143,9 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   std::shared_ptr<const AbstractLQPNode> lqp_node;
 
  protected:
+  // Sets the parameters of its stages, which are not inputs of the pipeline
+  friend class MorselPipeline;
+
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
   // asynchronous execution
@@ -166,6 +185,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  std::shared_ptr<MemoryBudget> _memory_budget;
+
   const std::unique_ptr<OperatorPerformanceData> _performance_data;
 };
 
@@ -42,6 +42,12 @@ void AbstractReadWriteOperator::commit_records(const CommitID commit_id) {
   _state = ReadWriteOperatorState::Committed;
 }
 
+void AbstractReadWriteOperator::log_records(TransactionLogWriter& log_writer) const {
+  Assert(_state == ReadWriteOperatorState::Committed, "Operator needs to have state Committed in order to be logged.");
+
+  _on_log_records(log_writer);
+}
+
 void AbstractReadWriteOperator::rollback_records() {
   Assert(_state == ReadWriteOperatorState::Failed || _state == ReadWriteOperatorState::Executed,
          "Operator needs to have state Failed or Executed in order to be rolled back.");
@@ -57,6 +63,8 @@ bool AbstractReadWriteOperator::execute_failed() const {
 
 ReadWriteOperatorState AbstractReadWriteOperator::state() const { return _state; }
 
+void AbstractReadWriteOperator::_on_log_records(TransactionLogWriter& log_writer) const {}
+
 void AbstractReadWriteOperator::_mark_as_failed() {
   Assert(_state == ReadWriteOperatorState::Pending, "Operator can only be marked as failed if pending.");
 
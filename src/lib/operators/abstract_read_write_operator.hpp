@@ -13,6 +13,8 @@
 
 namespace opossum {
 
+class TransactionLogWriter;
+
 enum class ReadWriteOperatorState {
   Pending,     // The operator has been instantiated.
   Executed,    // Execution succeeded.
@@ -41,6 +43,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void commit_records(const CommitID commit_id);
 
+  /**
+   * Adds the log records that describe the committed modifications to the log entry of the transaction. Only called if
+   * logging is enabled (see LogManager).
+   */
+  void log_records(TransactionLogWriter& log_writer) const;
+
   /**
    * Rolls back the operator by unlocking all modified rows. No other action is necessary since commit_records should
    * have never been called and the modifications were not made visible in the first place.
@@ -75,6 +83,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_commit_records(const CommitID commit_id) = 0;
 
+  /**
+   * Called by log_records. Operators that do not modify tables themselves, but use other read/write operators (e.g.,
+   * Update), do not need to log anything, as these operators are registered with the transaction context as well.
+   */
+  virtual void _on_log_records(TransactionLogWriter& log_writer) const;
+
   /**
    * Called by rollback_records.
    */
@@ -1,5 +1,6 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <optional>
@@ -14,11 +15,18 @@
 #include "constant_mappings.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
+#include "join_hash/join_hash_steps.hpp"
+#include "memory/memory_budget.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "table_wrapper.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -26,6 +34,44 @@
 namespace {
 using namespace opossum;  // NOLINT
 
+// Inputs smaller than this are aggregated by a single task, as the overhead of pre-aggregating morsels and merging
+// their results outweighs the benefit of parallelism (see AggregateHash::_aggregate_parallel).
+constexpr auto MIN_ROWS_FOR_PARALLEL_AGGREGATION = size_t{10'000};
+
+// Upper bound for the number of partitions that are spilled if the aggregation does not fit into its memory budget
+constexpr auto MAX_GRACE_RADIX_BITS = size_t{12};
+
+// Creates a table that contains the given rows of the input table. Rows of a reference table are resolved to the rows
+// that they reference.
+std::shared_ptr<Table> reference_rows(const std::shared_ptr<const Table>& table,
+                                      const std::shared_ptr<RowIDPosList>& pos_list) {
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    if (table->type() == TableType::Data) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+      continue;
+    }
+
+    auto referenced_pos_list = std::make_shared<RowIDPosList>(pos_list->size());
+    for (auto row_idx = size_t{0}; row_idx < pos_list->size(); ++row_idx) {
+      const auto& row_id = (*pos_list)[row_idx];
+      const auto& reference_segment =
+          static_cast<const ReferenceSegment&>(*table->get_chunk(row_id.chunk_id)->get_segment(column_id));
+      (*referenced_pos_list)[row_idx] = (*reference_segment.pos_list())[row_id.chunk_offset];
+    }
+
+    // All segments of a column reference the same table
+    const auto& reference_segment =
+        static_cast<const ReferenceSegment&>(*table->get_chunk(ChunkID{0})->get_segment(column_id));
+    segments.emplace_back(std::make_shared<ReferenceSegment>(
+        reference_segment.referenced_table(), reference_segment.referenced_column_id(), referenced_pos_list));
+  }
+
+  auto output_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  output_table->append_chunk(segments);
+  return output_table;
+}
+
 // Given an AggregateKey key, and a RowId row_id where this AggregateKey was encountered, this first checks if the
 // AggregateKey was seen before. If not, a new aggregate result is inserted into results and connected to the row id.
 // This is important so that we can reconstruct the original values later. In any case, a reference to the result is
@@ -73,6 +119,71 @@ const AggregateKey& get_aggregate_key([[maybe_unused]] const KeysPerChunk<Aggreg
   }
 }
 
+// Combines two partial results of the same group, e.g., the results of two morsels. The merged result is stored in
+// target_result.
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+void merge_aggregate_result(AggregateResult<ColumnDataType, AggregateType>& target_result,
+                            const AggregateResult<ColumnDataType, AggregateType>& source_result) {
+  auto& target_primary_aggregate = target_result.current_primary_aggregate;
+  const auto& source_primary_aggregate = source_result.current_primary_aggregate;
+
+  if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max ||
+                function == AggregateFunction::Sum || function == AggregateFunction::Avg ||
+                function == AggregateFunction::Any) {
+    if (source_primary_aggregate) {
+      if (!target_primary_aggregate) {
+        target_primary_aggregate = source_primary_aggregate;
+      } else if constexpr (function == AggregateFunction::Min) {
+        if (value_smaller(*source_primary_aggregate, *target_primary_aggregate)) {
+          target_primary_aggregate = source_primary_aggregate;
+        }
+      } else if constexpr (function == AggregateFunction::Max) {
+        if (value_greater(*source_primary_aggregate, *target_primary_aggregate)) {
+          target_primary_aggregate = source_primary_aggregate;
+        }
+      } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        // Avg stores the sum as well, see AggregateFunctionBuilder
+        *target_primary_aggregate += *source_primary_aggregate;
+      }
+    }
+  } else if constexpr (function == AggregateFunction::CountDistinct) {
+    target_result.distinct_values.insert(source_result.distinct_values.begin(), source_result.distinct_values.end());
+  } else if constexpr (function == AggregateFunction::StandardDeviationSample) {
+    if constexpr (std::is_arithmetic_v<AggregateType>) {
+      // Combine count, mean, and squared_distance_from_mean (see AggregateFunctionBuilder) of both partial results
+      // using the parallel variant of Welford's algorithm by Chan et al.
+      // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+      const auto& source_aggregates = source_result.current_secondary_aggregates;
+      auto& target_aggregates = target_result.current_secondary_aggregates;
+      if (!source_aggregates.empty()) {
+        if (target_aggregates.empty()) {
+          target_aggregates = source_aggregates;
+        } else {
+          const auto target_count = target_aggregates[0];
+          const auto source_count = source_aggregates[0];
+          const auto count = target_count + source_count;
+          const auto delta = source_aggregates[1] - target_aggregates[1];
+
+          target_aggregates[0] = count;
+          target_aggregates[1] += delta * source_count / count;
+          target_aggregates[2] += source_aggregates[2] + delta * delta * target_count * source_count / count;
+        }
+
+        if (target_aggregates[0] > 1) {
+          target_primary_aggregate = std::sqrt(target_aggregates[2] / (target_aggregates[0] - 1));
+        } else {
+          target_primary_aggregate = std::nullopt;
+        }
+      }
+    } else {
+      Fail("StandardDeviationSample not available for non-arithmetic types.");
+    }
+  }
+
+  // The counters of all partial results add up. For functions that do not use the counter, it remains zero.
+  target_result.aggregate_count += source_result.aggregate_count;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -127,13 +238,14 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, Aggregat
 
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
 void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                       const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+                                       const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                       std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
-      _contexts_per_column[column_index]);
+  auto& context =
+      *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
@@ -266,6 +378,8 @@ void AggregateHash::_aggregate() {
     //     We can immediately map these into a numerical representation by reinterpreting their byte storage as an
     //     integer. The calculation is described below. Note that this is done on a per-string basis and does not
     //     require all strings in the given column to be that short.
+    // (3) For columns whose dictionary segments share a single dictionary, the value IDs are unique across chunks and
+    //     can be used directly.
 
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     jobs.reserve(_groupby_column_ids.size());
@@ -313,6 +427,24 @@ void AggregateHash::_aggregate() {
                 ++chunk_offset;
               });
             }
+          } else if (find_shared_dictionary_segment(*input_table, groupby_column_id)) {
+            // All values stem from dictionary segments that share a single dictionary (see
+            // ChunkEncoder::encode_column_with_shared_dictionary). Thus, the value IDs already identify the groups
+            // across all chunks and we neither need to look at the values nor build the id_map.
+            for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+              const auto chunk_in = input_table->get_chunk(chunk_id);
+              if (!chunk_in) continue;
+
+              const auto& segment = *chunk_in->get_segment(groupby_column_id);
+              iterate_value_ids(segment, [&](const ChunkOffset chunk_offset, const ValueID value_id) {
+                const auto id = value_id == INVALID_VALUE_ID ? AggregateKeyEntry{0u} : AggregateKeyEntry{value_id} + 1u;
+                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+                  keys_per_chunk[chunk_id][chunk_offset] = id;
+                } else {
+                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = id;
+                }
+              });
+            }
           } else {
             /*
             Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
@@ -439,178 +571,305 @@ void AggregateHash::_aggregate() {
   /*
   AGGREGATION PHASE
   */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
-
-  if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
+  const auto chunk_count = input_table->chunk_count();
+  const auto morsel_count = std::min(static_cast<size_t>(chunk_count), Hyrise::get().topology.num_cpus());
 
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
-    _contexts_per_column.push_back(context);
+  // With the ImmediateExecutionScheduler, all tasks run one after another, so that we would only pay for the merge
+  if (morsel_count > 1 && input_table->row_count() >= MIN_ROWS_FOR_PARALLEL_AGGREGATION &&
+      !std::dynamic_pointer_cast<ImmediateExecutionScheduler>(Hyrise::get().scheduler())) {
+    _aggregate_parallel<AggregateKey>(keys_per_chunk, morsel_count);
+    return;
   }
 
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
-    const auto& aggregate = _aggregates[aggregate_idx];
-
-    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-    const auto input_column_id = pqp_column.column_id;
-
-    if (input_column_id == INVALID_COLUMN_ID) {
-      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      _contexts_per_column[aggregate_idx] = context;
-      continue;
-    }
-    auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
-  }
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>();
 
   // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto chunk_in = input_table->get_chunk(chunk_id);
     if (!chunk_in) continue;
 
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
+    _aggregate_chunk<AggregateKey>(chunk_id, *chunk_in, keys_per_chunk, _contexts_per_column);
+  }
+}
+
+template <typename AggregateKey>
+void AggregateHash::_aggregate_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk, const size_t morsel_count) {
+  const auto& input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
 
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
+  // The groups are radix-partitioned by the upper bits of their (scrambled) hash value. Without GROUP BY columns, there
+  // is only a single group and thus nothing to partition.
+  auto partition_bits = size_t{0};
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    while ((size_t{1} << partition_bits) < morsel_count) ++partition_bits;
+  }
+  const auto partition_count = size_t{1} << partition_bits;
 
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
+  const auto get_partition = [partition_bits](const AggregateKey& key) -> size_t {
+    if (partition_bits == 0) return 0;
+    // Fibonacci hashing spreads the often sequential key hashes (e.g., of AggregateKeyEntry) across all partitions
+    const auto hash = static_cast<uint64_t>(std::hash<AggregateKey>{}(key)) * uint64_t{0x9E3779B97F4A7C15};
+    return static_cast<size_t>(hash >> (64 - partition_bits));
+  };
 
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
+  // For each morsel and partition, the groups of the morsel that belong to the partition, identified by their key and
+  // by their AggregateResultId in the morsel's contexts.
+  using PartitionedGroups = std::vector<std::vector<std::pair<AggregateKey, AggregateResultId>>>;
+  auto groups_per_morsel = std::vector<PartitionedGroups>(morsel_count, PartitionedGroups(partition_count));
+  auto contexts_per_morsel = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(morsel_count);
 
-      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-        // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                          RowID{chunk_id, chunk_offset});
+  /*
+  PRE-AGGREGATION PHASE
+  Each morsel of consecutive chunks is aggregated into morsel-local contexts. Afterwards, the groups of the morsel are
+  partitioned. As all contexts of a morsel have seen the same keys in the same order, the AggregateResultIds are the
+  same for all of them and we can use the ids of the first context.
+  */
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(std::max(morsel_count, partition_count));
+
+  for (auto morsel_id = size_t{0}; morsel_id < morsel_count; ++morsel_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, morsel_id]() {
+      auto& contexts = contexts_per_morsel[morsel_id];
+      contexts = _create_aggregate_contexts<AggregateKey>();
+
+      const auto begin_chunk_id = static_cast<ChunkID::base_type>(chunk_count * morsel_id / morsel_count);
+      const auto end_chunk_id = static_cast<ChunkID::base_type>(chunk_count * (morsel_id + 1) / morsel_count);
+      for (auto chunk_id = ChunkID{begin_chunk_id}; chunk_id < end_chunk_id; ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (!chunk) continue;
+
+        _aggregate_chunk<AggregateKey>(chunk_id, *chunk, keys_per_chunk, contexts);
       }
-    } else {
-      ColumnID aggregate_idx{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
-
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[aggregate_idx]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
-
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
-          } else {
-            // count occurrences for each group key
-            for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-              auto& result = get_or_add_result(result_ids, results,
-                                               get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                               RowID{chunk_id, chunk_offset});
-              ++result.aggregate_count;
+
+      auto& groups = groups_per_morsel[morsel_id];
+      if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+        groups[0].emplace_back(EmptyAggregateKey{}, AggregateResultId{0});
+      } else {
+        _resolve_aggregate_types(ColumnID{0}, [&](const auto column_data_type_t, const auto aggregate_type_t,
+                                                  const auto /* function_t */) {
+          using ColumnDataType = typename decltype(column_data_type_t)::type;
+          using AggregateType = typename decltype(aggregate_type_t)::type;
+
+          const auto& context =
+              static_cast<const AggregateContext<ColumnDataType, AggregateType, AggregateKey>&>(*contexts[0]);
+          for (const auto& [key, result_id] : *context.result_ids) {
+            groups[get_partition(key)].emplace_back(key, result_id);
+          }
+        });
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+  jobs.clear();
+
+  /*
+  MERGE PHASE
+  Each partition is merged from the groups of all morsels independently of the other partitions. For all aggregates,
+  the groups are visited in the same order, so that the AggregateResultIds stay consistent across the contexts.
+  */
+  auto contexts_per_partition = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& contexts = contexts_per_partition[partition_id];
+      contexts = _create_aggregate_contexts<AggregateKey>();
+
+      for (auto column_index = ColumnID{0}; column_index < contexts.size(); ++column_index) {
+        _resolve_aggregate_types(column_index, [&](const auto column_data_type_t, const auto aggregate_type_t,
+                                                   const auto function_t) {
+          using ColumnDataType = typename decltype(column_data_type_t)::type;
+          using AggregateType = typename decltype(aggregate_type_t)::type;
+          using Context = AggregateContext<ColumnDataType, AggregateType, AggregateKey>;
+
+          auto& target_context = static_cast<Context&>(*contexts[column_index]);
+          for (auto morsel_id = size_t{0}; morsel_id < morsel_count; ++morsel_id) {
+            const auto& source_context = static_cast<const Context&>(*contexts_per_morsel[morsel_id][column_index]);
+            // Without GROUP BY columns, morsels without any rows have no result
+            if (source_context.results.empty()) continue;
+
+            for (const auto& [key, result_id] : groups_per_morsel[morsel_id][partition_id]) {
+              const auto& source_result = source_context.results[result_id];
+              auto& target_result =
+                  get_or_add_result(*target_context.result_ids, target_context.results, key, source_result.row_id);
+              merge_aggregate_result<ColumnDataType, AggregateType, decltype(function_t)::value>(target_result,
+                                                                                                  source_result);
             }
           }
+        });
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // As every group belongs to exactly one partition, the results of the partitions can simply be concatenated
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>();
+  for (auto column_index = ColumnID{0}; column_index < _contexts_per_column.size(); ++column_index) {
+    _resolve_aggregate_types(column_index, [&](const auto column_data_type_t, const auto aggregate_type_t,
+                                               const auto /* function_t */) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+      using AggregateType = typename decltype(aggregate_type_t)::type;
+      using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+      auto& target_results = static_cast<Context&>(*_contexts_per_column[column_index]).results;
+      auto result_count = size_t{0};
+      for (const auto& partition_contexts : contexts_per_partition) {
+        result_count += static_cast<const Context&>(*partition_contexts[column_index]).results.size();
+      }
+      target_results.reserve(result_count);
 
-          ++aggregate_idx;
-          continue;
-        }
+      for (auto& partition_contexts : contexts_per_partition) {
+        auto& source_results = static_cast<Context&>(*partition_contexts[column_index]).results;
+        std::move(source_results.begin(), source_results.end(), std::back_inserter(target_results));
+      }
+    });
+  }
+}
 
-        auto base_segment = chunk_in->get_segment(input_column_id);
-        auto data_type = input_table->column_data_type(input_column_id);
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id, const Chunk& chunk,
+                                     const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
+  const auto& input_table = input_table_left();
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+  // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
+  const auto input_chunk_size = chunk.size();
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
+  if (_aggregates.empty()) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
+     *
+     * For a query like "SELECT DISTINCT * FROM A;"
+     * we would assume that all columns from A are part of 'groupby_columns',
+     * respectively any columns that were specified in the projection.
+     * The optimizer is responsible to take care of passing in the correct columns.
+     *
+     * How does this operation work?
+     * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
+     * these vectors are used as keys in the 'column_results' map.
+     *
+     * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
+     * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
+     * One could optimize here in the future.
+     *
+     * Obviously this implementation is also used for plain GroupBy's.
+     */
+
+    auto context =
+        std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
+            contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+      // Make sure the value or combination of values is added to the list of distinct value(s)
+      get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                        RowID{chunk_id, chunk_offset});
+    }
+  } else {
+    ColumnID aggregate_idx{0};
+    for (const auto& aggregate : _aggregates) {
+      /**
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+       * We then go through the keys_per_chunk map and count the occurrences of each group key.
+       * The results are saved in the regular aggregate_count variable so that we don't need a
+       * specific output logic for COUNT(*).
+       */
+
+      const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+      const auto input_column_id = pqp_column.column_id;
+
+      if (input_column_id == INVALID_COLUMN_ID) {
+        Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+        auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
+            contexts[aggregate_idx]);
 
-          switch (aggregate->aggregate_function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                         *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Any:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Any, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
+        auto& result_ids = *context->result_ids;
+        auto& results = context->results;
+
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          // Not grouped by anything, simply count the number of rows
+          results.resize(1);
+          results[0].aggregate_count += input_chunk_size;
+        } else {
+          // count occurrences for each group key
+          for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+            auto& result = get_or_add_result(result_ids, results,
+                                             get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                             RowID{chunk_id, chunk_offset});
+            ++result.aggregate_count;
           }
-        });
+        }
 
         ++aggregate_idx;
+        continue;
       }
+
+      auto base_segment = chunk.get_segment(input_column_id);
+      auto data_type = input_table->column_data_type(input_column_id);
+
+      /*
+      Invoke correct aggregator for each segment
+      */
+
+      resolve_data_type(data_type, [&, aggregate](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate->aggregate_function) {
+          case AggregateFunction::Min:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Max:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Sum:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Avg:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Count:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::CountDistinct:
+            _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::StandardDeviationSample:
+            _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Any:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Any, AggregateKey>(
+                chunk_id, aggregate_idx, *base_segment, keys_per_chunk, contexts);
+        }
+      });
+
+      ++aggregate_idx;
     }
   }
 }
 
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
+  // If the data structures of the aggregation do not fit into the memory budget, the input is partitioned and spilled
+  // instead. Without GROUP BY columns, there is only a single group, so that there is nothing to partition. The
+  // reservation is released when the aggregation is done.
+  auto memory_reservation = MemoryReservation{};
+  if (!_groupby_column_ids.empty()) {
+    memory_reservation = MemoryReservation::try_reserve(memory_budget(), _estimate_memory_usage());
+    if (!memory_reservation.is_granted()) return _on_execute_grace();
+  }
+
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
   // The reason we only have specializations up to 2 is because every specialization increases the compile time.
   // Also, we need to make sure that there are tests for at least the first case, one array case, and the fallback.
@@ -679,6 +938,152 @@ std::shared_ptr<const Table> AggregateHash::_on_execute() {
   return output;
 }
 
+size_t AggregateHash::_estimate_memory_usage() const {
+  const auto row_count = static_cast<size_t>(input_table_left()->row_count());
+
+  // AggregateKeys of more than two GROUP BY columns are vectors (see _on_execute())
+  const auto groupby_column_count = _groupby_column_ids.size();
+  auto key_bytes = groupby_column_count * sizeof(AggregateKeyEntry);
+  if (groupby_column_count > 2) key_bytes += sizeof(std::vector<AggregateKeyEntry>);
+
+  // In the worst case, every row is a group of its own. Each context stores a result and a hash map entry per group.
+  auto bytes_per_row = key_bytes;
+  const auto context_count = std::max(_aggregates.size(), size_t{1});
+  for (auto column_index = ColumnID{0}; column_index < context_count; ++column_index) {
+    _resolve_aggregate_types(column_index, [&](const auto column_data_type_t, const auto aggregate_type_t,
+                                               const auto /* function_t */) {
+      using ColumnDataType = typename decltype(column_data_type_t)::type;
+      using AggregateType = typename decltype(aggregate_type_t)::type;
+
+      bytes_per_row += sizeof(AggregateResult<ColumnDataType, AggregateType>) + key_bytes + sizeof(AggregateResultId);
+    });
+  }
+
+  return row_count * bytes_per_row;
+}
+
+std::shared_ptr<const Table> AggregateHash::_on_execute_grace() {
+  const auto& input_table = input_table_left();
+  const auto memory_budget = this->memory_budget();
+  const auto estimated_bytes = _estimate_memory_usage();
+  const auto available_bytes = memory_budget->available_bytes();
+
+  // The number of partitions is chosen so that a partition fits into the memory budget
+  auto radix_bits = size_t{1};
+  while (radix_bits < MAX_GRACE_RADIX_BITS && (estimated_bytes >> radix_bits) > available_bytes / 2) {
+    ++radix_bits;
+  }
+  const auto partition_count = size_t{1} << radix_bits;
+
+  /*
+  SPILLING PHASE
+  The RowIDs of all input rows are spilled, partitioned by the hash of their GROUP BY values. Thus, all rows of a group
+  end up in the same partition. Unlike the AggregateKeys, the hashes do not need an id_map across all chunks, so that
+  each chunk is spilled on its own.
+  */
+  auto spilled_rows = SpilledPartitions<size_t>{partition_count};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  const auto chunk_count = input_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, chunk]() {
+      auto hashes = std::vector<size_t>(chunk->size());
+      for (const auto groupby_column_id : _groupby_column_ids) {
+        resolve_data_type(input_table->column_data_type(groupby_column_id), [&](const auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          auto chunk_offset = ChunkOffset{0};
+          segment_iterate<ColumnDataType>(*chunk->get_segment(groupby_column_id), [&](const auto& position) {
+            // NULL values form a group of their own. Their hash only needs to be the same for all of them.
+            const auto hash = position.is_null() ? size_t{0} : std::hash<ColumnDataType>{}(position.value());
+            boost::hash_combine(hashes[chunk_offset], hash);
+            ++chunk_offset;
+          });
+        });
+      }
+
+      auto partition = Partition<size_t>();
+      partition.elements.resize(hashes.size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < hashes.size(); ++chunk_offset) {
+        partition.elements[chunk_offset] =
+            PartitionedElement<size_t>{RowID{chunk_id, chunk_offset}, hashes[chunk_offset]};
+      }
+      spilled_rows.append_by_radix<size_t>(partition, radix_bits);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+  jobs.clear();
+
+  /*
+  AGGREGATION PHASE
+  Each partition is read back and aggregated by an AggregateHash of its own. Its memory is reserved here, so that the
+  nested AggregateHash does not spill again. As in the grace hash join (see JoinHash), as many partitions are
+  aggregated concurrently as the memory budget allows, and a partition that does not fit into the budget on its own is
+  aggregated nonetheless.
+  */
+  const auto bytes_per_row = estimated_bytes / std::max(static_cast<size_t>(input_table->row_count()), size_t{1});
+  auto partition_outputs = std::vector<std::shared_ptr<const Table>>(partition_count);
+
+  const auto aggregate_partition = [&](const size_t partition_idx) {
+    const auto partition = spilled_rows.read<false>(partition_idx);
+    auto pos_list = std::make_shared<RowIDPosList>(partition.elements.size());
+    for (auto element_idx = size_t{0}; element_idx < partition.elements.size(); ++element_idx) {
+      (*pos_list)[element_idx] = partition.elements[element_idx].row_id;
+    }
+    // The blocks of the partition were spilled by concurrent jobs. Restoring the input order improves the locality of
+    // the accesses to the input segments.
+    std::sort(pos_list->begin(), pos_list->end());
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(reference_rows(input_table, pos_list));
+    table_wrapper->execute();
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, _aggregates, _groupby_column_ids);
+    aggregate->set_memory_budget(std::make_shared<MemoryBudget>());
+    aggregate->execute();
+    partition_outputs[partition_idx] = aggregate->get_output();
+  };
+
+  auto partition_idx = size_t{0};
+  while (partition_idx < partition_count) {
+    auto memory_reservations = std::vector<MemoryReservation>{};
+
+    while (partition_idx < partition_count) {
+      const auto partition_bytes = spilled_rows.element_count(partition_idx) * bytes_per_row;
+      auto memory_reservation = MemoryReservation::try_reserve(memory_budget, partition_bytes);
+      if (!memory_reservation.is_granted() && !jobs.empty()) break;
+
+      memory_reservations.emplace_back(std::move(memory_reservation));
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() { aggregate_partition(partition_idx); }));
+      jobs.back()->schedule();
+      ++partition_idx;
+    }
+
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+    jobs.clear();
+  }
+
+  // As every group belongs to exactly one partition, the outputs of the partitions can simply be concatenated
+  auto output = std::make_shared<Table>(partition_outputs[0]->column_definitions(), TableType::Data);
+  for (const auto& partition_output : partition_outputs) {
+    const auto output_chunk_count = partition_output->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < output_chunk_count; ++chunk_id) {
+      const auto chunk = partition_output->get_chunk(chunk_id);
+      if (chunk->size() == 0) continue;
+
+      auto segments = Segments{};
+      for (auto column_id = ColumnID{0}; column_id < partition_output->column_count(); ++column_id) {
+        segments.emplace_back(chunk->get_segment(column_id));
+      }
+      output->append_chunk(segments);
+    }
+  }
+
+  return output;
+}
+
 /*
 The following template functions write the aggregated values for the different aggregate functions.
 They are separate and templated to avoid compiler errors for invalid type/function combinations.
@@ -988,4 +1393,100 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
   return context;
 }
 
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts() const {
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+
+  if (_aggregates.empty()) {
+    /*
+    Insert a dummy context for the DISTINCT implementation.
+    That way, the contexts will always have at least one context with results.
+    This is important later on when we write the group keys into the table.
+
+    We choose int8_t for column type and aggregate type because it's small.
+    */
+    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
+    contexts.push_back(context);
+  }
+
+  /**
+   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
+   * created on. We do this before processing any chunk because there might be no Chunks in the input and
+   * _write_aggregate_output() needs these contexts anyway.
+   */
+  const auto& input_table = input_table_left();
+  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto input_column_id = pqp_column.column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
+      contexts[aggregate_idx] = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
+      continue;
+    }
+    auto data_type = input_table->column_data_type(input_column_id);
+    contexts[aggregate_idx] = _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
+  }
+
+  return contexts;
+}
+
+template <typename Functor>
+void AggregateHash::_resolve_aggregate_types(const ColumnID column_index, const Functor& functor) const {
+  if (_aggregates.empty()) {
+    // Dummy context of the DISTINCT implementation, see _create_aggregate_contexts()
+    functor(hana::type_c<DistinctColumnType>, hana::type_c<DistinctAggregateType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Any>{});
+    return;
+  }
+
+  const auto& aggregate = _aggregates[column_index];
+  const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+
+  if (input_column_id == INVALID_COLUMN_ID) {
+    // COUNT(*)
+    functor(hana::type_c<CountColumnType>, hana::type_c<CountAggregateType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+    return;
+  }
+
+  resolve_data_type(input_table_left()->column_data_type(input_column_id), [&](const auto column_data_type_t) {
+    using ColumnDataType = typename decltype(column_data_type_t)::type;
+
+    const auto call_functor = [&](const auto function_t) {
+      using AggregateType = typename AggregateTraits<ColumnDataType, decltype(function_t)::value>::AggregateType;
+      functor(column_data_type_t, hana::type_c<AggregateType>, function_t);
+    };
+
+    switch (aggregate->aggregate_function) {
+      case AggregateFunction::Min:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+        break;
+      case AggregateFunction::Max:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+        break;
+      case AggregateFunction::Sum:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+        break;
+      case AggregateFunction::Avg:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+        break;
+      case AggregateFunction::Count:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+        break;
+      case AggregateFunction::CountDistinct:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+        break;
+      case AggregateFunction::StandardDeviationSample:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::StandardDeviationSample>{});
+        break;
+      case AggregateFunction::Any:
+        call_functor(std::integral_constant<AggregateFunction, AggregateFunction::Any>{});
+    }
+  });
+}
+
 }  // namespace opossum
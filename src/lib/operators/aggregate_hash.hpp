@@ -37,6 +37,12 @@ Operator to aggregate columns by certain functions, such as min, max, sum, avera
  with value segments. As with most operators we do not guarantee a stable operation with regards to positions -
  i.e. your sorting order.
 
+For large inputs and a multi-threaded scheduler, the aggregation is parallelized (see _aggregate_parallel()):
+ (1) Morsels of consecutive chunks are pre-aggregated into morsel-local hash maps, one JobTask per morsel.
+ (2) The groups of every morsel are radix-partitioned by the hash of their AggregateKey.
+ (3) Each partition is merged from all morsels in its own JobTask. As a group belongs to exactly one partition, the
+     merged partitions can be concatenated without further synchronization.
+
 For implementation details, please check the wiki: https://github.com/hyrise/hyrise/wiki/Operators_Aggregate
 */
 
@@ -112,6 +118,23 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  template <typename AggregateKey>
+  void _aggregate_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk, const size_t morsel_count);
+
+  // Aggregates all rows of a chunk into the given contexts (one per aggregate, see _create_aggregate_contexts())
+  template <typename AggregateKey>
+  void _aggregate_chunk(const ChunkID chunk_id, const Chunk& chunk, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  // Estimates the memory of the AggregateKeys, the hash maps, and the results, assuming that every row is a group of
+  // its own
+  size_t _estimate_memory_usage() const;
+
+  // Used if the aggregation does not fit into the memory budget. The input rows are partitioned by their GROUP BY
+  // values and spilled to a temporary file (see SpilledPartitions). The partitions are then aggregated in batches that
+  // fit into the budget.
+  std::shared_ptr<const Table> _on_execute_grace();
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -128,12 +151,21 @@ class AggregateHash : public AbstractAggregateOperator {
 
   template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
                                                                    const AggregateFunction function) const;
 
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts() const;
+
+  // Calls the functor with the column type, the aggregate type, and the aggregate function (as an integral_constant)
+  // of the context that holds the results for the given aggregate
+  template <typename Functor>
+  void _resolve_aggregate_types(const ColumnID column_index, const Functor& functor) const;
+
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
 };
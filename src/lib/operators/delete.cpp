@@ -1,15 +1,46 @@
 #include "delete.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "logging/log_records.hpp"
+#include "operators/get_table.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Deletes are logged by the name of the stored table, which is not known to the referencing table. Usually, the rows
+// to delete stem from a GetTable at the bottom of the plan. Otherwise, the stored tables are searched. Returns nullopt
+// if the table is not stored (e.g., a temporary table within a plan).
+std::optional<std::string> stored_table_name(const std::shared_ptr<const AbstractOperator>& input,
+                                             const std::shared_ptr<const Table>& table) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  for (auto op = input; op; op = op->input_left()) {
+    if (const auto get_table = std::dynamic_pointer_cast<const GetTable>(op)) {
+      const auto& table_name = get_table->table_name();
+      if (storage_manager.has_table(table_name) && storage_manager.get_table(table_name) == table) return table_name;
+      break;
+    }
+  }
+
+  for (const auto& [table_name, stored_table] : storage_manager.tables()) {
+    if (stored_table == table) return table_name;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
 namespace opossum {
 
 Delete::Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op)
@@ -29,6 +60,13 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
   _transaction_id = context->transaction_id();
 
+  if (Hyrise::get().log_manager.is_enabled() && _referencing_table->chunk_count() > 0) {
+    const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(
+        _referencing_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+    _stored_table = first_segment->referenced_table();
+    _stored_table_name = stored_table_name(input_left(), _stored_table);
+  }
+
   for (ChunkID chunk_id{0}; chunk_id < _referencing_table->chunk_count(); ++chunk_id) {
     const auto chunk = _referencing_table->get_chunk(chunk_id);
 
@@ -105,6 +143,22 @@ void Delete::_on_commit_records(const CommitID commit_id) {
   }
 }
 
+void Delete::_on_log_records(TransactionLogWriter& log_writer) const {
+  // Rows of tables that are not stored cannot be recovered, so there is nothing to log
+  if (!_stored_table_name) return;
+
+  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
+       ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
+
+    Assert(referencing_segment->referenced_table() == _stored_table, "All deleted rows must belong to the same table");
+
+    log_writer.add_delete(*_stored_table_name, *referencing_segment->pos_list());
+  }
+}
+
 void Delete::_on_rollback_records() {
   for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
        ++referencing_chunk_id) {
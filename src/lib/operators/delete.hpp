@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -27,10 +28,16 @@ class Delete : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID commit_id) override;
+  void _on_log_records(TransactionLogWriter& log_writer) const override;
   void _on_rollback_records() override;
 
  private:
   TransactionID _transaction_id;
   std::shared_ptr<const Table> _referencing_table;
+
+  // Table that the deleted rows belong to and its name in the StorageManager, which is used for logging. Only
+  // determined if logging is enabled.
+  std::shared_ptr<const Table> _stored_table;
+  std::optional<std::string> _stored_table_name;
 };
 }  // namespace opossum
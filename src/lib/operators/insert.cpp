@@ -7,6 +7,7 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "logging/log_records.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/segment_iterate.hpp"
@@ -230,6 +231,13 @@ void Insert::_on_commit_records(const CommitID cid) {
   }
 }
 
+void Insert::_on_log_records(TransactionLogWriter& log_writer) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    log_writer.add_insert(_target_table_name, *_target_table, target_chunk_range.chunk_id,
+                          target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+  }
+}
+
 void Insert::_on_rollback_records() {
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
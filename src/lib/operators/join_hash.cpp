@@ -13,8 +13,10 @@
 #include "hyrise.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "memory/memory_budget.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/timer.hpp"
@@ -25,15 +27,49 @@ namespace {
 // Semi/Anti* Joins only emit tuples from the probe table
 enum class OutputColumnOrder { BuildFirstProbeSecond, ProbeFirstBuildSecond, ProbeOnly };
 
+using namespace opossum;  // NOLINT
+
+// Up to this number of equality predicates are resolved in the hash table using a composite key
+constexpr auto MAX_COMPOSITE_KEY_COLUMN_COUNT = size_t{4};
+
+// Returns the type to which the values of two columns are cast for comparison if the columns can be part of a
+// composite join key, which is not the case for strings.
+std::optional<DataType> composite_key_hashed_data_type(const DataType build_data_type, const DataType probe_data_type) {
+  auto hashed_data_type = std::optional<DataType>{};
+  resolve_data_type(build_data_type, [&](const auto build_data_type_t) {
+    using BuildColumnDataType = typename decltype(build_data_type_t)::type;
+    resolve_data_type(probe_data_type, [&](const auto probe_data_type_t) {
+      using ProbeColumnDataType = typename decltype(probe_data_type_t)::type;
+      using HashedType = typename JoinHashTraits<BuildColumnDataType, ProbeColumnDataType>::HashType;
+
+      if constexpr (std::is_arithmetic_v<HashedType>) {
+        hashed_data_type = data_type_from_type<HashedType>();
+      }
+    });
+  });
+  return hashed_data_type;
+}
+
+// Returns true if both columns are encoded with the same shared dictionary (see
+// ChunkEncoder::encode_column_with_shared_dictionary). Then, equal values have equal value IDs in both columns.
+bool columns_share_dictionary(const Table& build_table, const ColumnID build_column_id, const Table& probe_table,
+                              const ColumnID probe_column_id) {
+  const auto build_dictionary_segment = find_shared_dictionary_segment(build_table, build_column_id);
+  if (!build_dictionary_segment) return false;
+
+  const auto probe_dictionary_segment = find_shared_dictionary_segment(probe_table, probe_column_id);
+  return probe_dictionary_segment && build_dictionary_segment->shares_dictionary_with(*probe_dictionary_segment);
+}
+
 }  // namespace
 
 namespace opossum {
 
 bool JoinHash::supports(const JoinConfiguration config) {
-  // JoinHash supports only equi joins and every join mode, except FullOuter.
+  // JoinHash supports only equi joins and every join mode.
   // Secondary predicates in AntiNullAsTrue are not supported, because implementing them is cumbersome and we couldn't
   // so far determine a case/query where we'd need them.
-  return config.predicate_condition == PredicateCondition::Equals && config.join_mode != JoinMode::FullOuter &&
+  return config.predicate_condition == PredicateCondition::Equals &&
          (config.join_mode != JoinMode::AntiNullAsTrue || !config.secondary_predicates);
 }
 
@@ -126,13 +162,14 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
    *
    * JoinMode::Inner        The smaller relation becomes the build side, the bigger the probe side
    * JoinMode::Left/Right   The outer relation becomes the probe side, the inner relation becomes the build side
-   * JoinMode::FullOuter    Not supported by JoinHash
+   * JoinMode::FullOuter    As for inner joins. The unmatched rows of the build side are emitted after probing.
    * JoinMode::Semi/Anti*   The left relation becomes the build side, the right relation becomes the probe side
    */
   const auto build_hash_table_for_right_input =
       _mode == JoinMode::Left || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse ||
       _mode == JoinMode::Semi ||
-      (_mode == JoinMode::Inner && _input_left->get_output()->row_count() > _input_right->get_output()->row_count());
+      ((_mode == JoinMode::Inner || _mode == JoinMode::FullOuter) &&
+       _input_left->get_output()->row_count() > _input_right->get_output()->row_count());
 
   if (build_hash_table_for_right_input) {
     // We don't have to swap the operation itself here, because we only support the commutative Equi Join.
@@ -162,6 +199,49 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   const auto build_column_type = build_input_table->column_data_type(build_column_id);
   const auto probe_column_type = probe_input_table->column_data_type(probe_column_id);
 
+  // If there are secondary equality predicates, we join on a composite key that holds the values of all equality
+  // predicates' columns (see materialize_composite_key_input). This way, all of these predicates are resolved by the
+  // hash table lookup instead of checking them for every row that matches the primary predicate, which is expensive if
+  // the primary predicate's columns have few distinct values. Only the remaining secondary predicates are evaluated
+  // after probing. Strings are only part of composite keys if both columns share a dictionary. In that case, their
+  // value IDs are compared instead of the strings, which is why this is also done for a single string predicate.
+  auto build_key_columns = std::vector<JoinKeyColumn>{};
+  auto probe_key_columns = std::vector<JoinKeyColumn>{};
+  auto remaining_secondary_predicates = std::vector<OperatorJoinPredicate>{};
+
+  const auto add_key_columns = [&](const ColumnID build_key_column_id, const ColumnID probe_key_column_id) {
+    const auto build_key_column_type = build_input_table->column_data_type(build_key_column_id);
+    const auto probe_key_column_type = probe_input_table->column_data_type(probe_key_column_id);
+
+    if (const auto hashed_data_type = composite_key_hashed_data_type(build_key_column_type, probe_key_column_type)) {
+      build_key_columns.emplace_back(
+          JoinKeyColumn{build_key_column_id, build_key_column_type, *hashed_data_type, false});
+      probe_key_columns.emplace_back(
+          JoinKeyColumn{probe_key_column_id, probe_key_column_type, *hashed_data_type, false});
+      return true;
+    }
+
+    if (build_key_column_type == DataType::String && probe_key_column_type == DataType::String &&
+        columns_share_dictionary(*build_input_table, build_key_column_id, *probe_input_table, probe_key_column_id)) {
+      build_key_columns.emplace_back(JoinKeyColumn{build_key_column_id, DataType::String, DataType::String, true});
+      probe_key_columns.emplace_back(JoinKeyColumn{probe_key_column_id, DataType::String, DataType::String, true});
+      return true;
+    }
+
+    return false;
+  };
+
+  const auto primary_predicate_is_key = add_key_columns(build_column_id, probe_column_id);
+
+  for (const auto& predicate : adjusted_secondary_predicates) {
+    if (primary_predicate_is_key && predicate.predicate_condition == PredicateCondition::Equals &&
+        build_key_columns.size() < MAX_COMPOSITE_KEY_COLUMN_COUNT &&
+        add_key_columns(predicate.column_ids.first, predicate.column_ids.second)) {
+      continue;
+    }
+    remaining_secondary_predicates.emplace_back(predicate);
+  }
+
   // Determine output column order
   auto output_column_order = OutputColumnOrder{};
 
@@ -173,6 +253,53 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
     output_column_order = OutputColumnOrder::BuildFirstProbeSecond;
   }
 
+  const auto determine_radix_bits = [&](const auto build_data_type_t) {
+    using BuildColumnDataType = typename decltype(build_data_type_t)::type;
+    if (!_radix_bits) {
+      _radix_bits =
+          calculate_radix_bits<BuildColumnDataType>(build_input_table->row_count(), probe_input_table->row_count());
+    }
+
+    // It needs to be ensured that the build partition does not get too large, because the
+    // used offsets in the hash map might otherwise overflow. Since radix partitioning aims
+    // to avoid large build partitions, this should never happen. Nonetheless, we better
+    // assert since the effects of overflows will probably hard to debug.
+    const auto max_partition_size = std::numeric_limits<uint32_t>::max() * 0.5;
+    Assert(static_cast<size_t>(build_input_table->row_count() / std::pow(2, *_radix_bits)) < max_partition_size,
+           "Partition count too small (potential overflows in hash map offsetting).");
+  };
+
+  if (build_key_columns.size() > 1 || (primary_predicate_is_key && build_key_columns.front().uses_value_ids)) {
+    const auto create_composite_key_impl = [&](const auto key_column_count_t) -> void {
+      using CompositeKey = CompositeJoinKey<decltype(key_column_count_t)::value>;
+      determine_radix_bits(hana::type_c<CompositeKey>);
+
+      _impl = std::make_unique<JoinHashImpl<CompositeKey, CompositeKey>>(
+          *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
+          _primary_predicate.predicate_condition, output_column_order, *_radix_bits,
+          std::move(remaining_secondary_predicates), std::move(build_key_columns), std::move(probe_key_columns));
+    };
+
+    switch (build_key_columns.size()) {
+      case 1:
+        create_composite_key_impl(std::integral_constant<size_t, 1>{});
+        break;
+      case 2:
+        create_composite_key_impl(std::integral_constant<size_t, 2>{});
+        break;
+      case 3:
+        create_composite_key_impl(std::integral_constant<size_t, 3>{});
+        break;
+      case 4:
+        create_composite_key_impl(std::integral_constant<size_t, 4>{});
+        break;
+      default:
+        Fail("Unexpected number of composite key columns");
+    }
+
+    return _impl->_on_execute();
+  }
+
   resolve_data_type(build_column_type, [&](const auto build_data_type_t) {
     using BuildColumnDataType = typename decltype(build_data_type_t)::type;
     resolve_data_type(probe_column_type, [&](const auto probe_data_type_t) {
@@ -184,18 +311,7 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
           !std::is_same_v<pmr_string, BuildColumnDataType> && !std::is_same_v<pmr_string, ProbeColumnDataType>;
 
       if constexpr (BOTH_ARE_STRING || NEITHER_IS_STRING) {
-        if (!_radix_bits) {
-          _radix_bits =
-              calculate_radix_bits<BuildColumnDataType>(build_input_table->row_count(), probe_input_table->row_count());
-        }
-
-        // It needs to be ensured that the build partition does not get too large, because the
-        // used offsets in the hash map might otherwise overflow. Since radix partitioning aims
-        // to avoid large build partitions, this should never happen. Nonetheless, we better
-        // assert since the effects of overflows will probably hard to debug.
-        const auto max_partition_size = std::numeric_limits<uint32_t>::max() * 0.5;
-        Assert(static_cast<size_t>(build_input_table->row_count() / std::pow(2, *_radix_bits)) < max_partition_size,
-               "Partition count too small (potential overflows in hash map offsetting).");
+        determine_radix_bits(hana::type_c<BuildColumnDataType>);
 
         _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
             *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
@@ -219,7 +335,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
                const std::shared_ptr<const Table>& probe_input_table, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                const OutputColumnOrder output_column_order, const size_t radix_bits,
-               std::vector<OperatorJoinPredicate> secondary_predicates = {})
+               std::vector<OperatorJoinPredicate> secondary_predicates = {},
+               std::vector<JoinKeyColumn> build_key_columns = {}, std::vector<JoinKeyColumn> probe_key_columns = {})
       : _join_hash(join_hash),
         _build_input_table(build_input_table),
         _probe_input_table(probe_input_table),
@@ -228,6 +345,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         _predicate_condition(predicate_condition),
         _output_column_order(output_column_order),
         _secondary_predicates(std::move(secondary_predicates)),
+        _build_key_columns(std::move(build_key_columns)),
+        _probe_key_columns(std::move(probe_key_columns)),
         _radix_bits(radix_bits) {}
 
  protected:
@@ -241,13 +360,121 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
   const std::vector<OperatorJoinPredicate> _secondary_predicates;
 
+  // Only used for composite keys, in which case they include the columns of the primary predicate
+  const std::vector<JoinKeyColumn> _build_key_columns, _probe_key_columns;
+
   std::shared_ptr<Table> _output_table;
 
-  const size_t _radix_bits;
+  // Increased for the grace hash join, see _on_execute_grace()
+  size_t _radix_bits;
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
 
+  // Upper bound for the number of partitions of the grace hash join
+  static constexpr auto MAX_GRACE_RADIX_BITS = size_t{12};
+
+  template <typename ColumnType, bool keep_null_values>
+  RadixContainer<ColumnType> _materialize_input(
+      const std::shared_ptr<const Table>& input_table, const ColumnID column_id,
+      const std::vector<JoinKeyColumn>& key_columns, std::vector<std::vector<size_t>>& histograms,
+      JoinHashRuntimeFilter<HashedType>* const runtime_filter_to_populate,
+      const JoinHashRuntimeFilter<HashedType>* const runtime_filter_to_apply,
+      SpilledPartitions<ColumnType>* const spilled_partitions = nullptr) const {
+    if constexpr (is_composite_join_key_v<ColumnType>) {
+      return materialize_composite_key_input<ColumnType, keep_null_values>(input_table, key_columns, histograms,
+                                                                           _radix_bits, runtime_filter_to_populate,
+                                                                           runtime_filter_to_apply, spilled_partitions);
+    } else {
+      return materialize_input<ColumnType, HashedType, keep_null_values>(input_table, column_id, histograms,
+                                                                         _radix_bits, runtime_filter_to_populate,
+                                                                         runtime_filter_to_apply, spilled_partitions);
+    }
+  }
+
+  // Estimates the memory needed for the materialized (and radix partitioned) join columns and the hash tables
+  size_t _estimate_memory_usage() const {
+    const auto build_row_count = static_cast<size_t>(_build_input_table->row_count());
+    const auto probe_row_count = static_cast<size_t>(_probe_input_table->row_count());
+
+    // Radix partitioning copies the materialized columns
+    const auto copy_factor = _radix_bits > 0 ? size_t{2} : size_t{1};
+    const auto materialized_bytes = copy_factor * (build_row_count * sizeof(PartitionedElement<BuildColumnType>) +
+                                                   probe_row_count * sizeof(PartitionedElement<ProbeColumnType>));
+
+    // Each build row is stored in the hash table's offsets and position lists
+    const auto hash_table_bytes = build_row_count * (sizeof(HashedType) + sizeof(uint32_t) + sizeof(RowID));
+
+    return materialized_bytes + hash_table_bytes;
+  }
+
+  std::vector<std::optional<PosHashTable<HashedType>>> _build_hash_tables(
+      const RadixContainer<BuildColumnType>& radix_build_column, const size_t radix_bits) const {
+    // In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
+    // However, if we have secondary predicates, those might fail on that single row. In that case, we DO need all
+    // rows.
+    if (_secondary_predicates.empty() &&
+        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
+      return build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::SinglePosition, radix_bits);
+    }
+    return build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, radix_bits,
+                                              _mode == JoinMode::FullOuter);
+  }
+
+  // Probes the partitions and writes one pair of pos lists per probe partition. For full outer joins, one pair of pos
+  // lists with the unmatched build rows is appended per build partition.
+  void _probe(const RadixContainer<BuildColumnType>& radix_build_column,
+              const RadixContainer<ProbeColumnType>& radix_probe_column,
+              const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables,
+              std::vector<RowIDPosList>& build_side_pos_lists, std::vector<RowIDPosList>& probe_side_pos_lists) const {
+    /*
+    NUMA notes:
+    The workers for each radix partition P should be scheduled on the same node as the input data:
+    buildP, probeP and hash tableP.
+    */
+    switch (_mode) {
+      case JoinMode::Inner:
+        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
+                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
+                                                  _secondary_predicates);
+        break;
+
+      case JoinMode::Left:
+      case JoinMode::Right:
+      case JoinMode::FullOuter:
+        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
+                                                 probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
+                                                 _secondary_predicates);
+        break;
+
+      case JoinMode::Semi:
+        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
+                                                                     probe_side_pos_lists, *_build_input_table,
+                                                                     *_probe_input_table, _secondary_predicates);
+        break;
+
+      case JoinMode::AntiNullAsTrue:
+        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
+            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
+            _secondary_predicates);
+        break;
+
+      case JoinMode::AntiNullAsFalse:
+        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
+            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
+            _secondary_predicates);
+        break;
+
+      default:
+        Fail("JoinMode not supported by JoinHash");
+    }
+
+    if (_mode == JoinMode::FullOuter) {
+      write_unmatched_build_rows<BuildColumnType, HashedType>(radix_build_column, hash_tables, build_side_pos_lists,
+                                                              probe_side_pos_lists);
+    }
+  }
+
   std::shared_ptr<const Table> _on_execute() override {
     /**
      * Keep/Discard NULLs from build and probe columns as follows
@@ -255,16 +482,26 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
      * JoinMode::Inner              Discard NULLs from both columns
      * JoinMode::Left/Right         Discard NULLs from the build column (the inner relation), but keep them on the probe
      *                              column (the outer relation)
-     * JoinMode::FullOuter          Not supported by JoinHash
+     * JoinMode::FullOuter          Keep NULLs from both columns. NULLs on the build column are not inserted into the
+     *                              hash table, but emitted as unmatched rows after probing.
      * JoinMode::Semi               Discard NULLs from both columns
      * JoinMode::AntiNullAsFalse    Discard NULLs from the build column (the right relation), but keep them on the probe
      *                              column (the left relation)
      * JoinMode::AntiNullAsTrue     Keep NULLs from both columns
      */
 
-    const auto keep_nulls_build_column = _mode == JoinMode::AntiNullAsTrue;
+    const auto keep_nulls_build_column = _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::FullOuter;
     const auto keep_nulls_probe_column = _mode == JoinMode::Left || _mode == JoinMode::Right ||
-                                         _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse;
+                                         _mode == JoinMode::FullOuter || _mode == JoinMode::AntiNullAsTrue ||
+                                         _mode == JoinMode::AntiNullAsFalse;
+
+    // If the data structures of the join do not fit into the memory budget, a grace hash join is executed instead. The
+    // reservation is released when the join is done.
+    const auto memory_reservation =
+        MemoryReservation::try_reserve(_join_hash.memory_budget(), _estimate_memory_usage());
+    if (!memory_reservation.is_granted()) {
+      return _on_execute_grace(keep_nulls_build_column, keep_nulls_probe_column);
+    }
 
     // Containers used to store histograms for (potentially subsequent) radix
     // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
@@ -284,17 +521,29 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     // HashTables for the build column, one for each partition
     std::vector<std::optional<PosHashTable<HashedType>>> hash_tables;
 
+    // For inner and semi joins, probe rows without a join partner are not part of the result. If the build side is
+    // smaller than the probe side, a runtime filter is created from the build side and used to discard such rows (and,
+    // if possible, entire chunks) while materializing the probe side (see JoinHashRuntimeFilter). It is only applied
+    // to the probe chunks that are materialized after the build side and switches itself off if it turns out not to be
+    // selective. All other modes need to emit probe rows without a join partner.
+    auto runtime_filter = std::unique_ptr<JoinHashRuntimeFilter<HashedType>>{};
+    if ((_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+        _build_input_table->row_count() < _probe_input_table->row_count()) {
+      runtime_filter = std::make_unique<JoinHashRuntimeFilter<HashedType>>(_build_input_table->row_count());
+    }
+
     // Depiction of the hash join parallelization (radix partitioning can be skipped when radix_bits = 0)
     // ===============================================================================================
     // We have two data paths, one for build side and one for probe input side. We can prepare (i.e.,
     // materialize(), build(), etc.) both sides in parallel until the actual join takes place.
     // All tasks might spawn concurrent tasks themselves. For example, materialize parallelizes over
-    // the input chunks and the following steps over the radix clusters.
+    // the input chunks and the following steps over the radix clusters. If a runtime filter is used, the
+    // probe chunks that are materialized after the build side has been materialized are filtered.
     //
     //           Build Relation                       Probe Relation
     //                 |                                    |
-    //        materialize_input()                  materialize_input()
-    //                 |                                    |
+    //        materialize_input()  - - - - - - - > materialize_input()
+    //                 |           (runtime filter)         |
     //      ( partition_by_radix() )            ( partition_by_radix() )
     //                 |                                    |
     //               build()                                |
@@ -308,17 +557,23 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
     /**
-     * 1.1 Schedule a JobTask for materialization, optional radix partitioning and hash table building for the build side
+     * 1.1 Materialization, optional radix partitioning and hash table building for the build side
      */
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+    const auto materialize_build_side = [&]() {
       if (keep_nulls_build_column) {
-        materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits);
+        materialized_build_column = _materialize_input<BuildColumnType, true>(
+            _build_input_table, _column_ids.first, _build_key_columns, histograms_build_column, runtime_filter.get(),
+            nullptr);
       } else {
-        materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits);
+        materialized_build_column = _materialize_input<BuildColumnType, false>(
+            _build_input_table, _column_ids.first, _build_key_columns, histograms_build_column, runtime_filter.get(),
+            nullptr);
       }
 
+      if (runtime_filter) runtime_filter->mark_complete();
+    };
+
+    const auto partition_and_build_build_side = [&]() {
       if (_radix_bits > 0) {
         // radix partition the build table
         if (keep_nulls_build_column) {
@@ -335,31 +590,22 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         radix_build_column = std::move(materialized_build_column);
       }
 
-      // Build hash tables. In the case of semi or anti joins, we do not need to track all rows on the hashed side,
-      // just one per value. However, if we have secondary predicates, those might fail on that single row. In that
-      // case, we DO need all rows.
-      if (_secondary_predicates.empty() &&
-          (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
-        hash_tables =
-            build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::SinglePosition, _radix_bits);
-      } else {
-        hash_tables =
-            build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits);
-      }
-    }));
-    jobs.back()->schedule();
+      hash_tables = _build_hash_tables(radix_build_column, _radix_bits);
+    };
 
     /**
-     * 1.2 Schedule a JobTask for materialization, optional radix partitioning for the probe side
+     * 1.2 Materialization and optional radix partitioning for the probe side
      */
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+    const auto materialize_and_partition_probe_side = [&]() {
       // Materialize probe column.
       if (keep_nulls_probe_column) {
-        materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
-            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits);
+        materialized_probe_column = _materialize_input<ProbeColumnType, true>(
+            _probe_input_table, _column_ids.second, _probe_key_columns, histograms_probe_column, nullptr,
+            runtime_filter.get());
       } else {
-        materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
-            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits);
+        materialized_probe_column = _materialize_input<ProbeColumnType, false>(
+            _probe_input_table, _column_ids.second, _probe_key_columns, histograms_probe_column, nullptr,
+            runtime_filter.get());
       }
 
       if (_radix_bits > 0) {
@@ -377,9 +623,17 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         // short cut: skip radix partitioning and use materialized data directly
         radix_probe_column = std::move(materialized_probe_column);
       }
+    };
+
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      materialize_build_side();
+      partition_and_build_build_side();
     }));
     jobs.back()->schedule();
 
+    jobs.emplace_back(std::make_shared<JobTask>(materialize_and_partition_probe_side));
+    jobs.back()->schedule();
+
     Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
     // Short cut for AntiNullAsTrue
@@ -414,46 +668,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       probe_side_pos_lists[i].reserve(result_rows_per_partition);
     }
 
-    /*
-    NUMA notes:
-    The workers for each radix partition P should be scheduled on the same node as the input data:
-    buildP, probeP and hash tableP.
-    */
-    switch (_mode) {
-      case JoinMode::Inner:
-        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                  _secondary_predicates);
-        break;
-
-      case JoinMode::Left:
-      case JoinMode::Right:
-        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                 probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                 _secondary_predicates);
-        break;
-
-      case JoinMode::Semi:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
-                                                                     probe_side_pos_lists, *_build_input_table,
-                                                                     *_probe_input_table, _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsTrue:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsFalse:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      default:
-        Fail("JoinMode not supported by JoinHash");
-    }
+    _probe(radix_build_column, radix_probe_column, hash_tables, build_side_pos_lists, probe_side_pos_lists);
 
     // After probing, the partitioned columns are not needed anymore.
     radix_build_column.clear();
@@ -462,7 +677,128 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     /**
      * 3. Write output Table
      */
+    return _write_output_table(build_side_pos_lists, probe_side_pos_lists);
+  }
+
+  /**
+   * Grace hash join: Both sides are materialized one after another and each materialized chunk is immediately spilled
+   * by radix to a temporary file (see SpilledPartitions). The number of partitions is chosen so that a partition fits
+   * into the memory budget. Afterwards, the partitions are read back and joined in batches that fit into the budget.
+   * For each partition, a hash table is built from its build elements and probed with its probe elements.
+   */
+  std::shared_ptr<const Table> _on_execute_grace(const bool keep_nulls_build_column,
+                                                 const bool keep_nulls_probe_column) {
+    const auto memory_budget = _join_hash.memory_budget();
+    const auto estimated_bytes = _estimate_memory_usage();
+    const auto available_bytes = memory_budget->available_bytes();
+    _radix_bits = std::max(_radix_bits, size_t{1});
+    while (_radix_bits < MAX_GRACE_RADIX_BITS && (estimated_bytes >> _radix_bits) > available_bytes / 2) {
+      ++_radix_bits;
+    }
+    const auto partition_count = size_t{1} << _radix_bits;
+
+    auto spilled_build_column = SpilledPartitions<BuildColumnType>{partition_count};
+    auto spilled_probe_column = SpilledPartitions<ProbeColumnType>{partition_count};
+
+    // The build side is spilled completely before the probe side is materialized, so that the runtime filter (see
+    // _on_execute()) is complete before the probe side is materialized.
+    auto runtime_filter = std::unique_ptr<JoinHashRuntimeFilter<HashedType>>{};
+    if ((_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+        _build_input_table->row_count() < _probe_input_table->row_count()) {
+      runtime_filter = std::make_unique<JoinHashRuntimeFilter<HashedType>>(_build_input_table->row_count());
+    }
+
+    // The histograms are only needed for partition_by_radix(), which is not used here
+    std::vector<std::vector<size_t>> histograms;
+    if (keep_nulls_build_column) {
+      _materialize_input<BuildColumnType, true>(_build_input_table, _column_ids.first, _build_key_columns, histograms,
+                                                runtime_filter.get(), nullptr, &spilled_build_column);
+    } else {
+      _materialize_input<BuildColumnType, false>(_build_input_table, _column_ids.first, _build_key_columns, histograms,
+                                                 runtime_filter.get(), nullptr, &spilled_build_column);
+    }
+    if (runtime_filter) runtime_filter->mark_complete();
+
+    histograms.clear();
+    if (keep_nulls_probe_column) {
+      _materialize_input<ProbeColumnType, true>(_probe_input_table, _column_ids.second, _probe_key_columns, histograms,
+                                                nullptr, runtime_filter.get(), &spilled_probe_column);
+    } else {
+      _materialize_input<ProbeColumnType, false>(_probe_input_table, _column_ids.second, _probe_key_columns,
+                                                 histograms, nullptr, runtime_filter.get(), &spilled_probe_column);
+    }
+    histograms.clear();
+
+    // Short cut for AntiNullAsTrue, see _on_execute()
+    if (_mode == JoinMode::AntiNullAsTrue && spilled_build_column.has_null_values()) {
+      return _join_hash._build_output_table({});
+    }
+
+    // For full outer joins, the unmatched build rows of partition p are written to the pos lists p + partition_count
+    const auto pos_list_count = _mode == JoinMode::FullOuter ? 2 * partition_count : partition_count;
+    auto build_side_pos_lists = std::vector<RowIDPosList>(pos_list_count);
+    auto probe_side_pos_lists = std::vector<RowIDPosList>(pos_list_count);
+
+    const auto join_partition = [&](const size_t partition_idx) {
+      auto radix_build_column = RadixContainer<BuildColumnType>{};
+      auto radix_probe_column = RadixContainer<ProbeColumnType>{};
+      if (keep_nulls_build_column) {
+        radix_build_column.emplace_back(spilled_build_column.template read<true>(partition_idx));
+      } else {
+        radix_build_column.emplace_back(spilled_build_column.template read<false>(partition_idx));
+      }
+      if (keep_nulls_probe_column) {
+        radix_probe_column.emplace_back(spilled_probe_column.template read<true>(partition_idx));
+      } else {
+        radix_probe_column.emplace_back(spilled_probe_column.template read<false>(partition_idx));
+      }
+
+      // The partition is joined as if it was the only radix partition. Passing radix bits ensures that no hash table
+      // is built for an empty build partition, like in the regular join.
+      const auto hash_tables = _build_hash_tables(radix_build_column, 1);
+      auto partition_build_side_pos_lists = std::vector<RowIDPosList>(1);
+      auto partition_probe_side_pos_lists = std::vector<RowIDPosList>(1);
+      _probe(radix_build_column, radix_probe_column, hash_tables, partition_build_side_pos_lists,
+             partition_probe_side_pos_lists);
+
+      build_side_pos_lists[partition_idx] = std::move(partition_build_side_pos_lists[0]);
+      probe_side_pos_lists[partition_idx] = std::move(partition_probe_side_pos_lists[0]);
+      if (_mode == JoinMode::FullOuter) {
+        build_side_pos_lists[partition_count + partition_idx] = std::move(partition_build_side_pos_lists[1]);
+        probe_side_pos_lists[partition_count + partition_idx] = std::move(partition_probe_side_pos_lists[1]);
+      }
+    };
+
+    // Join as many partitions concurrently as the memory budget allows. A partition that does not fit into the budget
+    // on its own is joined nonetheless, as there is no way to reduce its memory usage any further.
+    auto partition_idx = size_t{0};
+    while (partition_idx < partition_count) {
+      auto memory_reservations = std::vector<MemoryReservation>{};
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+      while (partition_idx < partition_count) {
+        const auto build_element_count = spilled_build_column.element_count(partition_idx);
+        const auto partition_bytes =
+            build_element_count * (sizeof(PartitionedElement<BuildColumnType>) + sizeof(HashedType) +
+                                   sizeof(uint32_t) + sizeof(RowID)) +
+            spilled_probe_column.element_count(partition_idx) * sizeof(PartitionedElement<ProbeColumnType>);
+        auto memory_reservation = MemoryReservation::try_reserve(memory_budget, partition_bytes);
+        if (!memory_reservation.is_granted() && !jobs.empty()) break;
+
+        memory_reservations.emplace_back(std::move(memory_reservation));
+        jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() { join_partition(partition_idx); }));
+        jobs.back()->schedule();
+        ++partition_idx;
+      }
+
+      Hyrise::get().scheduler()->wait_for_tasks(jobs);
+    }
+
+    return _write_output_table(build_side_pos_lists, probe_side_pos_lists);
+  }
 
+  std::shared_ptr<const Table> _write_output_table(std::vector<RowIDPosList>& build_side_pos_lists,
+                                                   std::vector<RowIDPosList>& probe_side_pos_lists) const {
     /**
      * After the probe phase build_side_pos_lists and probe_side_pos_lists contain all pairs of joined rows grouped by
      * partition. Let p be a partition index and r a row index. The value of build_side_pos_lists[p][r] will match probe_side_pos_lists[p][r].
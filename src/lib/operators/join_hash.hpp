@@ -11,6 +11,8 @@ namespace opossum {
 
 /**
  * This operator joins two tables using one column of each table.
+ * Secondary equality predicates on numerical columns are resolved together with the primary predicate by hashing a
+ * composite key of all these columns. All other secondary predicates are evaluated for each candidate match.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
  *
  * As with most operators, we do not guarantee a stable operation with regards to positions -
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Filter that the hash join creates from the values on its build side while materializing them. It is applied when
+ * materializing the probe side to discard rows that cannot find a join partner before they are partitioned and
+ * probed. For selective joins with a small build side (e.g., a filtered dimension table joined with a fact table),
+ * most of the probe side is thus never written into the radix partitions.
+ *
+ * The filter consists of a Bloom filter over the hashes of the build values and, for types that have an order, the
+ * range of the build values. The range is also compared to the pruning statistics of the probe side's chunks (the same
+ * ones used by the ChunkPruningRule), so that chunks that cannot contain a join partner are skipped entirely.
+ *
+ * Hashes and ranges can be inserted concurrently by the materialization jobs. The filter has no false negatives.
+ *
+ * The build and the probe side are still materialized concurrently. A probe chunk is only filtered if the filter was
+ * complete when its materialization started (see is_active()). As the probe side is the larger one, most of its chunks
+ * are materialized after the build side. Filtering costs a hash computation and a lookup per row, which does not pay
+ * off if most rows have a join partner. Hence, the filter also counts how many of the probed rows it discards and
+ * switches itself off once it has seen enough rows to know that it does not discard a sufficient share of them.
+ */
+template <typename HashedType>
+class JoinHashRuntimeFilter : private Noncopyable {
+ public:
+  // Composite join keys have no meaningful order, only their hashes are added to the filter
+  static constexpr auto TRACKS_RANGE = std::is_arithmetic_v<HashedType> || std::is_same_v<HashedType, pmr_string>;
+
+  explicit JoinHashRuntimeFilter(const size_t value_count) {
+    // Eight bits per value and three bits per hash result in a false positive rate of about 3% as long as the maximum
+    // size is not reached.
+    auto bit_count_log2 = MIN_BIT_COUNT_LOG2;
+    while (bit_count_log2 < MAX_BIT_COUNT_LOG2 && (size_t{1} << bit_count_log2) < value_count * 8) {
+      ++bit_count_log2;
+    }
+    _shift = 64 - bit_count_log2;
+    _bloom_filter = std::vector<std::atomic<uint64_t>>((size_t{1} << bit_count_log2) / 64);
+  }
+
+  void insert(const size_t hash) {
+    _for_each_bit(hash, [&](const size_t bit) {
+      _bloom_filter[bit / 64].fetch_or(uint64_t{1} << (bit % 64), std::memory_order_relaxed);
+    });
+  }
+
+  // Extends the range of build values, called once per materialized partition with the partition's minimum and maximum
+  void extend_range(const HashedType& min, const HashedType& max) {
+    static_assert(TRACKS_RANGE, "Range is not tracked for this type");
+    const auto lock = std::lock_guard<std::mutex>{_range_mutex};
+    if (!_range) {
+      _range.emplace(min, max);
+    } else {
+      _range->first = std::min(_range->first, min);
+      _range->second = std::max(_range->second, max);
+    }
+  }
+
+  // Called once all build values have been inserted
+  void mark_complete() { _is_complete.store(true, std::memory_order_release); }
+
+  // Returns whether the filter should be applied to the next probe chunk, i.e., whether it is complete and has not been
+  // switched off for being unselective
+  bool is_active() const {
+    return _is_complete.load(std::memory_order_acquire) && !_is_disabled.load(std::memory_order_relaxed);
+  }
+
+  // Called after the filter was applied to a probe chunk. Once enough rows have been probed, the filter is switched off
+  // if the share of rows that passed it is too high.
+  void record_probed_rows(const size_t probed_row_count, const size_t passed_row_count) const {
+    const auto total_probed_row_count = _probed_row_count.fetch_add(probed_row_count) + probed_row_count;
+    const auto total_passed_row_count = _passed_row_count.fetch_add(passed_row_count) + passed_row_count;
+    if (total_probed_row_count >= MIN_PROBED_ROW_COUNT &&
+        static_cast<double>(total_passed_row_count) > MAX_PASS_RATE * static_cast<double>(total_probed_row_count)) {
+      _is_disabled.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  // Returns false if no build value equals value. Must not be called while values are inserted.
+  bool may_contain(const HashedType& value, const size_t hash) const {
+    if constexpr (TRACKS_RANGE) {
+      if (!_range || value < _range->first || value > _range->second) return false;
+    }
+
+    auto contained = true;
+    _for_each_bit(hash, [&](const size_t bit) {
+      const auto word = _bloom_filter[bit / 64].load(std::memory_order_relaxed);
+      contained &= static_cast<bool>(word & (uint64_t{1} << (bit % 64)));
+    });
+    return contained;
+  }
+
+  // Returns false if the pruning statistics of the chunk show that none of its values in column_id is a build value.
+  // For reference tables, the statistics of the referenced chunk are used if all rows reference the same chunk.
+  template <typename ColumnDataType>
+  bool may_contain_chunk(const Chunk& chunk, const ColumnID column_id) const {
+    // Strings cannot be cast to numbers and vice versa
+    constexpr auto COMPARABLE = std::is_same_v<pmr_string, HashedType> == std::is_same_v<pmr_string, ColumnDataType>;
+
+    if constexpr (!TRACKS_RANGE || !COMPARABLE) {
+      return true;
+    } else {
+      auto pruning_statistics = chunk.pruning_statistics();
+      auto statistics_column_id = column_id;
+
+      if (const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(column_id))) {
+        const auto& pos_list = *reference_segment->pos_list();
+        if (pos_list.empty() || !pos_list.references_single_chunk()) return true;
+
+        const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id());
+        if (!referenced_chunk) return true;
+        pruning_statistics = referenced_chunk->pruning_statistics();
+        statistics_column_id = reference_segment->referenced_column_id();
+      }
+
+      if (!pruning_statistics) return true;
+      const auto& segment_statistics =
+          static_cast<const AttributeStatistics<ColumnDataType>&>(*(*pruning_statistics)[statistics_column_id]);
+
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        if (segment_statistics.range_filter) {
+          const auto& ranges = segment_statistics.range_filter->ranges;
+          return std::any_of(ranges.begin(), ranges.end(), [&](const auto& range) {
+            return _overlaps(static_cast<HashedType>(range.first), static_cast<HashedType>(range.second));
+          });
+        }
+      }
+
+      if (segment_statistics.min_max_filter) {
+        return _overlaps(static_cast<HashedType>(segment_statistics.min_max_filter->min),
+                         static_cast<HashedType>(segment_statistics.min_max_filter->max));
+      }
+
+      return true;
+    }
+  }
+
+ private:
+  static constexpr auto MIN_BIT_COUNT_LOG2 = size_t{9};
+  static constexpr auto MAX_BIT_COUNT_LOG2 = size_t{27};
+  static constexpr auto BITS_PER_HASH = size_t{3};
+
+  // The filter is switched off if more than MAX_PASS_RATE of the first MIN_PROBED_ROW_COUNT (or more) rows passed it
+  static constexpr auto MIN_PROBED_ROW_COUNT = size_t{10'000};
+  static constexpr auto MAX_PASS_RATE = 0.75;
+
+  template <typename Functor>
+  void _for_each_bit(const size_t hash, const Functor& functor) const {
+    // std::hash is the identity for integers. Fibonacci hashing spreads such hashes over the filter. The bits are
+    // derived from the result by double hashing.
+    const auto hash_1 = static_cast<uint64_t>(hash) * uint64_t{0x9E3779B97F4A7C15};
+    const auto hash_2 = ((hash_1 << 32) | (hash_1 >> 32)) | uint64_t{1};
+    for (auto hash_idx = uint64_t{0}; hash_idx < BITS_PER_HASH; ++hash_idx) {
+      functor(static_cast<size_t>((hash_1 + hash_idx * hash_2) >> _shift));
+    }
+  }
+
+  bool _overlaps(const HashedType& min, const HashedType& max) const {
+    return _range && !(max < _range->first) && !(_range->second < min);
+  }
+
+  std::vector<std::atomic<uint64_t>> _bloom_filter;
+  size_t _shift{0};
+
+  std::mutex _range_mutex;
+  std::optional<std::pair<HashedType, HashedType>> _range;
+
+  std::atomic_bool _is_complete{false};
+
+  // Updated while the filter is applied
+  mutable std::atomic<size_t> _probed_row_count{0};
+  mutable std::atomic<size_t> _passed_row_count{0};
+  mutable std::atomic_bool _is_disabled{false};
+};
+
+}  // namespace opossum
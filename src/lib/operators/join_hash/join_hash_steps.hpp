@@ -1,16 +1,30 @@
 #pragma once
 
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+
 #include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
 #include <uninitialized_vector.hpp>
 
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
+#include "operators/join_hash/join_hash_runtime_filter.hpp"
+#include "operators/join_hash/join_hash_traits.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 
@@ -157,6 +171,44 @@ class PosHashTable {
     }
   }
 
+  // Full outer joins need to emit the build rows that did not find a join partner. To find these rows, a bit is
+  // reserved for every row of the hash table. It is set by mark_as_matched() while probing. As the same hash table is
+  // probed concurrently if no radix partitioning is used, the bits are set atomically. Must be called after
+  // shrink_to_fit().
+  void enable_match_tracking() {
+    DebugAssert(_mode == JoinHashBuildMode::AllPositions, "Matches can only be tracked for AllPositions");
+
+    // The rows of the pos list at offset o are represented by the bits starting at _first_row_indices[o]
+    _first_row_indices.resize(_pos_lists.size() + 1);
+    for (auto offset = size_t{0}; offset < _pos_lists.size(); ++offset) {
+      _first_row_indices[offset + 1] = _first_row_indices[offset] + _pos_lists[offset].size();
+    }
+    _matched_rows = std::vector<std::atomic<uint64_t>>((_first_row_indices.back() + 63) / 64);
+  }
+
+  // Marks the index_in_pos_list-th row of the pos list returned by find() as matched
+  void mark_as_matched(const std::vector<SmallPosList>::const_iterator pos_list_iter,
+                       const size_t index_in_pos_list) const {
+    DebugAssert(!_first_row_indices.empty(), "Match tracking is not enabled");
+    const auto row_index = _first_row_indices[std::distance(_pos_lists.begin(), pos_list_iter)] + index_in_pos_list;
+    _matched_rows[row_index / 64].fetch_or(uint64_t{1} << (row_index % 64), std::memory_order_relaxed);
+  }
+
+  // Calls functor for the RowID of every row that was not marked as matched. Must not run concurrently to probing.
+  template <typename Functor>
+  void for_each_unmatched_row(const Functor& functor) const {
+    DebugAssert(!_first_row_indices.empty(), "Match tracking is not enabled");
+    for (auto offset = size_t{0}; offset < _pos_lists.size(); ++offset) {
+      const auto& pos_list = _pos_lists[offset];
+      for (auto index_in_pos_list = size_t{0}; index_in_pos_list < pos_list.size(); ++index_in_pos_list) {
+        const auto row_index = _first_row_indices[offset] + index_in_pos_list;
+        if (!(_matched_rows[row_index / 64].load(std::memory_order_relaxed) & (uint64_t{1} << (row_index % 64)))) {
+          functor(pos_list[index_in_pos_list]);
+        }
+      }
+    }
+  }
+
   // For a value seen on the probe side, return whether it has been seen on the build side
   template <typename InputType>
   bool contains(const InputType& value) const {
@@ -180,11 +232,196 @@ class PosHashTable {
   std::vector<SmallPosList> _pos_lists;
   JoinHashBuildMode _mode;
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
+
+  // Only used if match tracking is enabled, see enable_match_tracking()
+  std::vector<size_t> _first_row_indices;
+  mutable std::vector<std::atomic<uint64_t>> _matched_rows;
+};
+
+/*
+Stores the radix partitions of one side of a grace hash join in a temporary file. If the materialized join columns do
+not fit into the MemoryBudget of the JoinHash, each materialized chunk is split by radix and appended to this file
+instead of being kept in memory (see materialize_input()). Afterwards, the partitions are read back and joined one by
+one, so that only a few partitions have to be in memory at the same time. AggregateHash uses the same mechanism to
+spill its input rows, partitioned by their GROUP BY values (see AggregateHash::_on_execute_grace()).
+
+The file consists of blocks, each holding elements of a single partition that were appended together. For every
+partition, the positions of its blocks are kept in memory. Appending and reading is thread-safe.
+*/
+template <typename T>
+class SpilledPartitions : private Noncopyable {
+ public:
+  explicit SpilledPartitions(const size_t partition_count) : _blocks(partition_count) {
+    auto file_path_template = (std::filesystem::temp_directory_path() / "hyrise_spill_XXXXXX").string();
+    _file_descriptor = mkstemp(file_path_template.data());
+    Assert(_file_descriptor >= 0, "Could not create a temporary file to spill to");
+
+    // The file is only accessed through the descriptor returned by mkstemp, so that it cannot be replaced by another
+    // file of the same name. Unlinking it right away removes it once the descriptor is closed, even if the process
+    // terminates before the destructor runs.
+    unlink(file_path_template.c_str());
+  }
+
+  ~SpilledPartitions() { close(_file_descriptor); }
+
+  size_t partition_count() const { return _blocks.size(); }
+
+  // Splits a materialized chunk by the radix of its values and appends the elements to their partitions
+  template <typename HashedType>
+  void append_by_radix(const Partition<T>& partition, const size_t radix_bits) {
+    const std::hash<HashedType> hash_function;
+    const auto radix_mask = (size_t{1} << radix_bits) - 1;
+    DebugAssert((radix_mask + 1) == _blocks.size(), "Radix bits do not match the partition count");
+
+    auto buffers = std::vector<std::vector<char>>(_blocks.size());
+    auto element_counts = std::vector<size_t>(_blocks.size());
+    for (auto element_idx = size_t{0}; element_idx < partition.elements.size(); ++element_idx) {
+      const auto& element = partition.elements[element_idx];
+      const auto is_null = !partition.null_values.empty() && partition.null_values[element_idx];
+      const auto radix = hash_function(static_cast<HashedType>(element.value)) & radix_mask;
+      _serialize(buffers[radix], element, is_null);
+      ++element_counts[radix];
+      if (is_null) _has_null_values = true;
+    }
+
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    for (auto partition_idx = size_t{0}; partition_idx < _blocks.size(); ++partition_idx) {
+      if (buffers[partition_idx].empty()) continue;
+      _blocks[partition_idx].push_back({_file_size, buffers[partition_idx].size(), element_counts[partition_idx]});
+      _write_at(buffers[partition_idx].data(), buffers[partition_idx].size(), _file_size);
+      _file_size += buffers[partition_idx].size();
+    }
+  }
+
+  // Reads a partition back. NULL flags are only restored if keep_null_values is set.
+  template <bool keep_null_values>
+  Partition<T> read(const size_t partition_idx) {
+    auto partition = Partition<T>();
+    partition.elements.resize(element_count(partition_idx));
+    if constexpr (keep_null_values) {
+      partition.null_values.resize(partition.elements.size());
+    }
+
+    auto buffer = std::vector<char>{};
+    auto element_idx = size_t{0};
+    for (const auto& block : _blocks[partition_idx]) {
+      buffer.resize(block.byte_count);
+      _read_at(buffer.data(), block.byte_count, block.offset);
+
+      const auto* position = buffer.data();
+      for (auto block_element_idx = size_t{0}; block_element_idx < block.element_count; ++block_element_idx) {
+        const auto is_null = _deserialize(position, partition.elements[element_idx]);
+        if constexpr (keep_null_values) {
+          partition.null_values[element_idx] = is_null;
+        }
+        ++element_idx;
+      }
+    }
+
+    return partition;
+  }
+
+  size_t element_count(const size_t partition_idx) const {
+    auto element_count = size_t{0};
+    for (const auto& block : _blocks[partition_idx]) {
+      element_count += block.element_count;
+    }
+    return element_count;
+  }
+
+  bool has_null_values() const { return _has_null_values; }
+
+ private:
+  struct Block {
+    size_t offset;
+    size_t byte_count;
+    size_t element_count;
+  };
+
+  // pwrite() and pread() do not use the descriptor's file position, so that partitions can be read concurrently. Both
+  // may transfer fewer bytes than requested and are repeated until all bytes are transferred.
+  void _write_at(const char* data, size_t byte_count, size_t offset) const {
+    while (byte_count > 0) {
+      const auto written_bytes = pwrite(_file_descriptor, data, byte_count, static_cast<off_t>(offset));
+      if (written_bytes < 0 && errno == EINTR) continue;
+      Assert(written_bytes > 0, "Could not write to the spill file");
+      data += written_bytes;
+      byte_count -= static_cast<size_t>(written_bytes);
+      offset += static_cast<size_t>(written_bytes);
+    }
+  }
+
+  void _read_at(char* data, size_t byte_count, size_t offset) const {
+    while (byte_count > 0) {
+      const auto read_bytes = pread(_file_descriptor, data, byte_count, static_cast<off_t>(offset));
+      if (read_bytes < 0 && errno == EINTR) continue;
+      Assert(read_bytes > 0, "Could not read from the spill file");
+      data += read_bytes;
+      byte_count -= static_cast<size_t>(read_bytes);
+      offset += static_cast<size_t>(read_bytes);
+    }
+  }
+
+  template <typename Value>
+  static void _write(std::vector<char>& buffer, const Value& value) {
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(Value));
+  }
+
+  template <typename Value>
+  static void _read(const char*& position, Value& value) {
+    std::memcpy(&value, position, sizeof(Value));
+    position += sizeof(Value);
+  }
+
+  static void _serialize(std::vector<char>& buffer, const PartitionedElement<T>& element, const bool is_null) {
+    _write(buffer, element.row_id);
+    _write(buffer, static_cast<uint8_t>(is_null));
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      _write(buffer, element.value.size());
+      buffer.insert(buffer.end(), element.value.begin(), element.value.end());
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Values are spilled by copying their bytes");
+      _write(buffer, element.value);
+    }
+  }
+
+  static bool _deserialize(const char*& position, PartitionedElement<T>& element) {
+    auto row_id = RowID{};
+    auto is_null = uint8_t{};
+    _read(position, row_id);
+    _read(position, is_null);
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      auto size = size_t{};
+      _read(position, size);
+      element = PartitionedElement<T>{row_id, pmr_string{position, size}};
+      position += size;
+    } else {
+      auto value = T{};
+      _read(position, value);
+      element = PartitionedElement<T>{row_id, value};
+    }
+    return is_null;
+  }
+
+  int _file_descriptor;
+  // Guards the blocks and the file size while chunks are appended
+  std::mutex _mutex;
+  size_t _file_size{0};
+  std::vector<std::vector<Block>> _blocks;
+  std::atomic_bool _has_null_values{false};
 };
 
+// If runtime_filter_to_populate is given, the hashes and the range of the materialized values are added to it. If
+// runtime_filter_to_apply is given and active (see JoinHashRuntimeFilter::is_active()), values (except NULLs) and
+// chunks that cannot find a join partner are discarded. If spilled_partitions is given, each materialized chunk is
+// appended to it by radix and not kept in the returned container.
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                    JoinHashRuntimeFilter<HashedType>* const runtime_filter_to_populate = nullptr,
+                                    const JoinHashRuntimeFilter<HashedType>* const runtime_filter_to_apply = nullptr,
+                                    SpilledPartitions<T>* const spilled_partitions = nullptr) {
   // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
   auto chunk_count = in_table->chunk_count();
 
@@ -215,9 +452,20 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       // Skip chunks that were physically deleted
       if (!chunk_in) return;
 
+      // The decision whether to apply the runtime filter is made once per chunk
+      const auto apply_runtime_filter = runtime_filter_to_apply && runtime_filter_to_apply->is_active();
+      if (apply_runtime_filter && !runtime_filter_to_apply->template may_contain_chunk<T>(*chunk_in, column_id)) {
+        runtime_filter_to_apply->record_probed_rows(chunk_in->size(), 0);
+        histograms[chunk_id] = std::vector<size_t>(num_radix_partitions);
+        return;
+      }
+
       auto& elements = radix_container[chunk_id].elements;
       auto& null_values = radix_container[chunk_id].null_values;
 
+      // Range of the values in this chunk, only used if runtime_filter_to_populate is given
+      [[maybe_unused]] auto chunk_range = std::optional<std::pair<HashedType, HashedType>>{};
+
       elements.resize(chunk_in->size());
       if constexpr (keep_null_values) {
         null_values.resize(chunk_in->size());
@@ -244,6 +492,32 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             // double. See #1550 for details.
             const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
+            if (!value.is_null()) {
+              if (apply_runtime_filter &&
+                  !runtime_filter_to_apply->may_contain(static_cast<HashedType>(value.value()), hashed_value)) {
+                // The value has no join partner. Skip it, but keep track of the position in the reference segment.
+                if constexpr (is_reference_segment_iterable_v<IterableType>) {
+                  ++reference_chunk_offset;
+                }
+                ++it;
+                continue;
+              }
+
+              if (runtime_filter_to_populate) {
+                runtime_filter_to_populate->insert(hashed_value);
+                if constexpr (JoinHashRuntimeFilter<HashedType>::TRACKS_RANGE) {
+                  const auto hashed_type_value = static_cast<HashedType>(value.value());
+                  if (!chunk_range) {
+                    chunk_range.emplace(hashed_type_value, hashed_type_value);
+                  } else if (hashed_type_value < chunk_range->first) {
+                    chunk_range->first = hashed_type_value;
+                  } else if (hashed_type_value > chunk_range->second) {
+                    chunk_range->second = hashed_type_value;
+                  }
+                }
+              }
+            }
+
             /*
             For ReferenceSegments we do not use the RowIDs from the referenced tables.
             Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
@@ -288,7 +562,207 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 
       // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
       // vector to the number of values actually written.
+      const auto probed_row_count = elements.size();
       elements.resize(std::distance(elements.begin(), elements_iter));
+      if constexpr (keep_null_values) {
+        null_values.resize(elements.size());
+      }
+
+      if (apply_runtime_filter) runtime_filter_to_apply->record_probed_rows(probed_row_count, elements.size());
+
+      if constexpr (JoinHashRuntimeFilter<HashedType>::TRACKS_RANGE) {
+        if (chunk_range) runtime_filter_to_populate->extend_range(chunk_range->first, chunk_range->second);
+      }
+
+      if (spilled_partitions) {
+        spilled_partitions->template append_by_radix<HashedType>(radix_container[chunk_id], radix_bits);
+        radix_container[chunk_id] = Partition<T>();
+      }
+
+      histograms[chunk_id] = std::move(histogram);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  return radix_container;
+}
+
+// A column that is part of a composite join key
+struct JoinKeyColumn {
+  ColumnID column_id;
+  DataType data_type;
+  // The type to which the values of this column and of the column it is compared to are cast (see JoinHashTraits)
+  DataType hashed_data_type;
+  // Set if this column and the column it is compared to share a dictionary (see find_shared_dictionary_segment). The
+  // key then holds the value ID instead of the value, which also allows for string columns.
+  bool uses_value_ids;
+};
+
+// Normalizes a value to the 64 bits that it occupies in a composite join key. Values that compare as equal must have
+// the same bits, which is not the case for the two zeros of floating point types.
+template <typename HashedType>
+uint64_t normalize_composite_join_key_value(HashedType value) {
+  static_assert(std::is_arithmetic_v<HashedType> && sizeof(HashedType) <= sizeof(uint64_t),
+                "Only numeric values can be part of a composite join key");
+  if constexpr (std::is_floating_point_v<HashedType>) {
+    if (value == HashedType{0}) value = HashedType{0};
+  }
+
+  auto normalized_value = uint64_t{0};
+  std::memcpy(&normalized_value, &value, sizeof(HashedType));
+  return normalized_value;
+}
+
+/*
+Materializes the composite keys of a join on multiple equality predicates. In contrast to materialize_input(), which
+materializes a single join column, the elements hold the normalized values of all key columns, so that a single hash
+table lookup resolves all equality predicates. Radix partitioning and building the hash tables work on the keys as they
+do for single values. A row is NULL if any of its key columns is NULL or NaN, as an equality predicate with either is
+never true. For columns that share a dictionary with the column they are compared to, the key holds the value ID.
+*/
+template <typename CompositeKey, bool keep_null_values>
+RadixContainer<CompositeKey> materialize_composite_key_input(const std::shared_ptr<const Table>& in_table,
+                                                             const std::vector<JoinKeyColumn>& key_columns,
+                                                             std::vector<std::vector<size_t>>& histograms,
+                                                             const size_t radix_bits,
+                                                             JoinHashRuntimeFilter<CompositeKey>* const
+                                                                 runtime_filter_to_populate = nullptr,
+                                                             const JoinHashRuntimeFilter<CompositeKey>* const
+                                                                 runtime_filter_to_apply = nullptr,
+                                                             SpilledPartitions<CompositeKey>* const
+                                                                 spilled_partitions = nullptr) {
+  Assert(key_columns.size() == std::tuple_size_v<decltype(CompositeKey::values)>,
+         "Number of key columns does not match the composite key");
+
+  const auto chunk_count = in_table->chunk_count();
+
+  const std::hash<CompositeKey> hash_function;
+  auto radix_container = RadixContainer<CompositeKey>{};
+  radix_container.resize(chunk_count);
+
+  const size_t num_radix_partitions = 1ull << radix_bits;
+  const auto radix_mask = static_cast<size_t>(pow(2, radix_bits) - 1);
+
+  histograms.resize(chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!in_table->get_chunk(chunk_id)) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, in_table, chunk_id]() {
+      const auto chunk_in = in_table->get_chunk(chunk_id);
+
+      // Skip chunks that were physically deleted
+      if (!chunk_in) return;
+
+      // Concurrent inserts might grow the last chunk of a data table. Those rows are not visible to the current
+      // transaction, so that only the rows that existed at this point are materialized for all key columns.
+      const auto chunk_size = chunk_in->size();
+
+      // Materialize the key columns one after another, which keeps the segment iteration in tight loops. For
+      // ReferenceSegments, we do not use the RowIDs from the referenced tables, but the offsets in the segments
+      // themselves (see materialize_input()). Thus, a key's RowID is given by its position in the chunk.
+      auto keys = std::vector<CompositeKey>(chunk_size);
+      auto key_is_null = std::vector<bool>(chunk_size);
+
+      for (auto key_column_idx = size_t{0}; key_column_idx < key_columns.size(); ++key_column_idx) {
+        const auto& key_column = key_columns[key_column_idx];
+        const auto segment = chunk_in->get_segment(key_column.column_id);
+
+        if (key_column.uses_value_ids) {
+          iterate_value_ids(*segment, [&](const ChunkOffset chunk_offset, const ValueID value_id) {
+            if (chunk_offset >= chunk_size) return;
+            if (value_id == INVALID_VALUE_ID) {
+              key_is_null[chunk_offset] = true;
+              return;
+            }
+            keys[chunk_offset].values[key_column_idx] = value_id;
+          });
+          continue;
+        }
+
+        resolve_data_type(key_column.data_type, [&](const auto column_data_type_t) {
+          using ColumnDataType = typename decltype(column_data_type_t)::type;
+          resolve_data_type(key_column.hashed_data_type, [&](const auto hashed_data_type_t) {
+            using HashedType = typename decltype(hashed_data_type_t)::type;
+
+            if constexpr (!std::is_same_v<ColumnDataType, pmr_string> && !std::is_same_v<HashedType, pmr_string>) {
+              segment_with_iterators<ColumnDataType>(*segment, [&](auto it, const auto end) {
+                for (auto chunk_offset = ChunkOffset{0}; it != end && chunk_offset < chunk_size; ++it, ++chunk_offset) {
+                  const auto& value = *it;
+                  if (value.is_null()) {
+                    key_is_null[chunk_offset] = true;
+                    continue;
+                  }
+
+                  const auto hashed_value = static_cast<HashedType>(value.value());
+                  if constexpr (std::is_floating_point_v<HashedType>) {
+                    // NaN does not equal any value, not even NaN. As the keys are compared bit by bit, it is treated
+                    // like NULL so that it does not find a partner.
+                    if (std::isnan(hashed_value)) {
+                      key_is_null[chunk_offset] = true;
+                      continue;
+                    }
+                  }
+
+                  keys[chunk_offset].values[key_column_idx] = normalize_composite_join_key_value(hashed_value);
+                }
+              });
+            } else {
+              Fail("Strings cannot be part of a composite join key");
+            }
+          });
+        });
+      }
+
+      auto& elements = radix_container[chunk_id].elements;
+      auto& null_values = radix_container[chunk_id].null_values;
+      elements.resize(chunk_size);
+      if constexpr (keep_null_values) {
+        null_values.resize(chunk_size);
+      }
+
+      auto histogram = std::vector<size_t>(num_radix_partitions);
+      auto element_count = size_t{0};
+
+      const auto apply_runtime_filter = runtime_filter_to_apply && runtime_filter_to_apply->is_active();
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if constexpr (!keep_null_values) {
+          if (key_is_null[chunk_offset]) continue;
+        }
+
+        if (!key_is_null[chunk_offset] && (runtime_filter_to_populate || apply_runtime_filter)) {
+          const auto hash = hash_function(keys[chunk_offset]);
+          if (apply_runtime_filter && !runtime_filter_to_apply->may_contain(keys[chunk_offset], hash)) continue;
+          if (runtime_filter_to_populate) runtime_filter_to_populate->insert(hash);
+        }
+
+        if constexpr (keep_null_values) {
+          null_values[element_count] = key_is_null[chunk_offset];
+        }
+
+        elements[element_count] = PartitionedElement<CompositeKey>{RowID{chunk_id, chunk_offset}, keys[chunk_offset]};
+        ++element_count;
+
+        if (radix_bits > 0) {
+          ++histogram[hash_function(keys[chunk_offset]) & radix_mask];
+        }
+      }
+
+      elements.resize(element_count);
+      if constexpr (keep_null_values) {
+        null_values.resize(element_count);
+      }
+      if (apply_runtime_filter) runtime_filter_to_apply->record_probed_rows(chunk_size, element_count);
+
+      if (spilled_partitions) {
+        spilled_partitions->template append_by_radix<CompositeKey>(radix_container[chunk_id], radix_bits);
+        radix_container[chunk_id] = Partition<CompositeKey>();
+      }
 
       histograms[chunk_id] = std::move(histogram);
     }));
@@ -305,7 +779,8 @@ Build all the hash tables for the partitions of the build column. One job per pa
 
 template <typename BuildColumnType, typename HashedType>
 std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<BuildColumnType>& radix_container,
-                                                           const JoinHashBuildMode mode, const size_t radix_bits) {
+                                                           const JoinHashBuildMode mode, const size_t radix_bits,
+                                                           const bool track_matches = false) {
   if (radix_container.empty()) return {};
 
   /*
@@ -319,7 +794,8 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
     for (size_t partition_idx = 0; partition_idx < radix_container.size(); ++partition_idx) {
       total_size += radix_container[partition_idx].elements.size();
     }
-    hash_tables = {PosHashTable<HashedType>(mode, total_size)};
+    // PosHashTable is move-only, which rules out an initializer list
+    hash_tables.emplace_back(std::in_place, mode, total_size);
   } else {
     hash_tables.resize(radix_container.size());
   }
@@ -336,12 +812,18 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
     const auto insert_into_hash_table = [&, partition_idx]() {
       const auto hash_table_idx = radix_bits > 0 ? partition_idx : 0;
       const auto& elements = radix_container[partition_idx].elements;
+      const auto& null_values = radix_container[partition_idx].null_values;
 
       auto& hash_table = hash_tables[hash_table_idx];
       if (radix_bits > 0) {
         hash_table = PosHashTable<HashedType>(mode, elements.size());
       }
-      for (const auto& element : elements) {
+      for (auto partition_offset = size_t{0}; partition_offset < elements.size(); ++partition_offset) {
+        // NULL values never find a join partner. They are only kept by the materialization if they are needed later
+        // (e.g., to emit them as unmatched rows), but are not inserted into the hash table.
+        if (!null_values.empty() && null_values[partition_offset]) continue;
+
+        const auto& element = elements[partition_offset];
         DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
 
         hash_table->emplace(element.value, element.row_id);
@@ -350,6 +832,7 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
       if (radix_bits > 0) {
         // In case only a single hash table is built, shrink to fit is called outside of the loop.
         hash_table->shrink_to_fit();
+        if (track_matches) hash_table->enable_match_tracking();
       }
     };
 
@@ -365,7 +848,10 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
   // If radix partitioning is used, shrink_to_fit is called above.
-  if (radix_bits == 0) hash_tables[0]->shrink_to_fit();
+  if (radix_bits == 0) {
+    hash_tables[0]->shrink_to_fit();
+    if (track_matches) hash_tables[0]->enable_match_tracking();
+  }
 
   return hash_tables;
 }
@@ -488,6 +974,10 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(probe_radix_container.size());
 
+  // For full outer joins, the build rows that are not matched are emitted after probing (see
+  // write_unmatched_build_rows())
+  const auto track_build_matches = mode == JoinMode::FullOuter;
+
   /*
     NUMA notes:
     At this point both input relations are partitioned using radix partitioning.
@@ -564,18 +1054,24 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
 
             // If NULL values are discarded, the matching probe_column_element pairs will be written to the result pos
             // lists.
+            const auto& matching_rows = *primary_predicate_matching_rows;
             if (!multi_predicate_join_evaluator) {
-              for (const auto& row_id : *primary_predicate_matching_rows) {
-                pos_list_build_side_local.emplace_back(row_id);
+              for (auto index_in_pos_list = size_t{0}; index_in_pos_list < matching_rows.size(); ++index_in_pos_list) {
+                pos_list_build_side_local.emplace_back(matching_rows[index_in_pos_list]);
                 pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
+                if (track_build_matches) hash_table.mark_as_matched(primary_predicate_matching_rows, index_in_pos_list);
               }
             } else {
               auto match_found = false;
-              for (const auto& row_id : *primary_predicate_matching_rows) {
+              for (auto index_in_pos_list = size_t{0}; index_in_pos_list < matching_rows.size(); ++index_in_pos_list) {
+                const auto& row_id = matching_rows[index_in_pos_list];
                 if (multi_predicate_join_evaluator->satisfies_all_predicates(row_id, probe_column_element.row_id)) {
                   pos_list_build_side_local.emplace_back(row_id);
                   pos_list_probe_side_local.emplace_back(probe_column_element.row_id);
                   match_found = true;
+                  if (track_build_matches) {
+                    hash_table.mark_as_matched(primary_predicate_matching_rows, index_in_pos_list);
+                  }
                 }
               }
 
@@ -739,6 +1235,49 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
   Hyrise::get().scheduler()->wait_for_tasks(jobs);
 }
 
+// For full outer joins, appends the build rows that were not matched during probing (including those with NULL values)
+// to the pos lists, paired with NULL_ROW_IDs on the probe side. One pair of pos lists is appended per build partition.
+template <typename BuildColumnType, typename HashedType>
+void write_unmatched_build_rows(const RadixContainer<BuildColumnType>& build_radix_container,
+                                const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables,
+                                std::vector<RowIDPosList>& pos_lists_build_side,
+                                std::vector<RowIDPosList>& pos_lists_probe_side) {
+  const auto first_output_idx = pos_lists_build_side.size();
+  pos_lists_build_side.resize(first_output_idx + build_radix_container.size());
+  pos_lists_probe_side.resize(first_output_idx + build_radix_container.size());
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(build_radix_container.size());
+
+  for (auto partition_idx = size_t{0}; partition_idx < build_radix_container.size(); ++partition_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      const auto& partition = build_radix_container[partition_idx];
+      auto pos_list_build_side_local = RowIDPosList{};
+
+      // Without radix partitioning, all build partitions share a single hash table, which is scanned only once
+      const auto hash_table_idx = hash_tables.size() > 1 ? partition_idx : 0;
+      if ((hash_tables.size() > 1 || partition_idx == 0) && hash_table_idx < hash_tables.size() &&
+          hash_tables[hash_table_idx]) {
+        hash_tables[hash_table_idx]->for_each_unmatched_row(
+            [&](const RowID& row_id) { pos_list_build_side_local.emplace_back(row_id); });
+      }
+
+      for (auto partition_offset = size_t{0}; partition_offset < partition.null_values.size(); ++partition_offset) {
+        if (partition.null_values[partition_offset]) {
+          pos_list_build_side_local.emplace_back(partition.elements[partition_offset].row_id);
+        }
+      }
+
+      pos_lists_probe_side[first_output_idx + partition_idx] =
+          RowIDPosList(pos_list_build_side_local.size(), NULL_ROW_ID);
+      pos_lists_build_side[first_output_idx + partition_idx] = std::move(pos_list_build_side_local);
+    }));
+    jobs.back()->schedule();
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+}
+
 using PosLists = std::vector<std::shared_ptr<const AbstractPosList>>;
 using PosListsByChunk = std::vector<std::shared_ptr<PosLists>>;
 
@@ -1,10 +1,32 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include <type_traits>
 
+#include <boost/functional/hash.hpp>
+
 namespace opossum {
 
+// Key of a hash join on multiple equality predicates (see materialize_composite_key_input in join_hash_steps.hpp). It
+// holds the values of all key columns of a row, each of which is normalized to 64 bits. Two rows satisfy all equality
+// predicates if their keys are equal.
+template <size_t key_column_count>
+struct CompositeJoinKey {
+  std::array<uint64_t, key_column_count> values;
+
+  bool operator==(const CompositeJoinKey& other) const { return values == other.values; }
+};
+
+template <typename T>
+struct is_composite_join_key : std::false_type {};
+
+template <size_t key_column_count>
+struct is_composite_join_key<CompositeJoinKey<key_column_count>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_composite_join_key_v = is_composite_join_key<T>::value;
+
 // JoinHashTraits
 
 template <typename L, typename R, class Enable = void>
@@ -38,4 +60,25 @@ struct JoinHashTraits<L, R, std::enable_if_t<std::is_same_v<R, pmr_string> || st
   using HashType = pmr_string;
 };
 
+// Composite keys are already normalized, so that they are hashed as they are
+template <size_t key_column_count>
+struct JoinHashTraits<CompositeJoinKey<key_column_count>, CompositeJoinKey<key_column_count>> {
+  using HashType = CompositeJoinKey<key_column_count>;
+};
+
 }  // namespace opossum
+
+namespace std {
+
+template <size_t key_column_count>
+struct hash<opossum::CompositeJoinKey<key_column_count>> {
+  size_t operator()(const opossum::CompositeJoinKey<key_column_count>& key) const {
+    auto hash = size_t{0};
+    for (const auto value : key.values) {
+      boost::hash_combine(hash, value);
+    }
+    return hash;
+  }
+};
+
+}  // namespace std
@@ -0,0 +1,228 @@
+#include "morsel_pipeline.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MorselPipeline::MorselPipeline(const std::shared_ptr<const AbstractOperator>& in,
+                               const std::vector<std::shared_ptr<AbstractOperator>>& init_stages)
+    : AbstractReadOnlyOperator(OperatorType::MorselPipeline, in), stages(init_stages) {
+  Assert(!stages.empty(), "MorselPipeline needs at least one stage");
+  for (auto stage_idx = size_t{0}; stage_idx < stages.size(); ++stage_idx) {
+    const auto& stage = stages[stage_idx];
+    Assert(is_pipelineable(*stage), "Operator " + stage->name() + " cannot be part of a MorselPipeline");
+
+    const auto& expected_input = stage_idx == 0 ? in : stages[stage_idx - 1];
+    Assert(stage->input_left() == expected_input, "Stages of MorselPipeline are not chained");
+  }
+}
+
+const std::string& MorselPipeline::name() const {
+  static const auto name = std::string{"MorselPipeline"};
+  return name;
+}
+
+std::string MorselPipeline::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name();
+  for (const auto& stage : stages) {
+    stream << separator << "[" << stage->description(DescriptionMode::SingleLine) << "]";
+  }
+
+  return stream.str();
+}
+
+bool MorselPipeline::is_pipelineable(const AbstractOperator& op) {
+  auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  switch (op.type()) {
+    case OperatorType::TableScan: {
+      const auto& table_scan = static_cast<const TableScan&>(op);
+      // Excluded ChunkIDs refer to the complete input table, not to a single morsel
+      if (!table_scan.excluded_chunk_ids.empty()) return false;
+      expressions.emplace_back(table_scan.predicate());
+    } break;
+
+    case OperatorType::Projection:
+      expressions = static_cast<const Projection&>(op).expressions;
+      break;
+
+    default:
+      return false;
+  }
+
+  auto contains_subquery = false;
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::PQPSubquery) contains_subquery = true;
+      return contains_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  return !contains_subquery;
+}
+
+std::shared_ptr<const Table> MorselPipeline::_on_execute() {
+  const auto input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  // The outputs of the morsels are stored by the ChunkID of the morsel, so that the output keeps the input's order
+  auto morsel_outputs = std::vector<std::shared_ptr<const Table>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    if (chunk->size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([this, &input_table, &morsel_outputs, chunk_id]() {
+      morsel_outputs[chunk_id] = _execute_stages(_create_morsel_table(input_table, chunk_id));
+    }));
+    jobs.back()->schedule();
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // Without a single morsel, the stages still need to be executed once to determine the output's column definitions
+  if (jobs.empty()) {
+    return _execute_stages(std::make_shared<Table>(input_table->column_definitions(), TableType::References));
+  }
+
+  /**
+   * Concatenate the outputs of the morsels. All of them have the same column definitions, except for the nullability
+   * that stages (e.g., the Projection) might derive from the segments of the single morsel.
+   */
+  auto column_definitions = TableColumnDefinitions{};
+  auto table_type = TableType::References;
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  auto is_first_output = true;
+
+  for (const auto& morsel_output : morsel_outputs) {
+    if (!morsel_output) continue;
+
+    if (is_first_output) {
+      column_definitions = morsel_output->column_definitions();
+      table_type = morsel_output->type();
+      is_first_output = false;
+    } else {
+      DebugAssert(morsel_output->type() == table_type, "Morsels of a MorselPipeline yielded different table types");
+      const auto column_count = morsel_output->column_count();
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        column_definitions[column_id].nullable |= morsel_output->column_is_nullable(column_id);
+      }
+    }
+
+    const auto output_chunk_count = morsel_output->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < output_chunk_count; ++chunk_id) {
+      const auto chunk = morsel_output->get_chunk(chunk_id);
+      if (chunk->size() == 0) continue;
+
+      auto segments = Segments{};
+      const auto column_count = morsel_output->column_count();
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(chunk->get_segment(column_id));
+      }
+      output_chunks.emplace_back(std::make_shared<Chunk>(segments));
+    }
+  }
+
+  return std::make_shared<Table>(column_definitions, table_type, std::move(output_chunks));
+}
+
+std::shared_ptr<const Table> MorselPipeline::_create_morsel_table(
+    const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id) const {
+  const auto chunk = input_table->get_chunk(chunk_id);
+  const auto column_count = input_table->column_count();
+
+  auto segments = Segments{};
+  segments.reserve(column_count);
+
+  if (input_table->type() == TableType::References) {
+    // The segments of a reference table can be shared, as they already point to the underlying data table
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+  } else {
+    // Data tables are referenced via a PosList that covers the entire chunk. Determine the size once, as the chunk
+    // might be mutable.
+    const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk->size());
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+    }
+  }
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{std::make_shared<Chunk>(segments)};
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(chunks));
+}
+
+std::shared_ptr<const Table> MorselPipeline::_execute_stages(const std::shared_ptr<const Table>& morsel_table) const {
+  const auto table_wrapper = std::make_shared<TableWrapper>(morsel_table);
+  table_wrapper->execute();
+
+  // Copying the last stage recursively copies all other stages. The input of the first stage is replaced by the
+  // TableWrapper of the morsel.
+  auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+  copied_ops.emplace(input_left().get(), table_wrapper);
+  stages.back()->deep_copy(copied_ops);
+
+  const auto transaction_context = this->transaction_context();
+  for (const auto& stage : stages) {
+    const auto& copied_stage = copied_ops.at(stage.get());
+    if (transaction_context) copied_stage->set_transaction_context(transaction_context);
+    copied_stage->execute();
+  }
+
+  return copied_ops.at(stages.back().get())->get_output();
+}
+
+std::shared_ptr<AbstractOperator> MorselPipeline::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+  copied_ops.emplace(input_left().get(), copied_input_left);
+  stages.back()->deep_copy(copied_ops);
+
+  auto copied_stages = std::vector<std::shared_ptr<AbstractOperator>>{};
+  copied_stages.reserve(stages.size());
+  for (const auto& stage : stages) {
+    copied_stages.emplace_back(copied_ops.at(stage.get()));
+  }
+
+  return std::make_shared<MorselPipeline>(copied_input_left, copied_stages);
+}
+
+void MorselPipeline::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  // AbstractOperator::set_parameters() already takes care of the input, so the stages are not set recursively
+  for (const auto& stage : stages) {
+    stage->_on_set_parameters(parameters);
+  }
+}
+
+void MorselPipeline::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  // The stages are not inputs of the MorselPipeline, so set_transaction_context_recursively() does not reach them.
+  // deep_copy() does not copy the transaction context, so _execute_stages() passes it on to the per-morsel copies.
+  for (const auto& stage : stages) {
+    stage->set_transaction_context(transaction_context);
+  }
+}
+
+}  // namespace opossum
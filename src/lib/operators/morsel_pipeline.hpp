@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Executes a chain of chunk-local operators (the stages) morsel by morsel instead of operator by operator. A morsel is
+ * a single chunk of the input table. For each morsel, a JobTask runs all stages back to back, so that the intermediate
+ * results of a morsel are consumed while they are still in the CPU caches and are never materialized for the entire
+ * table. The outputs of the last stage are concatenated in the order of the input chunks.
+ *
+ * The stages are templates that are never executed themselves: The first stage consumes the input of the
+ * MorselPipeline, every other stage consumes the previous stage. For every morsel, the stages are deep-copied onto a
+ * TableWrapper that holds the morsel. Thus, only operators whose result for a table equals the concatenation of their
+ * results for the single chunks of that table can be part of a pipeline (see is_pipelineable). Pipeline breakers
+ * (e.g., joins, aggregates, and sorts) consume the complete output of the MorselPipeline as usual.
+ *
+ * MorselPipelines are created by the LQPTranslator if UseMorselPipelines::Yes is passed to it.
+ */
+class MorselPipeline : public AbstractReadOnlyOperator {
+ public:
+  MorselPipeline(const std::shared_ptr<const AbstractOperator>& in,
+                 const std::vector<std::shared_ptr<AbstractOperator>>& init_stages);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  /**
+   * TableScans without excluded chunks and Projections, both as long as they do not contain subqueries. Subqueries
+   * would be copied and, in the case of uncorrelated subqueries, executed once per morsel.
+   */
+  static bool is_pipelineable(const AbstractOperator& op);
+
+  const std::vector<std::shared_ptr<AbstractOperator>> stages;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  // Creates a single-chunk table from the chunk with the given ID of the input table
+  std::shared_ptr<const Table> _create_morsel_table(const std::shared_ptr<const Table>& input_table,
+                                                    const ChunkID chunk_id) const;
+
+  // Executes copies of the stages on the given morsel table and returns the output of the last stage
+  std::shared_ptr<const Table> _execute_stages(const std::shared_ptr<const Table>& morsel_table) const;
+};
+
+}  // namespace opossum
@@ -1,97 +1,106 @@
 #include "sort.hpp"
 
-#include "storage/segment_iterate.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/normalized_keys.hpp"
 
 namespace {
 
 using namespace opossum;  // NOLINT
 
-// Given an unsorted_table and a pos_list that defines the output order, this materializes all columns in the table,
-// creating chunks of output_chunk_size rows at maximum.
-std::shared_ptr<Table> materialize_output_table(const std::shared_ptr<const Table>& unsorted_table,
-                                                const RowIDPosList& pos_list, const ChunkOffset output_chunk_size) {
-  // First we create a new table as the output
-  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
-  auto output = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::Data, output_chunk_size);
-
-  // After we created the output table and initialized the column structure, we can start adding values. Because the
-  // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-  // copied column by column for each output row.
-
-  // Ceiling of integer division
-  const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
-  const auto output_chunk_count = div_ceil(pos_list.size(), output_chunk_size);
-  Assert(pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
-
-  // Vector of segments for each chunk
-  std::vector<Segments> output_segments_by_chunk(output_chunk_count);
-
-  // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached
-  const auto input_chunk_count = unsorted_table->chunk_count();
-  const auto row_count = unsorted_table->row_count();
-  for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-    const auto column_data_type = output->column_data_type(column_id);
-
-    resolve_data_type(column_data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
-
-      auto chunk_it = output_segments_by_chunk.begin();
-      auto current_segment_size = 0u;
-
-      auto value_segment_value_vector = pmr_vector<ColumnDataType>();
-      auto value_segment_null_vector = pmr_vector<bool>();
-
-      value_segment_value_vector.reserve(output_chunk_size);
-      value_segment_null_vector.reserve(output_chunk_size);
-
-      auto accessor_by_chunk_id =
-          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(unsorted_table->chunk_count());
-      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-        const auto& base_segment = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
-        accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<ColumnDataType>(base_segment);
-      }
-
-      for (auto row_index = 0u; row_index < row_count; ++row_index) {
-        const auto [chunk_id, chunk_offset] = pos_list[row_index];
-
-        auto& accessor = accessor_by_chunk_id[chunk_id];
-        const auto typed_value = accessor->access(chunk_offset);
-        const auto is_null = !typed_value;
-        value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-        value_segment_null_vector.push_back(is_null);
-
-        ++current_segment_size;
-
-        // Check if value segment is full
-        if (current_segment_size >= output_chunk_size) {
-          current_segment_size = 0u;
-          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                              std::move(value_segment_null_vector));
-          chunk_it->push_back(value_segment);
-          value_segment_value_vector = pmr_vector<ColumnDataType>();
-          value_segment_null_vector = pmr_vector<bool>();
-
-          value_segment_value_vector.reserve(output_chunk_size);
-          value_segment_null_vector.reserve(output_chunk_size);
+// Rows are sorted in runs of at least this size, smaller inputs are not worth the overhead of merging
+constexpr auto MIN_ROWS_PER_SORT_RUN = size_t{10'000};
+
+/**
+ * Sorts the rows with up to worker_count JobTasks. First, runs of equal size are sorted independently. Then, pairs of
+ * runs are merged until a single run is left. To keep all workers busy when only few runs are left, each merge is
+ * split into independent parts: The left run is cut into parts of equal size and the right run is cut at the
+ * positions where the first rows of these parts would be inserted.
+ */
+void parallel_sort(std::vector<NormalizedKeyRow>& rows, const size_t worker_count) {
+  const auto compare = NormalizedKeyRowLess{};
+  const auto row_count = rows.size();
+  const auto run_count = std::max(size_t{1}, std::min(worker_count, row_count / MIN_ROWS_PER_SORT_RUN));
+
+  if (run_count == 1) {
+    std::sort(rows.begin(), rows.end(), compare);
+    return;
+  }
 
-          ++chunk_it;
-        }
-      }
+  auto run_bounds = std::vector<size_t>(run_count + 1);
+  for (auto run_index = size_t{0}; run_index <= run_count; ++run_index) {
+    run_bounds[run_index] = row_count * run_index / run_count;
+  }
 
-      // Last segment has not been added
-      if (current_segment_size > 0u) {
-        auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                            std::move(value_segment_null_vector));
-        chunk_it->push_back(value_segment);
-      }
-    });
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(worker_count);
+  for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, run_index]() {
+      std::sort(rows.begin() + run_bounds[run_index], rows.begin() + run_bounds[run_index + 1], compare);
+    }));
+    jobs.back()->schedule();
   }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // Runs are merged alternately from rows into buffer and from buffer into rows
+  auto buffer = std::vector<NormalizedKeyRow>(row_count);
+  auto* source = &rows;
+  auto* target = &buffer;
+
+  while (run_bounds.size() > 2) {
+    const auto current_run_count = run_bounds.size() - 1;
+    const auto merge_count = (current_run_count + 1) / 2;
+    const auto part_count = std::max(size_t{1}, worker_count / merge_count);
+
+    auto merged_run_bounds = std::vector<size_t>{0};
+    jobs.clear();
+
+    for (auto run_index = size_t{0}; run_index < current_run_count; run_index += 2) {
+      // For an odd number of runs, the last run has no partner and is merged with an empty run, i.e., copied
+      const auto left_begin = source->cbegin() + run_bounds[run_index];
+      const auto left_end = source->cbegin() + run_bounds[run_index + 1];
+      const auto right_end = source->cbegin() + run_bounds[std::min(run_index + 2, current_run_count)];
+      const auto output_begin = target->begin() + run_bounds[run_index];
+      merged_run_bounds.emplace_back(run_bounds[std::min(run_index + 2, current_run_count)]);
+
+      const auto left_size = static_cast<size_t>(std::distance(left_begin, left_end));
+      const auto part_left_begin = [=](const size_t part_index) {
+        return left_begin + static_cast<ptrdiff_t>(left_size * part_index / part_count);
+      };
+      const auto part_right_begin = [=](const size_t part_index) {
+        if (part_index == 0) return left_end;
+        const auto left_position = part_left_begin(part_index);
+        if (left_position == left_end) return right_end;
+        return std::lower_bound(left_end, right_end, *left_position, compare);
+      };
+
+      for (auto part_index = size_t{0}; part_index < part_count; ++part_index) {
+        jobs.emplace_back(std::make_shared<JobTask>([=]() {
+          const auto part_left = part_left_begin(part_index);
+          const auto part_right = part_right_begin(part_index);
+          const auto part_output =
+              output_begin + std::distance(left_begin, part_left) + std::distance(left_end, part_right);
+          std::merge(part_left, part_left_begin(part_index + 1), part_right, part_right_begin(part_index + 1),
+                     part_output, compare);
+        }));
+        jobs.back()->schedule();
+      }
+    }
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
-  for (auto& segments : output_segments_by_chunk) {
-    output->append_chunk(segments);
+    std::swap(source, target);
+    run_bounds = std::move(merged_run_bounds);
   }
 
-  return output;
+  if (source != &rows) rows.swap(buffer);
 }
 
 }  // namespace
@@ -129,154 +138,49 @@ std::shared_ptr<const Table> Sort::_on_execute() {
            "Sort: Column ID is greater than table's column count");
   }
 
-  std::shared_ptr<Table> sorted_table;
-
-  // After the first (least significant) sort operation has been completed, this holds the order of the table as it has
-  // been determined so far. This is not a completely proper PosList on the input table as it might point to
-  // ReferenceSegments.
-  auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
-
-  for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const bool is_last_sorting_step = (sort_step == 0);
-
-    const auto& sort_definition = _sort_definitions[sort_step];
-    const auto data_type = input_table->column_data_type(sort_definition.column);
-
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
+  // With the ImmediateExecutionScheduler, splitting the work into multiple tasks only adds overhead
+  const auto worker_count = std::dynamic_pointer_cast<ImmediateExecutionScheduler>(Hyrise::get().scheduler())
+                                ? size_t{1}
+                                : Hyrise::get().topology.num_cpus();
 
-      auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.order_by_mode);
-      previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
-
-      if (is_last_sorting_step) {
-        // This is inside the for loop so that we do not have to resolve the type again
-        sorted_table = materialize_output_table(input_table, *previously_sorted_pos_list, _output_chunk_size);
-      }
-    });
-  }
-
-  auto final_sort_definition = _sort_definitions[0];
-  // Set the ordered_by attribute of the output's chunks according to the most significant sort operation, which is the
-  // column the table was sorted by last.
-  const auto chunk_count = sorted_table->chunk_count();
+  // 1. Create the normalized keys, one JobTask per input chunk. The rows of a chunk are placed at the position of the
+  //    chunk's first row in the input table. Determine the chunk sizes once, as chunks might be mutable.
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_sizes = std::vector<ChunkOffset>(chunk_count);
+  auto row_count = size_t{0};
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto& chunk = sorted_table->get_chunk(chunk_id);
-    chunk->finalize();
-    chunk->set_ordered_by(std::make_pair(final_sort_definition.column, final_sort_definition.order_by_mode));
-  }
-  return sorted_table;
-}
-
-template <typename SortColumnType>
-class Sort::SortImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending)
-      : _table_in(table_in), _column_id(column_id), _order_by_mode(order_by_mode) {
-    const auto row_count = _table_in->row_count();
-    _row_id_value_vector.reserve(row_count);
-    _null_value_rows.reserve(row_count);
-  }
-
-  // Sorts table_in, potentially taking the pre-existing order of previously_sorted_pos_list into account.
-  // Returns a PosList, which can either be used as an input to the next call of sort or for materializing the
-  // output table.
-  RowIDPosList sort(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    // 1. Prepare Sort: Creating RowID-value-Structure
-    _materialize_sort_column(previously_sorted_pos_list);
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    const auto sort_with_comparator = [&](auto comparator) {
-      std::stable_sort(_row_id_value_vector.begin(), _row_id_value_vector.end(),
-                       [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
-    };
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      sort_with_comparator(std::less<>{});
-    } else {
-      sort_with_comparator(std::greater<>{});
-    }
-
-    // 2b. Insert null rows if necessary
-    if (!_null_value_rows.empty()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector.insert(_row_id_value_vector.end(), _null_value_rows.begin(), _null_value_rows.end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector.insert(_row_id_value_vector.begin(), _null_value_rows.begin(), _null_value_rows.end());
-      }
-    }
-
-    RowIDPosList pos_list{};
-    pos_list.reserve(_row_id_value_vector.size());
-    for (const auto& [row_id, _] : _row_id_value_vector) {
-      pos_list.emplace_back(row_id);
-    }
-    return pos_list;
-  }
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
 
- protected:
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    // If there was no PosList passed, this is the first sorting run and we simply fill our values and nulls data
-    // structures from our input table. Otherwise we will materialize according to the PosList which is the result of
-    // the last run.
-    if (previously_sorted_pos_list) {
-      _materialize_column_from_pos_list(*previously_sorted_pos_list);
-    } else {
-      const auto chunk_count = _table_in->chunk_count();
-      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = _table_in->get_chunk(chunk_id);
-        Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
-
-        auto base_segment = chunk->get_segment(_column_id);
-
-        segment_iterate<SortColumnType>(*base_segment, [&](const auto& position) {
-          if (position.is_null()) {
-            _null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-          } else {
-            _row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
-          }
-        });
-      }
-    }
+    chunk_sizes[chunk_id] = chunk->size();
+    row_count += chunk_sizes[chunk_id];
   }
 
-  // When there was a preceding sorting run, we materialize by retaining the order of the values in the passed PosList.
-  void _materialize_column_from_pos_list(const RowIDPosList& pos_list) {
-    const auto input_chunk_count = _table_in->chunk_count();
-    auto accessor_by_chunk_id =
-        std::vector<std::unique_ptr<AbstractSegmentAccessor<SortColumnType>>>(input_chunk_count);
-    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-      const auto& base_segment = _table_in->get_chunk(input_chunk_id)->get_segment(_column_id);
-      accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<SortColumnType>(base_segment);
-    }
+  auto key_buffers = std::vector<std::vector<uint8_t>>(chunk_count);
+  auto rows = std::vector<NormalizedKeyRow>(row_count);
 
-    for (auto row_id : pos_list) {
-      const auto [chunk_id, chunk_offset] = row_id;
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
 
-      auto& accessor = accessor_by_chunk_id[chunk_id];
-      const auto typed_value = accessor->access(chunk_offset);
-      if (!typed_value) {
-        _null_value_rows.emplace_back(row_id, SortColumnType{});
-      } else {
-        _row_id_value_vector.emplace_back(row_id, typed_value.value());
-      }
-    }
+  auto chunk_begin_row_index = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto* const chunk_rows = rows.data() + chunk_begin_row_index;
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, chunk_rows]() {
+      create_normalized_keys(*input_table, chunk_id, chunk_sizes[chunk_id], _sort_definitions, key_buffers[chunk_id],
+                             chunk_rows);
+    }));
+    jobs.back()->schedule();
+
+    chunk_begin_row_index += chunk_sizes[chunk_id];
   }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
-  const std::shared_ptr<const Table> _table_in;
-
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+  // 2. Sort the rows by their normalized keys
+  parallel_sort(rows, worker_count);
 
-  std::vector<RowIDValuePair> _row_id_value_vector;
-
-  // Stored as RowIDValuePair for better type compatibility even if value is unused
-  std::vector<RowIDValuePair> _null_value_rows;
-};
+  // 3. Materialize the output chunks
+  Assert(rows.size() == input_table->row_count(), "Mismatching size of input table and sorted rows");
+  return materialize_sorted_rows(input_table, rows, _output_chunk_size, _sort_definitions[0]);
+}
 
 }  // namespace opossum
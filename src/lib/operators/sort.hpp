@@ -29,7 +29,9 @@ struct SortColumnDefinition final {
 /**
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
- * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run. For this,
+ * the values of all sort columns are encoded into a binary-comparable key per row (see sort/normalized_keys.hpp). The
+ * keys are sorted with a parallel merge sort and the output chunks are materialized in parallel.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -47,12 +49,6 @@ class Sort : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  template <typename SortColumnType>
-  class SortImpl;
-
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
   const std::vector<SortColumnDefinition> _sort_definitions;
 
   const ChunkOffset _output_chunk_size;
@@ -0,0 +1,259 @@
+#include "normalized_keys.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_descending(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+bool is_nulls_last(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::AscendingNullsLast || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+// Number of bytes of an encoded non-NULL value, excluding the NULL byte
+template <typename ColumnDataType>
+size_t encoded_value_size(const ColumnDataType& value) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    return value.size() + std::count(value.begin(), value.end(), '\0') + 2;
+  } else {
+    return sizeof(ColumnDataType);
+  }
+}
+
+// Writes the encoded value to key and returns the position behind it
+template <typename ColumnDataType>
+uint8_t* encode_value(const ColumnDataType& value, uint8_t* key) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    for (const auto character : value) {
+      *key++ = static_cast<uint8_t>(character);
+      if (character == '\0') *key++ = 0xFF;
+    }
+    *key++ = 0x00;
+    *key++ = 0x00;
+    return key;
+  } else {
+    using UnsignedType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+
+    auto bits = UnsignedType{};
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      bits = static_cast<UnsignedType>(value) ^ SIGN_BIT;
+    } else {
+      // -0.0 and 0.0 are equal and must have the same key
+      const auto normalized_value = value == ColumnDataType{0} ? ColumnDataType{0} : value;
+      std::memcpy(&bits, &normalized_value, sizeof(bits));
+      bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    }
+
+    for (auto byte_index = sizeof(UnsignedType); byte_index > 0; --byte_index) {
+      *key++ = static_cast<uint8_t>(bits >> ((byte_index - 1) * 8));
+    }
+    return key;
+  }
+}
+
+/**
+ * Calls functor(chunk_offset, is_null, value) for the first row_count rows of the segment. If these rows are only a
+ * small part of the segment (e.g., for the TopN operator), they are accessed one by one instead of iterating over the
+ * entire segment.
+ */
+template <typename ColumnDataType, typename Functor>
+void iterate_rows(const std::shared_ptr<const BaseSegment>& segment, const ChunkOffset row_count,
+                  const Functor& functor) {
+  if (row_count < segment->size() / 2) {
+    const auto accessor = create_segment_accessor<ColumnDataType>(segment);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      const auto typed_value = accessor->access(chunk_offset);
+      if (typed_value) {
+        functor(chunk_offset, false, *typed_value);
+      } else {
+        functor(chunk_offset, true, ColumnDataType{});
+      }
+    }
+    return;
+  }
+
+  segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+    if (position.chunk_offset() >= row_count) return;
+    functor(position.chunk_offset(), position.is_null(), position.value());
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+void create_normalized_keys(const Table& table, const ChunkID chunk_id, const ChunkOffset row_count,
+                            const std::vector<SortColumnDefinition>& sort_definitions,
+                            std::vector<uint8_t>& key_buffer, NormalizedKeyRow* rows) {
+  const auto chunk = table.get_chunk(chunk_id);
+
+  // Determine the size of every key first, as strings have a variable length
+  auto key_offsets = std::vector<size_t>(row_count + 1, 0);
+  for (const auto& sort_definition : sort_definitions) {
+    const auto data_type = table.column_data_type(sort_definition.column);
+    if (data_type == DataType::String) {
+      iterate_rows<pmr_string>(chunk->get_segment(sort_definition.column), row_count,
+                               [&](const auto chunk_offset, const auto is_null, const auto& value) {
+                                 key_offsets[chunk_offset + 1] += 1 + (is_null ? 0 : encoded_value_size(value));
+                               });
+    } else {
+      resolve_data_type(data_type, [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+          key_offsets[chunk_offset + 1] += 1 + sizeof(ColumnDataType);
+        }
+      });
+    }
+  }
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    Assert(key_offsets[chunk_offset + 1] <= std::numeric_limits<uint32_t>::max(), "Sort key is too long");
+    key_offsets[chunk_offset + 1] += key_offsets[chunk_offset];
+  }
+  key_buffer.resize(key_offsets.back());
+
+  // Append the encoded columns to the keys. key_ends holds the current end of each key.
+  auto key_ends = std::vector<uint8_t*>(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    key_ends[chunk_offset] = key_buffer.data() + key_offsets[chunk_offset];
+  }
+
+  for (const auto& sort_definition : sort_definitions) {
+    const auto descending = is_descending(sort_definition.order_by_mode);
+    const auto null_byte = is_nulls_last(sort_definition.order_by_mode) ? uint8_t{1} : uint8_t{0};
+    const auto value_byte = static_cast<uint8_t>(1 - null_byte);
+
+    resolve_data_type(table.column_data_type(sort_definition.column), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      iterate_rows<ColumnDataType>(
+          chunk->get_segment(sort_definition.column), row_count,
+          [&](const auto chunk_offset, const auto is_null, const auto& value) {
+            auto& key_end = key_ends[chunk_offset];
+            if (is_null) {
+              *key_end++ = null_byte;
+              // All NULLs of a fixed-size column have the same key, so that subsequent columns decide about their order
+              if constexpr (!std::is_same_v<ColumnDataType, pmr_string>) {
+                std::memset(key_end, 0, sizeof(ColumnDataType));
+                key_end += sizeof(ColumnDataType);
+              }
+              return;
+            }
+
+            *key_end++ = value_byte;
+            const auto value_begin = key_end;
+            key_end = encode_value<ColumnDataType>(value, key_end);
+            if (descending) {
+              std::transform(value_begin, key_end, value_begin,
+                             [](const uint8_t byte) { return static_cast<uint8_t>(~byte); });
+            }
+          });
+    });
+  }
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    DebugAssert(key_ends[chunk_offset] == key_buffer.data() + key_offsets[chunk_offset + 1], "Unexpected key size");
+    const auto key_size = static_cast<uint32_t>(key_offsets[chunk_offset + 1] - key_offsets[chunk_offset]);
+    rows[chunk_offset] =
+        NormalizedKeyRow{key_buffer.data() + key_offsets[chunk_offset], key_size, RowID{chunk_id, chunk_offset}};
+  }
+}
+
+std::shared_ptr<Table> materialize_sorted_rows(const std::shared_ptr<const Table>& input_table,
+                                               const std::vector<NormalizedKeyRow>& sorted_rows,
+                                               const ChunkOffset output_chunk_size,
+                                               const SortColumnDefinition& ordered_by) {
+  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+  auto output = std::make_shared<Table>(input_table->column_definitions(), TableType::Data, output_chunk_size);
+
+  // Ceiling of integer division
+  const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+  const auto row_count = sorted_rows.size();
+  const auto output_chunk_count = div_ceil(row_count, output_chunk_size);
+
+  // Vector of segments for each chunk
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count);
+
+  const auto input_chunk_count = input_table->chunk_count();
+  const auto column_count = output->column_count();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(output_chunk_count);
+
+  for (auto output_chunk_id = size_t{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, output_chunk_id]() {
+      const auto begin_row_index = output_chunk_id * output_chunk_size;
+      const auto end_row_index = std::min(begin_row_index + output_chunk_size, row_count);
+      auto& output_segments = output_segments_by_chunk[output_chunk_id];
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        resolve_data_type(output->column_data_type(column_id), [&](const auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          auto values = pmr_vector<ColumnDataType>();
+          auto null_values = pmr_vector<bool>();
+          values.reserve(end_row_index - begin_row_index);
+          null_values.reserve(end_row_index - begin_row_index);
+
+          // The rows of an output chunk usually stem from few input chunks, so accessors are created on demand
+          auto accessor_by_chunk_id =
+              std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_chunk_count);
+
+          for (auto row_index = begin_row_index; row_index < end_row_index; ++row_index) {
+            const auto [chunk_id, chunk_offset] = sorted_rows[row_index].row_id;
+
+            auto& accessor = accessor_by_chunk_id[chunk_id];
+            if (!accessor) {
+              accessor =
+                  create_segment_accessor<ColumnDataType>(input_table->get_chunk(chunk_id)->get_segment(column_id));
+            }
+
+            const auto typed_value = accessor->access(chunk_offset);
+            const auto is_null = !typed_value;
+            values.push_back(is_null ? ColumnDataType{} : typed_value.value());
+            null_values.push_back(is_null);
+          }
+
+          output_segments.push_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        });
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  for (auto& segments : output_segments_by_chunk) {
+    output->append_chunk(segments);
+  }
+
+  // Set the ordered_by attribute of the output's chunks according to the most significant sort definition
+  const auto output_table_chunk_count = output->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table_chunk_count; ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    chunk->finalize();
+    chunk->set_ordered_by(std::make_pair(ordered_by.column, ordered_by.order_by_mode));
+  }
+
+  return output;
+}
+
+}  // namespace opossum
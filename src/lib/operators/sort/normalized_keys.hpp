@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "operators/sort.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The Sort and TopN operators encode the values of all sort columns of a row into a single normalized key. Normalized
+ * keys are binary-comparable, i.e., comparing two keys with memcmp yields the order of the two rows according to all
+ * sort definitions. This way, multiple columns are sorted in a single pass without resolving any data types.
+ *
+ * Each column contributes to the key of a row:
+ *  (1) A NULL byte that is smaller for NULLs than for values if NULLs come first (and vice versa).
+ *  (2) Unless the value is NULL, the encoded value. Numbers are stored big-endian with their sign bit flipped (for
+ *      integers) or with the IEEE 754 bits flipped so that negative numbers are ordered in reverse (for floating-point
+ *      values). Strings are stored with every 0x00 byte escaped as 0x00 0xFF and terminated by 0x00 0x00, so that no
+ *      encoded string is a prefix of another one. For descending orders, all bytes of the value are inverted.
+ *
+ * As equal keys are ordered by their RowID, which reflects the order of the input, sorting by NormalizedKeyRowLess is
+ * stable.
+ */
+struct NormalizedKeyRow {
+  const uint8_t* key;
+  uint32_t key_size;
+  RowID row_id;
+};
+
+struct NormalizedKeyRowLess {
+  bool operator()(const NormalizedKeyRow& lhs, const NormalizedKeyRow& rhs) const {
+    const auto result = std::memcmp(lhs.key, rhs.key, std::min(lhs.key_size, rhs.key_size));
+    if (result != 0) return result < 0;
+    if (lhs.key_size != rhs.key_size) return lhs.key_size < rhs.key_size;
+    return lhs.row_id < rhs.row_id;
+  }
+};
+
+/**
+ * Creates the normalized keys for the first row_count rows of one input chunk. The keys are stored consecutively in
+ * key_buffer, rows receives one NormalizedKeyRow per row. Rows behind row_count are not accessed, so that callers can
+ * restrict the keys to a prefix of the chunk or ignore rows that were appended to a mutable chunk after its size was
+ * determined.
+ */
+void create_normalized_keys(const Table& table, const ChunkID chunk_id, const ChunkOffset row_count,
+                            const std::vector<SortColumnDefinition>& sort_definitions,
+                            std::vector<uint8_t>& key_buffer, NormalizedKeyRow* rows);
+
+/**
+ * Materializes all columns of input_table in the order given by sorted_rows into ValueSegments. The output chunks
+ * hold output_chunk_size rows at maximum, are materialized in parallel, and are finalized and marked as ordered by
+ * the given sort definition.
+ */
+std::shared_ptr<Table> materialize_sorted_rows(const std::shared_ptr<const Table>& input_table,
+                                               const std::vector<NormalizedKeyRow>& sorted_rows,
+                                               const ChunkOffset output_chunk_size,
+                                               const SortColumnDefinition& ordered_by);
+
+}  // namespace opossum
@@ -17,6 +17,7 @@
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
@@ -33,6 +34,7 @@
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
+#include "table_scan/conjunction_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "utils/assert.hpp"
 #include "utils/lossless_predicate_cast.hpp"
@@ -206,6 +208,34 @@ std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
 }
 
 std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
+  // Conjunctions (e.g., created by the LQPTranslator from chains of PredicateNodes) get one Impl per conjunct, so that
+  // the conjuncts can use the dedicated Impls and only scan the rows that passed the previous conjuncts.
+  auto conjuncts = std::vector<std::shared_ptr<AbstractExpression>>{};
+  _flatten_conjunction(_predicate, conjuncts);
+  if (conjuncts.size() == 1) return _create_impl(_predicate);
+
+  auto conjunct_impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+  conjunct_impls.reserve(conjuncts.size());
+  for (const auto& conjunct : conjuncts) {
+    conjunct_impls.emplace_back(_create_impl(conjunct));
+  }
+  return std::make_unique<ConjunctionTableScanImpl>(std::move(conjunct_impls));
+}
+
+void TableScan::_flatten_conjunction(const std::shared_ptr<AbstractExpression>& predicate,
+                                     std::vector<std::shared_ptr<AbstractExpression>>& conjuncts) {
+  // Unlike flatten_logical_expressions(), this keeps the conjuncts in the order in which they are written
+  const auto logical_expression = std::dynamic_pointer_cast<LogicalExpression>(predicate);
+  if (logical_expression && logical_expression->logical_operator == LogicalOperator::And) {
+    _flatten_conjunction(logical_expression->left_operand(), conjuncts);
+    _flatten_conjunction(logical_expression->right_operand(), conjuncts);
+  } else {
+    conjuncts.emplace_back(predicate);
+  }
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl(
+    const std::shared_ptr<AbstractExpression>& predicate) const {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -213,7 +243,7 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
    * an expression.
    */
 
-  auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+  auto resolved_predicate = _resolve_uncorrelated_subqueries(predicate);
 
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
@@ -28,7 +28,8 @@ class TableScan : public AbstractReadOnlyOperator {
   std::string description(DescriptionMode description_mode) const override;
 
   /**
-   * Create the TableScanImpl based on the predicate type. Public for testing purposes.
+   * Create the TableScanImpl based on the predicate type. Conjunctions are evaluated by a ConjunctionTableScanImpl.
+   * Public for testing purposes.
    */
   std::unique_ptr<AbstractTableScanImpl> create_impl() const;
 
@@ -65,6 +66,13 @@ class TableScan : public AbstractReadOnlyOperator {
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<AbstractExpression>& predicate);
 
+  // Collects the conjuncts of a (nested) AND expression from left to right
+  static void _flatten_conjunction(const std::shared_ptr<AbstractExpression>& predicate,
+                                   std::vector<std::shared_ptr<AbstractExpression>>& conjuncts);
+
+  // Creates the TableScanImpl for a predicate that is not a conjunction
+  std::unique_ptr<AbstractTableScanImpl> _create_impl(const std::shared_ptr<AbstractExpression>& predicate) const;
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
 
@@ -5,12 +5,14 @@
 #include <utility>
 
 #include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/split_pos_list_by_chunk_id.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/scan_compressed_vector_range.hpp"
 
 namespace opossum {
 
@@ -34,6 +36,43 @@ std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chun
   return matches;
 }
 
+std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chunk_with_selection(
+    const ChunkID chunk_id, const std::shared_ptr<const RowIDPosList>& selection) const {
+  DebugAssert(selection->references_single_chunk() && selection->common_chunk_id() == chunk_id,
+              "Selection has to reference the scanned chunk");
+
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  const auto& segment = chunk->get_segment(_column_id);
+
+  auto matches = std::make_shared<RowIDPosList>();
+
+  if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
+    // Scan a ReferenceSegment that only holds the selected positions of the original one
+    const auto& pos_list = *reference_segment->pos_list();
+    auto selected_pos_list = std::make_shared<RowIDPosList>();
+    selected_pos_list->reserve(selection->size());
+    for (const auto& row_id : *selection) {
+      selected_pos_list->emplace_back(pos_list[row_id.chunk_offset]);
+    }
+    if (pos_list.references_single_chunk()) {
+      selected_pos_list->guarantee_single_chunk();
+    }
+
+    const auto selected_segment = ReferenceSegment{reference_segment->referenced_table(),
+                                                   reference_segment->referenced_column_id(), selected_pos_list};
+    _scan_reference_segment(selected_segment, chunk_id, *matches);
+  } else {
+    _scan_non_reference_segment(*segment, chunk_id, *matches, selection);
+  }
+
+  // The Impls write positions within the selection into `matches`. Turn them into offsets within the chunk.
+  for (auto& match : *matches) {
+    match.chunk_offset = (*selection)[match.chunk_offset].chunk_offset;
+  }
+
+  return matches;
+}
+
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
                                                                       const ChunkID chunk_id,
                                                                       RowIDPosList& matches) const {
@@ -76,4 +115,20 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
   }
 }
 
+void AbstractDereferencedColumnTableScanImpl::_scan_attribute_vector_range(const BaseDictionarySegment& segment,
+                                                                           const ValueID lower_value_id,
+                                                                           const ValueID upper_value_id,
+                                                                           const ChunkID chunk_id,
+                                                                           RowIDPosList& matches) {
+  // Emits the set bits of each mask in ascending order
+  const auto emit_matches = [&](const size_t first_index, uint64_t mask) {
+    for (; mask; mask &= mask - 1u) {
+      const auto bit_index = static_cast<size_t>(__builtin_ctzll(mask));
+      matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_index + bit_index)});
+    }
+  };
+
+  scan_compressed_vector_range(*segment.attribute_vector(), lower_value_id, upper_value_id, emit_matches);
+}
+
 }  // namespace opossum
@@ -29,6 +29,10 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) const override;
 
+  // Only the selected rows are passed to the Impl, so that unselected rows are never accessed
+  std::shared_ptr<RowIDPosList> scan_chunk_with_selection(
+      const ChunkID chunk_id, const std::shared_ptr<const RowIDPosList>& selection) const override;
+
   const PredicateCondition predicate_condition;
 
  protected:
@@ -41,6 +45,16 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
   virtual void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                            const std::shared_ptr<const AbstractPosList>& position_filter) const = 0;
 
+  /**
+   * Adds all rows of a dictionary segment whose value ID lies within [lower_value_id, upper_value_id) to `matches`.
+   * The predicate is evaluated directly on the compressed attribute vector (see scan_compressed_vector_range), which
+   * is considerably faster than iterating over the decompressed value IDs. As the whole attribute vector is scanned,
+   * this is only applicable if there is no position filter.
+   */
+  static void _scan_attribute_vector_range(const BaseDictionarySegment& segment, const ValueID lower_value_id,
+                                           const ValueID upper_value_id, const ChunkID chunk_id,
+                                           RowIDPosList& matches);
+
   const std::shared_ptr<const Table> _in_table;
   const ColumnID _column_id;
 };
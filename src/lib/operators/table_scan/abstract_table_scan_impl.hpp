@@ -4,7 +4,11 @@
 #include <x86intrin.h>
 #endif
 
+#include <algorithm>
 #include <array>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "storage/pos_lists/rowid_pos_list.hpp"
 #include "storage/segment_iterables.hpp"
@@ -25,6 +29,35 @@ class AbstractTableScanImpl {
 
   virtual std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) const = 0;
 
+  /**
+   * Scans only the rows of the chunk that are part of the selection (e.g., the matches of a previous predicate) and
+   * returns those that match. The selection has to reference the given chunk only. By default, the entire chunk is
+   * scanned and the matches are intersected with the selection using a bitmap. Impls that can restrict their scan to
+   * the selected rows override this.
+   */
+  virtual std::shared_ptr<RowIDPosList> scan_chunk_with_selection(
+      const ChunkID chunk_id, const std::shared_ptr<const RowIDPosList>& selection) const {
+    const auto matches = scan_chunk(chunk_id);
+    if (matches->empty()) return matches;
+
+    const auto max_match = std::max_element(matches->cbegin(), matches->cend(), [](const auto& lhs, const auto& rhs) {
+      return lhs.chunk_offset < rhs.chunk_offset;
+    });
+    auto match_bitmap = std::vector<bool>(static_cast<size_t>(max_match->chunk_offset) + 1);
+    for (const auto& match : *matches) {
+      match_bitmap[match.chunk_offset] = true;
+    }
+
+    auto selected_matches = std::make_shared<RowIDPosList>();
+    selected_matches->reserve(std::min(matches->size(), selection->size()));
+    for (const auto& row_id : *selection) {
+      if (row_id.chunk_offset < match_bitmap.size() && match_bitmap[row_id.chunk_offset]) {
+        selected_matches->emplace_back(row_id);
+      }
+    }
+    return selected_matches;
+  }
+
  protected:
   /**
    * @defgroup The hot loop of the table scan
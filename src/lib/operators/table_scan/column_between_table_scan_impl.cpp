@@ -125,6 +125,12 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     upper_bound_value_id = segment.unique_values_count();
   }
 
+  // Without a position filter, the range can be evaluated directly on the compressed attribute vector
+  if (!position_filter) {
+    _scan_attribute_vector_range(segment, lower_bound_value_id, upper_bound_value_id, chunk_id, matches);
+    return;
+  }
+
   const auto value_id_diff = upper_bound_value_id - lower_bound_value_id;
   const auto comparator = [lower_bound_value_id, value_id_diff](const auto& position) {
     // Using < here because the right value id is the upper_bound. Also, because the value ids are integers, we can do
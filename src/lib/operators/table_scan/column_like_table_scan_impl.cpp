@@ -12,6 +12,7 @@
 
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/segment_encoding_utils.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
@@ -24,18 +25,31 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       _matcher{pattern},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {}
+      _invert_results(predicate_condition == PredicateCondition::NotLike),
+      _prefix(_invert_results ? std::nullopt : _matcher.prefix()),
+      _shared_dictionary_segment(find_shared_dictionary_segment(*in_table, column_id)) {}
 
 std::string ColumnLikeTableScanImpl::description() const { return "ColumnLike"; }
 
 void ColumnLikeTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment);
+  if (!dictionary_segment) {
+    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+    return;
+  }
+
+  // Prefix patterns only require two binary searches in the dictionary
+  if (_prefix) {
+    _scan_dictionary_segment_for_prefix(*dictionary_segment, chunk_id, matches, position_filter);
+    return;
+  }
+
   // For dictionary segments where the number of unique values is not higher than the number of (potentially filtered)
-  // input rows, use an optimized implementation.
-  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment);
-      dictionary_segment &&
-      (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
+  // input rows, use an optimized implementation. The matches of a shared dictionary are only computed once anyway.
+  if (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size() ||
+      (_shared_dictionary_segment && dictionary_segment->shares_dictionary_with(*_shared_dictionary_segment))) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
@@ -71,18 +85,20 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(
   // First, build a bitmap containing 1s/0s for matching/non-matching dictionary values. Second, iterate over the
   // attribute vector and check against the bitmap. If too many input rows have already been removed (are not part of
   // position_filter), this optimization is detrimental. See caller for that case.
-  std::pair<size_t, std::vector<bool>> result;
+  auto segment_result = std::pair<size_t, std::vector<bool>>{};
+  const auto* result = &segment_result;
 
-  if (segment.encoding_type() == EncodingType::Dictionary) {
-    const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
+  if (_shared_dictionary_segment && segment.shares_dictionary_with(*_shared_dictionary_segment)) {
+    std::call_once(_shared_dictionary_matches_flag, [&]() {
+      _shared_dictionary_matches = _find_matches_in_dictionary_segment(*_shared_dictionary_segment);
+    });
+    result = &_shared_dictionary_matches;
   } else {
-    const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
+    segment_result = _find_matches_in_dictionary_segment(segment);
   }
 
-  const auto& match_count = result.first;
-  const auto& dictionary_matches = result.second;
+  const auto& match_count = result->first;
+  const auto& dictionary_matches = result->second;
 
   auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
 
@@ -110,6 +126,61 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(
   });
 }
 
+void ColumnLikeTableScanImpl::_scan_dictionary_segment_for_prefix(
+    const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  // The matching strings are those in [prefix, successor), where the successor is the smallest string greater than all
+  // strings starting with the prefix. It is built by dropping trailing '\xFF' characters and incrementing the last
+  // remaining one (strings are compared as unsigned chars). If nothing remains, there is no upper bound.
+  auto successor = *_prefix;
+  while (!successor.empty() && static_cast<unsigned char>(successor.back()) == 0xFFu) {
+    successor.pop_back();
+  }
+
+  const auto lower_value_id = segment.lower_bound(AllTypeVariant{*_prefix});
+  auto upper_value_id = INVALID_VALUE_ID;
+  if (!successor.empty()) {
+    successor.back() = static_cast<char>(static_cast<unsigned char>(successor.back()) + 1u);
+    upper_value_id = segment.lower_bound(AllTypeVariant{successor});
+  }
+
+  // Exclude NULLs, which are represented by the null_value_id()
+  if (upper_value_id == INVALID_VALUE_ID) {
+    upper_value_id = segment.null_value_id();
+  }
+
+  // LIKE matches no rows
+  if (lower_value_id == INVALID_VALUE_ID || lower_value_id >= upper_value_id) {
+    return;
+  }
+
+  if (!position_filter) {
+    _scan_attribute_vector_range(segment, lower_value_id, upper_value_id, chunk_id, matches);
+    return;
+  }
+
+  const auto value_id_diff = upper_value_id - lower_value_id;
+  const auto comparator = [lower_value_id, value_id_diff](const auto& position) {
+    // See ColumnBetweenTableScanImpl for the range check
+    return (position.value() - lower_value_id) < value_id_diff;
+  };
+
+  create_iterable_from_attribute_vector(segment).with_iterators(position_filter, [&](auto it, auto end) {
+    _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary_segment(
+    const BaseDictionarySegment& segment) const {
+  if (segment.encoding_type() == EncodingType::Dictionary) {
+    const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
+    return _find_matches_in_dictionary(*typed_segment.dictionary());
+  }
+
+  const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
+  return _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
+}
+
 template <typename D>
 std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
   auto result = std::pair<size_t, std::vector<bool>>{};
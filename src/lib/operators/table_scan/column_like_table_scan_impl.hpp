@@ -2,6 +2,8 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
@@ -25,6 +27,10 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For LIKE with a prefix pattern (e.g., 'abc%') on dictionary segments, the matching strings form a value ID range,
+ *   which we look up in the sorted dictionary instead of checking every dictionary entry.
+ * - If the column's segments share a single dictionary (see ChunkEncoder::encode_column_with_shared_dictionary), the
+ *   dictionary entries are only checked once for all chunks.
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -45,10 +51,16 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter) const;
 
+  void _scan_dictionary_segment_for_prefix(const BaseDictionarySegment& segment, const ChunkID chunk_id,
+                                           RowIDPosList& matches,
+                                           const std::shared_ptr<const AbstractPosList>& position_filter) const;
+
   /**
    * Used for dictionary segments
    * @returns number of matches and the result of each dictionary entry
    */
+  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary_segment(const BaseDictionarySegment& segment) const;
+
   template <typename D>
   std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const D& dictionary) const;
 
@@ -56,6 +68,14 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
 
   // For NOT LIKE support
   const bool _invert_results;
+
+  // Set for LIKE (but not NOT LIKE) with a StartsWithPattern
+  const std::optional<pmr_string> _prefix;
+
+  // Set if all scanned dictionary segments share a single dictionary. Its matches are computed once, on first use.
+  const std::shared_ptr<const BaseDictionarySegment> _shared_dictionary_segment;
+  mutable std::once_flag _shared_dictionary_matches_flag;
+  mutable std::pair<size_t, std::vector<bool>> _shared_dictionary_matches;
 };
 
 }  // namespace opossum
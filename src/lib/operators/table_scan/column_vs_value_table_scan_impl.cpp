@@ -120,6 +120,15 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  // Without a position filter, the whole attribute vector is scanned. In that case, all predicates but NotEquals can
+  // be evaluated as a value ID range directly on the compressed attribute vector. The NULL value ID (i.e.,
+  // null_value_id()) lies outside of all these ranges.
+  if (!position_filter && predicate_condition != PredicateCondition::NotEquals) {
+    const auto [lower_value_id, upper_value_id] = _get_search_value_id_range(segment, search_value_id);
+    _scan_attribute_vector_range(segment, lower_value_id, upper_value_id, chunk_id, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -180,6 +189,25 @@ ValueID ColumnVsValueTableScanImpl::_get_search_value_id(const BaseDictionarySeg
   }
 }
 
+std::pair<ValueID, ValueID> ColumnVsValueTableScanImpl::_get_search_value_id_range(
+    const BaseDictionarySegment& segment, const ValueID search_value_id) const {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      return {search_value_id, ValueID{search_value_id + 1u}};
+
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      return {ValueID{0u}, search_value_id};
+
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return {search_value_id, segment.null_value_id()};
+
+    default:
+      Fail("Predicate condition cannot be expressed as a single value ID range");
+  }
+}
+
 bool ColumnVsValueTableScanImpl::_value_matches_all(const BaseDictionarySegment& segment,
                                                     const ValueID search_value_id) const {
   switch (predicate_condition) {
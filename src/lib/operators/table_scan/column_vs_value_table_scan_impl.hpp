@@ -51,6 +51,10 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
 
   ValueID _get_search_value_id(const BaseDictionarySegment& segment) const;
 
+  // Returns [lower, upper) so that a value ID matches iff it lies within this range. Not available for NotEquals.
+  std::pair<ValueID, ValueID> _get_search_value_id_range(const BaseDictionarySegment& segment,
+                                                         const ValueID search_value_id) const;
+
   bool _value_matches_all(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
 
   bool _value_matches_none(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
@@ -0,0 +1,49 @@
+#include "conjunction_table_scan_impl.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ConjunctionTableScanImpl::ConjunctionTableScanImpl(
+    std::vector<std::unique_ptr<AbstractTableScanImpl>>&& init_conjunct_impls)
+    : conjunct_impls(std::move(init_conjunct_impls)) {
+  Assert(conjunct_impls.size() > 1, "Expected at least two conjuncts");
+}
+
+std::string ConjunctionTableScanImpl::description() const {
+  auto description = std::string{"Conjunction("};
+  for (auto conjunct_idx = size_t{0}; conjunct_idx < conjunct_impls.size(); ++conjunct_idx) {
+    if (conjunct_idx > 0) description += ", ";
+    description += conjunct_impls[conjunct_idx]->description();
+  }
+  return description + ")";
+}
+
+std::shared_ptr<RowIDPosList> ConjunctionTableScanImpl::scan_chunk(const ChunkID chunk_id) const {
+  return _scan_remaining_conjuncts(chunk_id, conjunct_impls.front()->scan_chunk(chunk_id));
+}
+
+std::shared_ptr<RowIDPosList> ConjunctionTableScanImpl::scan_chunk_with_selection(
+    const ChunkID chunk_id, const std::shared_ptr<const RowIDPosList>& selection) const {
+  return _scan_remaining_conjuncts(chunk_id, conjunct_impls.front()->scan_chunk_with_selection(chunk_id, selection));
+}
+
+std::shared_ptr<RowIDPosList> ConjunctionTableScanImpl::_scan_remaining_conjuncts(
+    const ChunkID chunk_id, std::shared_ptr<RowIDPosList> matches) const {
+  for (auto conjunct_idx = size_t{1}; conjunct_idx < conjunct_impls.size(); ++conjunct_idx) {
+    if (matches->empty()) break;
+
+    // All matches lie within the scanned chunk
+    matches->guarantee_single_chunk();
+    matches = conjunct_impls[conjunct_idx]->scan_chunk_with_selection(chunk_id, matches);
+  }
+
+  return matches;
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_table_scan_impl.hpp"
+
+namespace opossum {
+
+/**
+ * Evaluates a conjunction of predicates (e.g., `a < 5 AND b = 'x' AND c BETWEEN 1 AND 9`) chunk by chunk, with one
+ * Impl per conjunct. The matches of a conjunct are the selection of the next one, so that later conjuncts only look
+ * at rows that passed all previous ones. Once the selection of a chunk is empty, the remaining conjuncts are skipped.
+ * Compared to a chain of TableScans, no intermediate reference tables are created and later predicates do not access
+ * their values through ReferenceSegments.
+ */
+class ConjunctionTableScanImpl : public AbstractTableScanImpl {
+ public:
+  explicit ConjunctionTableScanImpl(std::vector<std::unique_ptr<AbstractTableScanImpl>>&& init_conjunct_impls);
+
+  std::string description() const override;
+
+  std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) const override;
+
+  std::shared_ptr<RowIDPosList> scan_chunk_with_selection(
+      const ChunkID chunk_id, const std::shared_ptr<const RowIDPosList>& selection) const override;
+
+  // In the order of their evaluation
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>> conjunct_impls;
+
+ private:
+  // Filters the matches of the first conjunct by all others
+  std::shared_ptr<RowIDPosList> _scan_remaining_conjuncts(const ChunkID chunk_id,
+                                                          std::shared_ptr<RowIDPosList> matches) const;
+};
+
+}  // namespace opossum
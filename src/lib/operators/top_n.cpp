@@ -0,0 +1,188 @@
+#include "top_n.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/normalized_keys.hpp"
+#include "storage/segment_accessor.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TopN::TopN(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopN, in),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::string& TopN::name() const {
+  static const auto name = std::string{"TopN"};
+  return name;
+}
+
+std::string TopN::description(DescriptionMode description_mode) const {
+  std::stringstream stream;
+  stream << "[" << name() << "] " << _row_count_expression->as_column_name() << " rows by ColumnIDs: ";
+  for (auto definition_idx = size_t{0}; definition_idx < _sort_definitions.size(); ++definition_idx) {
+    stream << _sort_definitions[definition_idx].column << " (" << _sort_definitions[definition_idx].order_by_mode
+           << ")";
+    if (definition_idx + 1 < _sort_definitions.size()) stream << ", ";
+  }
+  return stream.str();
+}
+
+const std::vector<SortColumnDefinition>& TopN::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopN::row_count_expression() const { return _row_count_expression; }
+
+std::shared_ptr<AbstractOperator> TopN::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopN>(copied_input_left, _sort_definitions, _row_count_expression->deep_copy());
+}
+
+void TopN::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopN::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopN::_on_execute() {
+  const auto input_table = input_table_left();
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column < input_table->column_count(),
+           "TopN: Column ID is greater than table's column count");
+  }
+
+  const auto row_count = _row_count();
+  const auto compare = NormalizedKeyRowLess{};
+
+  // 1. Select the candidates of every chunk, one JobTask per input chunk
+  const auto chunk_count = input_table->chunk_count();
+  auto key_buffers = std::vector<std::vector<uint8_t>>(chunk_count);
+  auto candidates_by_chunk = std::vector<std::vector<NormalizedKeyRow>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && row_count > 0; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    // Determine the size once, as the chunk might be mutable
+    const auto chunk_size = chunk->size();
+    if (chunk_size == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id, chunk_size]() {
+      auto& candidates = candidates_by_chunk[chunk_id];
+      auto& key_buffer = key_buffers[chunk_id];
+
+      candidates.resize(_candidate_count(*chunk, chunk_size, row_count));
+      create_normalized_keys(*input_table, chunk_id, static_cast<ChunkOffset>(candidates.size()), _sort_definitions,
+                             key_buffer, candidates.data());
+      if (candidates.size() <= row_count) return;
+
+      std::partial_sort(candidates.begin(), candidates.begin() + row_count, candidates.end(), compare);
+      candidates.resize(row_count);
+
+      // Copy the keys of the remaining candidates so that the keys of the dropped rows are freed before the merge
+      auto candidate_key_size = size_t{0};
+      for (const auto& candidate : candidates) {
+        candidate_key_size += candidate.key_size;
+      }
+
+      auto candidate_key_buffer = std::vector<uint8_t>(candidate_key_size);
+      auto* key = candidate_key_buffer.data();
+      for (auto& candidate : candidates) {
+        std::copy(candidate.key, candidate.key + candidate.key_size, key);
+        candidate.key = key;
+        key += candidate.key_size;
+      }
+      key_buffer = std::move(candidate_key_buffer);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // 2. Merge the candidates of all chunks. Each chunk contributes at most row_count candidates.
+  auto rows = std::vector<NormalizedKeyRow>{};
+  for (const auto& candidates : candidates_by_chunk) {
+    rows.insert(rows.end(), candidates.begin(), candidates.end());
+  }
+
+  const auto output_row_count = std::min(row_count, rows.size());
+  std::partial_sort(rows.begin(), rows.begin() + output_row_count, rows.end(), compare);
+  rows.resize(output_row_count);
+
+  // 3. Materialize the output
+  return materialize_sorted_rows(input_table, rows, Chunk::DEFAULT_SIZE, _sort_definitions[0]);
+}
+
+size_t TopN::_row_count() const {
+  auto row_count = size_t{};
+
+  resolve_data_type(_row_count_expression->data_type(), [&](const auto data_type_t) {
+    using RowCountDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (std::is_integral_v<RowCountDataType>) {
+      const auto row_count_expression_result =
+          ExpressionEvaluator{}.evaluate_expression_to_result<RowCountDataType>(*_row_count_expression);
+      Assert(row_count_expression_result->size() == 1, "Expected exactly one row for TopN");
+      Assert(!row_count_expression_result->is_null(0), "Expected non-null for TopN");
+
+      const auto signed_row_count = row_count_expression_result->value(0);
+      Assert(signed_row_count >= 0, "Can't TopN to a negative number of Rows");
+
+      row_count = static_cast<size_t>(signed_row_count);
+    } else {
+      Fail("Non-integral types not allowed in TopN");
+    }
+  });
+
+  return row_count;
+}
+
+ChunkOffset TopN::_candidate_count(const Chunk& chunk, const ChunkOffset chunk_size, const size_t row_count) const {
+  if (row_count >= chunk_size) return chunk_size;
+
+  const auto& first_sort_definition = _sort_definitions.front();
+  const auto& ordered_by = chunk.ordered_by();
+  if (!ordered_by || ordered_by->first != first_sort_definition.column ||
+      ordered_by->second != first_sort_definition.order_by_mode) {
+    return chunk_size;
+  }
+
+  // With a single sort definition, rows with equal values are ordered by their RowID. Thus, no row behind the first
+  // row_count rows can precede any of them.
+  auto candidate_count = static_cast<ChunkOffset>(row_count);
+  if (_sort_definitions.size() == 1) return candidate_count;
+
+  // Otherwise, the subsequent sort definitions decide about the order of rows that have the same value in the first
+  // sort column as the last of the first row_count rows
+  resolve_data_type(input_table_left()->column_data_type(first_sort_definition.column), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto accessor = create_segment_accessor<ColumnDataType>(chunk.get_segment(first_sort_definition.column));
+    const auto last_value = accessor->access(candidate_count - 1);
+    while (candidate_count < chunk_size && accessor->access(candidate_count) == last_value) {
+      ++candidate_count;
+    }
+  });
+
+  return candidate_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "operators/sort.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first n rows of its input in the order defined by the sort definitions, i.e., the same
+ * result as a Sort followed by a Limit, but without sorting the entire input. The LQPTranslator creates it for
+ * TopNNodes, which replace a SortNode and a LimitNode (see SortLimitFusionRule).
+ *
+ * Every input chunk is processed by a JobTask that creates the normalized keys (see sort/normalized_keys.hpp) of the
+ * chunk's rows and selects the n smallest ones using a bounded heap selection (std::partial_sort). If a chunk is
+ * ordered by the first sort definition, only its first n rows (plus those that tie with the n-th row in the first
+ * sort column) can be part of the result, so that the remaining rows are never accessed. Finally, the candidates of
+ * all chunks are merged and materialized.
+ */
+class TopN : public AbstractReadOnlyOperator {
+ public:
+  TopN(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  // Evaluates the row_count_expression
+  size_t _row_count() const;
+
+  // Returns the number of rows at the beginning of the chunk that can be part of the result (see class comment)
+  ChunkOffset _candidate_count(const Chunk& chunk, const ChunkOffset chunk_size, const size_t row_count) const;
+
+ private:
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  std::shared_ptr<AbstractExpression> _row_count_expression;
+};
+
+}  // namespace opossum
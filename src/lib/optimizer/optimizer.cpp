@@ -21,6 +21,7 @@
 #include "strategy/predicate_reordering_rule.hpp"
 #include "strategy/predicate_split_up_rule.hpp"
 #include "strategy/semi_join_reduction_rule.hpp"
+#include "strategy/sort_limit_fusion_rule.hpp"
 #include "strategy/subquery_to_join_rule.hpp"
 
 /**
@@ -144,6 +145,9 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Fuse Sort and Limit into a TopN last, so that no other rule needs to know about TopNNodes
+  optimizer->add_rule(std::make_unique<SortLimitFusionRule>());
+
   return optimizer;
 }
 
@@ -265,6 +269,7 @@ void Optimizer::validate_lqp(const std::shared_ptr<AbstractLQPNode>& root_node)
         case LQPNodeType::Projection:
         case LQPNodeType::Root:
         case LQPNodeType::Sort:
+        case LQPNodeType::TopN:
         case LQPNodeType::Validate:
           num_expected_inputs = 1;
           break;
@@ -0,0 +1,37 @@
+#include "sort_limit_fusion_rule.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
+
+namespace opossum {
+
+void SortLimitFusionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  // Collect the LimitNodes first, as modifying the LQP while visiting it is not safe
+  auto limit_nodes = std::vector<std::shared_ptr<LimitNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Limit) limit_nodes.emplace_back(std::static_pointer_cast<LimitNode>(node));
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& limit_node : limit_nodes) {
+    auto node = limit_node->left_input();
+    while (node->type == LQPNodeType::Projection && node->output_count() == 1) {
+      node = node->left_input();
+    }
+    if (node->type != LQPNodeType::Sort || node->output_count() != 1) continue;
+
+    const auto sort_node = std::static_pointer_cast<SortNode>(node);
+    const auto top_n_node =
+        TopNNode::make(sort_node->node_expressions, sort_node->order_by_modes, limit_node->num_rows_expression());
+
+    lqp_replace_node(sort_node, top_n_node);
+    lqp_remove_node(limit_node);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Fuses a LimitNode and the SortNode below it into a TopNNode, so that the first rows of the sorted input are
+ * determined without sorting the entire input (see the TopN operator). The SQLTranslator places a ProjectionNode that
+ * removes columns only needed for sorting between the two nodes. As such ProjectionNodes are evaluated row by row, the
+ * rule skips them and keeps them on top of the TopNNode.
+ *
+ * EXAMPLE:
+ *           |                        |
+ *       Limit(10)               Projection(a)
+ *           |                        |
+ *     Projection(a)    ----->   TopN(10, b)
+ *           |                        |
+ *        Sort(b)                   Table
+ *           |
+ *         Table
+ *
+ * Nodes between the LimitNode and the SortNode (including the latter) must not have other outputs, as these would
+ * still need the full sorted input.
+ */
+class SortLimitFusionRule : public AbstractRule {
+ public:
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+};
+
+}  // namespace opossum
@@ -13,6 +13,18 @@
 
 #include "utils/assert.hpp"
 
+namespace {
+
+/**
+ * The task that is currently executed on this thread, if any. Used to pass the scheduling class on to the tasks that
+ * it schedules.
+ */
+thread_local const opossum::AbstractTask* this_thread_task = nullptr;
+
+std::atomic<opossum::TaskGroupID> next_task_group_id{opossum::DEFAULT_TASK_GROUP_ID + 1};
+
+}  // namespace
+
 namespace opossum {
 
 AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
@@ -49,8 +61,29 @@ const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() con
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
+void AbstractTask::set_scheduling_class(SchedulingClass scheduling_class, TaskGroupID task_group_id) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the scheduling class after the Task was scheduled");
+
+  _scheduling_class = scheduling_class;
+  _task_group_id = task_group_id;
+  _has_explicit_scheduling_class = true;
+}
+
+SchedulingClass AbstractTask::scheduling_class() const { return _scheduling_class; }
+
+TaskGroupID AbstractTask::task_group_id() const { return _task_group_id; }
+
+TaskGroupID AbstractTask::create_task_group_id() {
+  auto task_group_id = next_task_group_id++;
+  // Skip the default group when the counter wraps around.
+  if (task_group_id == DEFAULT_TASK_GROUP_ID) task_group_id = next_task_group_id++;
+  return task_group_id;
+}
+
 bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
 
+bool AbstractTask::try_mark_as_assigned_to_worker() { return !_is_assigned_to_worker.exchange(true); }
+
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
 
@@ -66,6 +99,11 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
   // _done_condition_variable.
   std::atomic_thread_fence(std::memory_order_seq_cst);
 
+  if (!_has_explicit_scheduling_class && ::this_thread_task) {
+    _scheduling_class = ::this_thread_task->_scheduling_class;
+    _task_group_id = ::this_thread_task->_task_group_id;
+  }
+
   _mark_as_scheduled();
 
   Hyrise::get().scheduler()->schedule(shared_from_this(), preferred_node_id, _priority);
@@ -91,7 +129,19 @@ void AbstractTask::execute() {
   // spawned the task are pushed down to a point where this thread is already running.
   Assert(_is_scheduled, "Task should be have been scheduled before being executed");
 
-  _on_execute();
+  // Tasks might be executed in a nested fashion (e.g., by a worker that waits for other tasks), so the previously
+  // executed task has to be restored afterwards - even if _on_execute() throws.
+  {
+    const auto* const previous_task = ::this_thread_task;
+    ::this_thread_task = this;
+    try {
+      _on_execute();
+    } catch (...) {
+      ::this_thread_task = previous_task;
+      throw;
+    }
+    ::this_thread_task = previous_task;
+  }
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -124,7 +174,7 @@ void AbstractTask::_on_predecessor_done() {
       // the sake of a clearly defined life cycle, we wait for the task to be scheduled.
       if (!_is_scheduled) return;
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      worker->push_ready_task(shared_from_this(), SchedulePriority::High);
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
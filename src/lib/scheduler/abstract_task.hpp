@@ -79,6 +79,21 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The scheduling class and the task group decide how the TaskQueue shares the workers between this task and the
+   * tasks of concurrently executed queries. Tasks for which no class was set inherit the class and group of the task
+   * that schedules them (e.g., the JobTasks spawned by an operator), all other tasks use SchedulingClass::Default.
+   */
+  void set_scheduling_class(SchedulingClass scheduling_class, TaskGroupID task_group_id);
+  SchedulingClass scheduling_class() const;
+  TaskGroupID task_group_id() const;
+
+  /**
+   * Returns a new id for tasks that belong together, e.g., those of an SQL statement. Never returns
+   * DEFAULT_TASK_GROUP_ID, which is left to tasks that are not part of any group.
+   */
+  static TaskGroupID create_task_group_id();
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -102,6 +117,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool try_mark_as_enqueued();
 
+  /**
+   * Returns true whether the caller is atomically the first to claim this task for execution, false otherwise.
+   * A task might be executed by a worker that waits for it (see Worker::_wait_for_tasks) while it is still contained in
+   * a TaskQueue. Whoever pulls the task from the queue afterwards has to skip it.
+   */
+  bool try_mark_as_assigned_to_worker();
+
   /**
    * Executes the task in the current Thread, blocks until all operations are finished
    */
@@ -130,6 +152,9 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
+  SchedulingClass _scheduling_class{SchedulingClass::Default};
+  TaskGroupID _task_group_id{DEFAULT_TASK_GROUP_ID};
+  bool _has_explicit_scheduling_class{false};
   std::atomic<bool> _stealable;
   std::atomic_bool _done{false};
   std::function<void()> _done_callback;
@@ -145,6 +170,10 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic_bool _is_enqueued{false};
   std::atomic_bool _is_scheduled{false};
 
+  // For making sure that only one worker executes the task, even if it is still enqueued when a waiting worker decides
+  // to execute it
+  std::atomic_bool _is_assigned_to_worker{false};
+
   // For making Tasks join()-able
   std::condition_variable _done_condition_variable;
   std::mutex _done_mutex;
@@ -66,10 +66,13 @@ void NodeQueueScheduler::wait_for_all_tasks() {
 void NodeQueueScheduler::finish() {
   wait_for_all_tasks();
 
-  // All queues SHOULD be empty by now
+  // All queues SHOULD be empty by now. Tasks that were executed by workers waiting for them (see
+  // Worker::_wait_for_tasks) might still be enqueued, but they are dropped by pull().
   if (HYRISE_DEBUG) {
     for ([[maybe_unused]] auto& queue : _queues) {
-      DebugAssert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
+      [[maybe_unused]] const auto remaining_task = queue->pull();
+      DebugAssert(!remaining_task && queue->empty(),
+                  "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
   }
 
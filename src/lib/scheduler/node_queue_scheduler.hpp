@@ -34,11 +34,11 @@ namespace opossum {
  *
  * JobTasks can be used from anywhere to parallelize parts of their work.
  * If a task spawns jobs to be executed, the worker executing the main task waits for the jobs to complete.
- * Since the CPU to which the worker is pinned shall not be blocked, a new worker is (re-)activated temporarily.
- * The worker executing the main task is hibernated and will be re-activated once the jobs have completed.
- * There is only one active worker per CPU, which is allowed to pull new tasks from the queue.
- * Thus, while it is possible that two workers are executing a task at the same time, this is only until the non-active
- * worker finished its task. It will then be hibernated.
+ * Since the CPU to which the worker is pinned shall not be blocked, the waiting worker helps with the execution: It
+ * executes those jobs that are ready and were not yet picked up by other workers itself. Only when none of the jobs can
+ * be executed anymore, it processes other tasks from the queues until the jobs have completed. As jobs might thus be
+ * executed while they are still enqueued, workers skip tasks that were already assigned to another worker when pulling
+ * from a queue (see AbstractTask::try_mark_as_assigned_to_worker).
  *
  *
  * SCHEDULER AND TOPOLOGY
@@ -2,17 +2,56 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "abstract_task.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Smooth weighted round-robin (as used by nginx): Within one round, every class is chosen as often as its weight says,
+ * but the choices are interleaved (e.g., I D I I D I B I D I I D I for weights 8, 4, 1) so that no class has to wait
+ * for a long run of another class.
+ */
+std::vector<uint32_t> create_scheduling_class_order() {
+  const auto& weights = TaskQueue::SCHEDULING_CLASS_WEIGHTS;
+
+  auto total_weight = int64_t{0};
+  for (const auto weight : weights) total_weight += weight;
+
+  auto order = std::vector<uint32_t>{};
+  order.reserve(total_weight);
+
+  auto current_weights = std::array<int64_t, TaskQueue::NUM_SCHEDULING_CLASSES>{};
+  for (auto step = int64_t{0}; step < total_weight; ++step) {
+    auto chosen_class = uint32_t{0};
+    for (auto class_index = uint32_t{0}; class_index < TaskQueue::NUM_SCHEDULING_CLASSES; ++class_index) {
+      current_weights[class_index] += weights[class_index];
+      if (current_weights[class_index] > current_weights[chosen_class]) chosen_class = class_index;
+    }
+    current_weights[chosen_class] -= total_weight;
+    order.emplace_back(chosen_class);
+  }
+
+  return order;
+}
+
+}  // namespace
+
 namespace opossum {
 
 TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
 bool TaskQueue::empty() const {
-  for (const auto& queue : _queues) {
-    if (!queue.empty()) return false;
+  for (const auto& scheduling_class : _scheduling_classes) {
+    for (const auto& lane : scheduling_class.lanes) {
+      for (const auto& queue : lane) {
+        if (!queue.empty()) return false;
+      }
+    }
   }
   return true;
 }
@@ -26,32 +65,75 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+
+  const auto class_index = static_cast<uint32_t>(task->scheduling_class());
+  DebugAssert(class_index < NUM_SCHEDULING_CLASSES, "Illegal scheduling class");
+  auto& scheduling_class = _scheduling_classes[class_index];
+
+  scheduling_class.num_tasks[priority].fetch_add(1, std::memory_order_relaxed);
+  scheduling_class.lanes[task->task_group_id() % NUM_LANES_PER_SCHEDULING_CLASS][priority].push(task);
 
   new_task.notify_one();
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::pull() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      return task;
-    }
-  }
-  return nullptr;
-}
+std::shared_ptr<AbstractTask> TaskQueue::pull() { return _take_task(false); }
 
-std::shared_ptr<AbstractTask> TaskQueue::steal() {
+std::shared_ptr<AbstractTask> TaskQueue::steal() { return _take_task(true); }
+
+std::shared_ptr<AbstractTask> TaskQueue::_take_task(const bool stealable_only) {
+  static const auto scheduling_class_order = create_scheduling_class_order();
+
+  const auto round = _round.fetch_add(1, std::memory_order_relaxed);
+  const auto first_class_index = scheduling_class_order[round % scheduling_class_order.size()];
+
+  // Tasks with SchedulePriority::High are taken before all others, regardless of their class and lane
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        return task;
-      } else {
-        queue.push(task);
+  for (auto priority = uint32_t{0}; priority < NUM_PRIORITY_LEVELS; ++priority) {
+    for (auto attempt = uint32_t{0}; attempt <= NUM_SCHEDULING_CLASSES; ++attempt) {
+      // First, try the class whose turn it is. If it has no tasks, fall back to the other classes in the order of
+      // their importance.
+      const auto class_index = attempt == 0 ? first_class_index : attempt - 1;
+      if (attempt > 0 && class_index == first_class_index) continue;
+
+      auto& scheduling_class = _scheduling_classes[class_index];
+      auto& num_tasks = scheduling_class.num_tasks[priority];
+      if (num_tasks.load(std::memory_order_relaxed) <= 0) continue;
+
+      const auto first_lane_index = scheduling_class.next_lane.load(std::memory_order_relaxed);
+      for (auto lane_offset = uint32_t{0}; lane_offset < NUM_LANES_PER_SCHEDULING_CLASS; ++lane_offset) {
+        const auto lane_index = (first_lane_index + lane_offset) % NUM_LANES_PER_SCHEDULING_CLASS;
+        auto& queue = scheduling_class.lanes[lane_index][priority];
+
+        auto found_task = false;
+        if (stealable_only) {
+          if (!queue.try_pop(task)) continue;
+
+          if (!task->is_stealable()) {
+            queue.push(task);
+            continue;
+          }
+
+          num_tasks.fetch_sub(1, std::memory_order_relaxed);
+          found_task = task->try_mark_as_assigned_to_worker();
+        } else {
+          while (!found_task && queue.try_pop(task)) {
+            num_tasks.fetch_sub(1, std::memory_order_relaxed);
+
+            // The task might have been executed by a worker waiting for it in the meantime.
+            found_task = task->try_mark_as_assigned_to_worker();
+          }
+        }
+
+        if (found_task) {
+          // The next pull from this class starts at the following lane. Concurrent pulls might overwrite each other's
+          // position, which only makes the round-robin slightly less accurate.
+          scheduling_class.next_lane.store(lane_index + 1, std::memory_order_relaxed);
+          return task;
+        }
       }
     }
   }
+
   return nullptr;
 }
 
@@ -15,10 +15,34 @@ class AbstractTask;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * FAIR SHARING
+ *
+ * Internally, tasks are distributed across lanes, one set of lanes per SchedulingClass. The tasks of a task group
+ * (usually an SQL statement) always end up in the same lane. On every pull, a scheduling class is chosen by weighted
+ * round-robin (see SCHEDULING_CLASS_WEIGHTS), and within that class, the next non-empty lane is served. If the chosen
+ * class has no tasks, the other classes are tried in the order of their importance, so that no worker idles while
+ * there is work. Tasks with SchedulePriority::High are taken before all other tasks, regardless of their class.
+ *
+ * As a result, a long-running query with thousands of JobTasks does not delay a short query that is scheduled after
+ * it: If both are in the same class, they alternate (unless their groups share a lane), and if the short query is
+ * Interactive, it receives most of the pulls.
+ *
+ * Scheduling classes are only honoured for tasks in a TaskQueue. The WorkStealingScheduler puts tasks that are
+ * scheduled by its workers into the workers' deques, which are processed in LIFO order regardless of the class.
  */
 class TaskQueue {
  public:
   static constexpr uint32_t NUM_PRIORITY_LEVELS = 2;
+  static constexpr uint32_t NUM_SCHEDULING_CLASSES = 3;
+
+  // Task groups are mapped to lanes by their id. Groups that map to the same lane share its slot in the round-robin. As
+  // group ids are assigned sequentially, concurrent groups only share a lane if far more than this many statements are
+  // executed at the same time.
+  static constexpr uint32_t NUM_LANES_PER_SCHEDULING_CLASS = 64;
+
+  // Number of pulls that a scheduling class receives per round if all classes have tasks, indexed by SchedulingClass.
+  static constexpr std::array<uint32_t, NUM_SCHEDULING_CLASSES> SCHEDULING_CLASS_WEIGHTS{{8, 4, 1}};
 
   explicit TaskQueue(NodeID node_id);
 
@@ -29,12 +53,14 @@ class TaskQueue {
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from the queue
+   * Returns a Tasks that is ready to be executed and removes it from the queue. The task is marked as assigned to the
+   * calling worker. Tasks that were already assigned to another worker are dropped from the queue.
    */
   std::shared_ptr<AbstractTask> pull();
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues. As with pull(), the
+   * task is marked as assigned to the calling worker.
    */
   std::shared_ptr<AbstractTask> steal();
 
@@ -49,8 +75,27 @@ class TaskQueue {
   std::mutex lock;
 
  private:
+  using Lane = std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS>;
+
+  struct SchedulingClassQueues {
+    std::array<Lane, NUM_LANES_PER_SCHEDULING_CLASS> lanes;
+
+    // Round-robin position within the class
+    std::atomic<uint32_t> next_lane{0};
+
+    // Approximate number of enqueued tasks per priority, used to skip empty classes without touching all of their
+    // lanes. It is incremented before a task is added and decremented after a task was removed, so it never drops to
+    // zero while tasks are enqueued.
+    std::array<std::atomic<int64_t>, NUM_PRIORITY_LEVELS> num_tasks{};
+  };
+
+  // Visits the scheduling classes in weighted round-robin order and returns the first task that could be taken.
+  // If stealable_only is set, non-stealable tasks are left in the queue.
+  std::shared_ptr<AbstractTask> _take_task(const bool stealable_only);
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  std::array<SchedulingClassQueues, NUM_SCHEDULING_CLASSES> _scheduling_classes;
+  std::atomic<uint32_t> _round{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,127 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const int64_t init_capacity)
+    : capacity(init_capacity), mask(init_capacity - 1), slots(std::make_unique<std::atomic<Slot>[]>(init_capacity)) {
+  DebugAssert(capacity > 0 && (capacity & mask) == 0, "Capacity of WorkStealingDeque must be a power of two");
+}
+
+WorkStealingDeque::Slot WorkStealingDeque::Buffer::get(const int64_t index) const {
+  return slots[index & mask].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::put(const int64_t index, Slot slot) {
+  slots[index & mask].store(slot, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(const size_t initial_capacity) {
+  auto capacity = int64_t{1};
+  while (capacity < static_cast<int64_t>(initial_capacity)) capacity <<= 1;
+
+  _buffers.emplace_back(std::make_unique<Buffer>(capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // Release the tasks that were never popped or stolen.
+  const auto top = _top.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto* buffer = _buffer.load(std::memory_order_relaxed);
+  for (auto index = top; index < bottom; ++index) {
+    delete buffer->get(index);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > buffer->capacity - 1) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  buffer->put(bottom, new std::shared_ptr<AbstractTask>(task));
+
+  // Le et al. use a release fence followed by a relaxed store here. The release store is equivalent for thieves (which
+  // acquire bottom) but, in contrast to standalone fences, is understood by tsan.
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty, restore the bottom index.
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* slot = buffer->get(bottom);
+  if (top == bottom) {
+    // This is the last task in the deque, so we compete with thieves for it.
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      slot = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!slot) return nullptr;
+
+  auto task = std::move(*slot);
+  delete slot;
+  return task;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  // memory_order_consume would suffice, but is treated as acquire by all current compilers anyway.
+  const auto* buffer = _buffer.load(std::memory_order_acquire);
+  auto* slot = buffer->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Lost the race against the owner or another thief.
+    return nullptr;
+  }
+
+  auto task = std::move(*slot);
+  delete slot;
+  return task;
+}
+
+size_t WorkStealingDeque::size_approx() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : size_t{0};
+}
+
+bool WorkStealingDeque::empty() const { return size_approx() == 0; }
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, const int64_t top, const int64_t bottom) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->put(index, buffer->get(index));
+  }
+
+  auto* new_buffer_ptr = new_buffer.get();
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(new_buffer_ptr, std::memory_order_release);
+  return new_buffer_ptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free work-stealing deque as described by Chase and Lev [1], using the memory orderings of Lê et al. [2].
+ *
+ * Exactly one thread (the owning Worker) may call push() and pop(). These operate on the bottom end of the deque, so
+ * that the owner processes its tasks in LIFO order, i.e., it continues with the task that it has spawned last and whose
+ * data is most likely still in the cache. Any other thread may call steal(), which takes a task from the top end, i.e.,
+ * the oldest task, which usually represents the largest remaining piece of work.
+ *
+ * As the slots of the buffer are read by thieves while the owner might concurrently overwrite them, the slots cannot
+ * hold std::shared_ptrs directly. Instead, every pushed task is wrapped into a heap-allocated shared_ptr whose
+ * ownership is transferred to the one thread that successfully pops or steals it.
+ *
+ * When the buffer runs full, it is replaced by a buffer of twice the size. Old buffers may still be read by thieves,
+ * so they are only released when the deque is destroyed.
+ *
+ * [1] https://doi.org/10.1145/1073970.1073974
+ * [2] https://doi.org/10.1145/2442516.2442524
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 1024);
+  ~WorkStealingDeque();
+
+  /**
+   * Only to be called by the owner.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Only to be called by the owner. Returns the most recently pushed task, nullptr if the deque is empty.
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * May be called by any thread. Returns the oldest task, nullptr if the deque is empty or another thread won the race
+   * for the oldest task.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Approximation of the number of tasks in the deque. Might be outdated as soon as it is returned.
+   */
+  size_t size_approx() const;
+
+  bool empty() const;
+
+ private:
+  using Slot = std::shared_ptr<AbstractTask>*;
+
+  struct Buffer {
+    explicit Buffer(const int64_t init_capacity);
+
+    Slot get(const int64_t index) const;
+    void put(const int64_t index, Slot slot);
+
+    const int64_t capacity;
+    const int64_t mask;
+    std::unique_ptr<std::atomic<Slot>[]> slots;
+  };
+
+  Buffer* _grow(Buffer* buffer, const int64_t top, const int64_t bottom);
+
+  // top and bottom are placed on different cache lines, as top is written by thieves and bottom by the owner.
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  alignas(64) std::atomic<Buffer*> _buffer;
+
+  // All buffers that were ever used by this deque, including the current one. Only modified by the owner.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
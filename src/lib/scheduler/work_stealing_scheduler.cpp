@@ -0,0 +1,185 @@
+#include "work_stealing_scheduler.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "hyrise.hpp"
+#include "task_queue.hpp"
+#include "work_stealing_worker.hpp"
+
+#include "uid_allocator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Parked workers wake up after this time even if they were not notified. This is only a safety net (e.g., for tasks
+// that were pushed into a TaskQueue without going through the scheduler), regular wake-ups happen via notify_new_task.
+constexpr auto MAX_PARK_TIME = std::chrono::milliseconds(10);
+
+}  // namespace
+
+namespace opossum {
+
+WorkStealingScheduler::WorkStealingScheduler() { _worker_id_allocator = std::make_shared<UidAllocator>(); }
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+  if (HYRISE_DEBUG && _active) {
+    // We cannot throw an exception because destructors are noexcept by default.
+    std::cerr << "WorkStealingScheduler::finish() wasn't called prior to destroying it" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+void WorkStealingScheduler::begin() {
+  DebugAssert(!_active, "Scheduler is already active");
+
+  const auto& topology_nodes = Hyrise::get().topology.nodes();
+  _queues.reserve(topology_nodes.size());
+  _workers_by_node.resize(topology_nodes.size());
+
+  for (auto node_id = NodeID{0}; node_id < topology_nodes.size(); node_id++) {
+    auto queue = std::make_shared<TaskQueue>(node_id);
+    _queues.emplace_back(queue);
+
+    for (const auto& topology_cpu : topology_nodes[node_id].cpus) {
+      _workers_by_node[node_id].emplace_back(std::make_shared<WorkStealingWorker>(
+          *this, queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+    }
+  }
+
+  _active = true;
+
+  for (const auto& node_workers : _workers_by_node) {
+    for (const auto& worker : node_workers) {
+      worker->start();
+    }
+  }
+}
+
+void WorkStealingScheduler::wait_for_all_tasks() {
+  while (true) {
+    uint64_t num_finished_tasks = 0;
+    for (const auto& node_workers : _workers_by_node) {
+      for (const auto& worker : node_workers) {
+        num_finished_tasks += worker->num_finished_tasks();
+      }
+    }
+
+    if (num_finished_tasks == _task_counter) break;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+void WorkStealingScheduler::finish() {
+  wait_for_all_tasks();
+
+  // All queues and deques SHOULD be empty by now. Tasks that were executed by workers waiting for them (see
+  // Worker::_wait_for_tasks) might still be enqueued, but they are dropped by pull() and steal().
+  if (HYRISE_DEBUG) {
+    for ([[maybe_unused]] const auto& queue : _queues) {
+      [[maybe_unused]] const auto remaining_task = queue->pull();
+      DebugAssert(!remaining_task && queue->empty(),
+                  "WorkStealingScheduler bug: Queue wasn't empty even though all tasks finished");
+    }
+    for ([[maybe_unused]] const auto& node_workers : _workers_by_node) {
+      for ([[maybe_unused]] const auto& worker : node_workers) {
+        [[maybe_unused]] const auto remaining_task = worker->steal();
+        DebugAssert(!remaining_task && !worker->has_stealable_tasks(),
+                    "WorkStealingScheduler bug: Deque wasn't empty even though all tasks finished");
+      }
+    }
+  }
+
+  _active = false;
+
+  // Wake up all parked workers so that they notice that the scheduler is shutting down.
+  {
+    std::lock_guard<std::mutex> lock(_park_mutex);
+    _park_condition_variable.notify_all();
+  }
+
+  for (const auto& node_workers : _workers_by_node) {
+    for (const auto& worker : node_workers) {
+      worker->join();
+    }
+  }
+
+  _workers_by_node = {};
+  _queues = {};
+  _task_counter = 0;
+}
+
+bool WorkStealingScheduler::active() const { return _active; }
+
+const std::vector<std::shared_ptr<TaskQueue>>& WorkStealingScheduler::queues() const { return _queues; }
+
+const std::vector<std::shared_ptr<WorkStealingWorker>>& WorkStealingScheduler::workers_on_node(
+    const NodeID node_id) const {
+  DebugAssert(static_cast<size_t>(node_id) < _workers_by_node.size(), "node_id is not within range of available nodes");
+  return _workers_by_node[node_id];
+}
+
+void WorkStealingScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
+                                     SchedulePriority priority) {
+  DebugAssert(_active, "Can't schedule more tasks after the WorkStealingScheduler was shut down");
+  DebugAssert(task->is_scheduled(), "Don't call WorkStealingScheduler::schedule(), call schedule() on the task");
+
+  const auto task_counter = _task_counter++;  // Atomically take snapshot of counter
+  task->set_id(task_counter);
+
+  if (!task->is_ready()) return;
+
+  if (preferred_node_id == CURRENT_NODE_ID) {
+    // Tasks scheduled from a worker go to its deque. The worker takes care of adding non-stealable tasks to its node
+    // queue instead.
+    const auto worker = std::dynamic_pointer_cast<WorkStealingWorker>(Worker::get_this_thread_worker());
+    if (worker) {
+      worker->push_ready_task(task, priority);
+      return;
+    }
+
+    // Tasks scheduled from outside of the workers (e.g., the root tasks of a query) are spread across the nodes
+    // round-robin. Idle workers steal from remote nodes anyway, so there is no need to track the nodes' load.
+    const auto node_index = _next_node_for_external_tasks.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+    preferred_node_id = NodeID{static_cast<NodeID::base_type>(node_index)};
+  }
+
+  DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
+              "preferred_node_id is not within range of available nodes");
+
+  _queues[preferred_node_id]->push(task, static_cast<uint32_t>(priority));
+  notify_new_task();
+}
+
+void WorkStealingScheduler::notify_new_task() {
+  // Both the increment of the epoch and the load of the number of parked workers are sequentially consistent. Together
+  // with the inverse order of operations in park_worker, this guarantees that either the parking worker sees the new
+  // epoch or we see the parked worker.
+  _task_epoch.fetch_add(1, std::memory_order_seq_cst);
+  if (_num_parked_workers.load(std::memory_order_seq_cst) == 0) return;
+
+  std::lock_guard<std::mutex> lock(_park_mutex);
+  _park_condition_variable.notify_one();
+}
+
+uint64_t WorkStealingScheduler::task_epoch() const { return _task_epoch.load(std::memory_order_seq_cst); }
+
+void WorkStealingScheduler::park_worker(const uint64_t observed_task_epoch) {
+  std::unique_lock<std::mutex> lock(_park_mutex);
+  _num_parked_workers.fetch_add(1, std::memory_order_seq_cst);
+
+  if (_active && _task_epoch.load(std::memory_order_seq_cst) == observed_task_epoch) {
+    _park_condition_variable.wait_for(lock, MAX_PARK_TIME);
+  }
+
+  _num_parked_workers.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+}  // namespace opossum
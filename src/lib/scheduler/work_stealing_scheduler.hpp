@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+
+namespace opossum {
+
+class TaskQueue;
+class UidAllocator;
+class WorkStealingWorker;
+
+/**
+ * Alternative to the NodeQueueScheduler for workloads with many small tasks, where the shared queue of a node becomes
+ * a point of contention.
+ *
+ * LOCAL DEQUES
+ *
+ * Every worker owns a WorkStealingDeque. Stealable tasks that are scheduled from a worker thread (e.g., the JobTasks of
+ * an operator or the successors of a finished OperatorTask) are pushed onto the deque of that worker. The owner pops
+ * them in LIFO order without any contention. Tasks that are scheduled from non-worker threads, that are not stealable,
+ * or that explicitly ask for a specific node are added to the TaskQueue of the respective node, just as in the
+ * NodeQueueScheduler.
+ *
+ * WORK STEALING
+ *
+ * A worker looks for tasks in the following order:
+ *  1) its own deque (newest task first)
+ *  2) the queue of its node
+ *  3) the deques of randomly chosen workers on the same node (oldest task first)
+ *  4) the deques of randomly chosen workers on other nodes, followed by the queues of other nodes
+ * Remote nodes are only considered after the local node, as accessing memory of a remote node is more expensive.
+ *
+ * IDLING
+ *
+ * A worker that does not find a task yields its CPU and retries for a number of rounds (spinning). Only afterwards, it
+ * parks on a condition variable until a new task is scheduled. To avoid lost wake-ups, every newly available task
+ * increments an epoch counter, which parking workers check after registering themselves as parked.
+ */
+class WorkStealingScheduler : public AbstractScheduler {
+ public:
+  WorkStealingScheduler();
+  ~WorkStealingScheduler() override;
+
+  /**
+   * Create a queue on every node and a worker (with its deque) for every core.
+   */
+  void begin() override;
+
+  void finish() override;
+
+  bool active() const override;
+
+  const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
+
+  /**
+   * @param task
+   * @param preferred_node_id If this is CURRENT_NODE_ID and the calling thread is a worker, the task is pushed onto
+   *                          that worker's deque. Otherwise, it is added to the queue of the given node.
+   * @param priority Only used for tasks that are added to a node queue.
+   */
+  void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
+                SchedulePriority priority = SchedulePriority::Default) override;
+
+  void wait_for_all_tasks() override;
+
+  const std::vector<std::shared_ptr<WorkStealingWorker>>& workers_on_node(const NodeID node_id) const;
+
+  /**
+   * Called whenever a task became available, wakes up a parked worker if there is one.
+   */
+  void notify_new_task();
+
+  /**
+   * Returns the current epoch, i.e., a counter that is incremented whenever a task became available.
+   */
+  uint64_t task_epoch() const;
+
+  /**
+   * Parks the calling worker until a new task became available. Returns immediately if the task epoch has changed
+   * since observed_task_epoch was retrieved, as the worker might have missed a task in that case.
+   */
+  void park_worker(const uint64_t observed_task_epoch);
+
+ private:
+  std::atomic<TaskID> _task_counter{TaskID{0}};
+  std::shared_ptr<UidAllocator> _worker_id_allocator;
+  std::vector<std::shared_ptr<TaskQueue>> _queues;
+  std::vector<std::vector<std::shared_ptr<WorkStealingWorker>>> _workers_by_node;
+  std::atomic_bool _active{false};
+
+  // Node that receives the next task scheduled from outside of the workers with CURRENT_NODE_ID
+  std::atomic<uint32_t> _next_node_for_external_tasks{0};
+
+  std::atomic<uint64_t> _task_epoch{0};
+  std::atomic<uint32_t> _num_parked_workers{0};
+  std::mutex _park_mutex;
+  std::condition_variable _park_condition_variable;
+};
+
+}  // namespace opossum
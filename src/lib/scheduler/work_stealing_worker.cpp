@@ -0,0 +1,133 @@
+#include "work_stealing_worker.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
+#include "work_stealing_scheduler.hpp"
+
+namespace {
+
+// Number of consecutive unsuccessful rounds in which an idle worker yields the CPU before it parks. With the yield
+// taking roughly a microsecond on an otherwise idle core, workers react to new tasks without any delay for a short
+// time, but do not burn CPU for longer idle phases.
+constexpr auto MAX_SPIN_ROUNDS = uint32_t{64};
+
+}  // namespace
+
+namespace opossum {
+
+WorkStealingWorker::WorkStealingWorker(WorkStealingScheduler& scheduler, const std::shared_ptr<TaskQueue>& queue,
+                                       WorkerID id, CpuID cpu_id)
+    : Worker(queue, id, cpu_id), _scheduler(scheduler), _random_engine(id) {}
+
+void WorkStealingWorker::push_ready_task(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) {
+  // Non-stealable tasks must not leave this node. As thieves cannot be prevented from taking tasks from the deque, we
+  // add such tasks to the node queue, from which only the steal() method respecting the stealable flag takes tasks.
+  if (!task->is_stealable()) {
+    queue()->push(task, static_cast<uint32_t>(priority));
+    _scheduler.notify_new_task();
+    return;
+  }
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  // As the owner pops tasks in LIFO order, the task will be the next one that this worker executes (unless it is
+  // stolen). Thus, priorities are not distinguished here.
+  task->set_node_id(queue()->node_id());
+  _deque.push(task);
+  _scheduler.notify_new_task();
+}
+
+std::shared_ptr<AbstractTask> WorkStealingWorker::steal() {
+  while (auto task = _deque.steal()) {
+    if (task->try_mark_as_assigned_to_worker()) return task;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingWorker::_pop() {
+  while (auto task = _deque.pop()) {
+    if (task->try_mark_as_assigned_to_worker()) return task;
+  }
+  return nullptr;
+}
+
+bool WorkStealingWorker::has_stealable_tasks() const { return !_deque.empty(); }
+
+void WorkStealingWorker::_work(const AllowSleep allow_sleep) {
+  // Retrieve the epoch before looking for tasks, so that tasks that become available during the search are not missed
+  // when parking.
+  const auto task_epoch = _scheduler.task_epoch();
+
+  const auto task = _find_task();
+  if (task) {
+    _idle_rounds = 0;
+    _execute_task(task);
+    return;
+  }
+
+  if (allow_sleep == AllowSleep::No || _idle_rounds < MAX_SPIN_ROUNDS) {
+    ++_idle_rounds;
+    std::this_thread::yield();
+    return;
+  }
+
+  _idle_rounds = 0;
+  _scheduler.park_worker(task_epoch);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingWorker::_find_task() {
+  if (auto task = _pop()) return task;
+
+  const auto own_node_id = queue()->node_id();
+  if (auto task = queue()->pull()) return task;
+
+  if (auto task = _steal_from_node(own_node_id)) return task;
+
+  const auto& queues = _scheduler.queues();
+  const auto num_nodes = queues.size();
+  if (num_nodes == 1) return nullptr;
+
+  // Visit the remote nodes starting at a random one so that thieves spread across nodes.
+  const auto first_node_offset = std::uniform_int_distribution<size_t>{0, num_nodes - 2}(_random_engine);
+  for (auto node_index = size_t{0}; node_index < num_nodes - 1; ++node_index) {
+    const auto node_offset = 1 + (first_node_offset + node_index) % (num_nodes - 1);
+    const auto node_id = NodeID{static_cast<NodeID::base_type>((own_node_id + node_offset) % num_nodes)};
+
+    if (auto task = _steal_from_node(node_id)) return task;
+
+    if (auto task = queues[node_id]->steal()) {
+      task->set_node_id(own_node_id);
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingWorker::_steal_from_node(const NodeID node_id) {
+  const auto& victims = _scheduler.workers_on_node(node_id);
+  const auto num_victims = victims.size();
+  if (num_victims == 0) return nullptr;
+
+  // Start at a random victim and try every worker of the node once. Randomization avoids that all idle workers attack
+  // the same victim.
+  const auto first_victim = std::uniform_int_distribution<size_t>{0, num_victims - 1}(_random_engine);
+  for (auto victim_offset = size_t{0}; victim_offset < num_victims; ++victim_offset) {
+    const auto& victim = victims[(first_victim + victim_offset) % num_victims];
+    if (victim.get() == this) continue;
+
+    if (auto task = victim->steal()) {
+      task->set_node_id(queue()->node_id());
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <random>
+
+#include "work_stealing_deque.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+class WorkStealingScheduler;
+
+/**
+ * Worker used by the WorkStealingScheduler. Next to the queue of its node, it owns a WorkStealingDeque into which all
+ * stealable tasks that are scheduled from this worker's thread are pushed. See WorkStealingScheduler for the order in
+ * which the worker looks for tasks.
+ */
+class WorkStealingWorker : public Worker {
+ public:
+  WorkStealingWorker(WorkStealingScheduler& scheduler, const std::shared_ptr<TaskQueue>& queue, WorkerID id,
+                     CpuID cpu_id);
+
+  void push_ready_task(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) override;
+
+  /**
+   * Called by other workers that ran out of work. Returns nullptr if the deque is empty or the race was lost. Tasks
+   * that were already assigned to a worker (see Worker::_wait_for_tasks) are dropped.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  bool has_stealable_tasks() const;
+
+ protected:
+  void _work(const AllowSleep allow_sleep) override;
+
+ private:
+  std::shared_ptr<AbstractTask> _pop();
+  std::shared_ptr<AbstractTask> _find_task();
+  std::shared_ptr<AbstractTask> _steal_from_node(const NodeID node_id);
+
+  WorkStealingScheduler& _scheduler;
+  WorkStealingDeque _deque;
+  std::minstd_rand _random_engine;
+
+  // Number of consecutive calls to _work() that did not find a task. Used to decide when to stop spinning and park.
+  uint32_t _idle_rounds{0};
+};
+
+}  // namespace opossum
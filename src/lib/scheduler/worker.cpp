@@ -49,11 +49,11 @@ void Worker::operator()() {
   _set_affinity();
 
   while (Hyrise::get().scheduler()->active()) {
-    _work();
+    _work(AllowSleep::Yes);
   }
 }
 
-void Worker::_work() {
+void Worker::_work(const AllowSleep allow_sleep) {
   auto task = _queue->pull();
 
   if (!task) {
@@ -75,6 +75,11 @@ void Worker::_work() {
     // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
     // own queue or returns after timer exceeded (whatever occurs first).
     if (!work_stealing_successful) {
+      if (allow_sleep == AllowSleep::No) {
+        std::this_thread::yield();
+        return;
+      }
+
       {
         std::unique_lock<std::mutex> unique_lock(_queue->lock);
         _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
@@ -83,6 +88,10 @@ void Worker::_work() {
     }
   }
 
+  _execute_task(task);
+}
+
+void Worker::_execute_task(const std::shared_ptr<AbstractTask>& task) {
   task->execute();
 
   // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
@@ -90,6 +99,24 @@ void Worker::_work() {
   _num_finished_tasks++;
 }
 
+bool Worker::_try_execute_awaited_task(const std::shared_ptr<AbstractTask>& task) {
+  if (task->is_done() || !task->is_ready()) return false;
+
+  // Non-stealable tasks that were already assigned to a different node must stay there.
+  const auto task_node_id = task->node_id();
+  if (!task->is_stealable() && task_node_id != INVALID_NODE_ID && task_node_id != _queue->node_id()) return false;
+
+  // The task might still be contained in a queue. Whoever pulls it from there will skip it.
+  if (!task->try_mark_as_assigned_to_worker()) return false;
+
+  _execute_task(task);
+  return true;
+}
+
+void Worker::push_ready_task(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) {
+  _queue->push(task, static_cast<uint32_t>(priority));
+}
+
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
 
 void Worker::join() {
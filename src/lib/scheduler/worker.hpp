@@ -10,8 +10,13 @@
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
 
+// Workers that wait for the completion of tasks (see _wait_for_tasks) must not sleep when they did not find work, as
+// they would otherwise not notice that the tasks they wait for are done.
+enum class AllowSleep : bool { Yes = true, No = false };
+
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
@@ -23,6 +28,7 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   static std::shared_ptr<Worker> get_this_thread_worker();
 
   Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  virtual ~Worker() = default;
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -36,13 +42,31 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   uint64_t num_finished_tasks() const;
 
+  /**
+   * Called for tasks that became ready while this worker was running (e.g., successors of a task that just finished).
+   * By default, they are added to the worker's node queue.
+   */
+  virtual void push_ready_task(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority);
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
  protected:
   void operator()();
-  void _work();
+  virtual void _work(const AllowSleep allow_sleep);
 
+  /**
+   * Executes the task on this worker's thread and counts it as finished.
+   */
+  void _execute_task(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Instead of blocking until the given tasks are done, the worker helps with executing them ("helping join"). It first
+   * executes those of the awaited tasks that are ready and that no other worker has picked up yet. This keeps the CPU
+   * busy without having to spawn or wake another thread and executes the tasks on which the caller waits first. Only
+   * if none of the awaited tasks can be executed (i.e., they are either being executed by other workers or still wait
+   * for their predecessors), the worker executes other tasks from the queues.
+   */
   template <typename TaskType>
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
     auto tasks_completed = [&tasks]() {
@@ -56,10 +80,25 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
     };
 
     while (!tasks_completed()) {
-      _work();
+      // Iterate in order so that tasks which become ready because their predecessors in the list were just executed
+      // are executed within the same iteration.
+      auto executed_awaited_task = false;
+      for (const auto& task : tasks) {
+        if (_try_execute_awaited_task(task)) executed_awaited_task = true;
+      }
+
+      if (!executed_awaited_task) {
+        _work(AllowSleep::No);
+      }
     }
   }
 
+  /**
+   * Executes the task if it is ready, was not yet assigned to a worker, and is allowed to run on this worker's node.
+   * Returns whether the task was executed.
+   */
+  bool _try_execute_awaited_task(const std::shared_ptr<AbstractTask>& task);
+
  private:
   /**
    * Pin a worker to a particular core.
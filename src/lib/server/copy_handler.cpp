@@ -0,0 +1,573 @@
+#include "copy_handler.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "result_serializer.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "storage/value_segment.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Replaces the escape sequences of COPY's text format (e.g., "\t" or "\\") in place
+void unescape_copy_text(std::string& field) {
+  auto write_position = size_t{0};
+  for (auto read_position = size_t{0}; read_position < field.size(); ++read_position) {
+    if (field[read_position] != '\\' || read_position + 1 == field.size()) {
+      field[write_position++] = field[read_position];
+      continue;
+    }
+
+    const auto escaped_character = field[++read_position];
+    switch (escaped_character) {
+      case 'b':
+        field[write_position++] = '\b';
+        break;
+      case 'f':
+        field[write_position++] = '\f';
+        break;
+      case 'n':
+        field[write_position++] = '\n';
+        break;
+      case 'r':
+        field[write_position++] = '\r';
+        break;
+      case 't':
+        field[write_position++] = '\t';
+        break;
+      case 'v':
+        field[write_position++] = '\v';
+        break;
+      case 'x':
+      case '0':
+      case '1':
+      case '2':
+      case '3':
+      case '4':
+      case '5':
+      case '6':
+      case '7': {
+        // Hexadecimal (\xhh) or octal (\ooo) byte values
+        const auto base = escaped_character == 'x' ? 16 : 8;
+        const auto max_digits = escaped_character == 'x' ? size_t{2} : size_t{3};
+        const auto digits_begin = escaped_character == 'x' ? read_position + 1 : read_position;
+        const auto digits_end = std::min(digits_begin + max_digits, field.size());
+        auto value = 0;
+        const auto result = std::from_chars(field.data() + digits_begin, field.data() + digits_end, value, base);
+        if (result.ptr == field.data() + digits_begin) {
+          // "\x" without digits is an "x"
+          field[write_position++] = escaped_character;
+          break;
+        }
+        field[write_position++] = static_cast<char>(value);
+        read_position = result.ptr - field.data() - 1;
+      } break;
+      default:
+        // Any other character following a backslash (including the backslash itself) is taken literally
+        field[write_position++] = escaped_character;
+    }
+  }
+  field.resize(write_position);
+}
+
+template <typename T>
+T convert_text(const std::string& text) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    return pmr_string{text};
+  } else if constexpr (std::is_integral_v<T>) {
+    auto value = T{};
+    const auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    AssertInput(result.ec == std::errc{} && result.ptr == text.data() + text.size(),
+                "Invalid value '" + text + "' for an integer column");
+    return value;
+  } else {
+    char* end = nullptr;
+    errno = 0;
+    const auto value = std::is_same_v<T, float> ? std::strtof(text.c_str(), &end) : std::strtod(text.c_str(), &end);
+    AssertInput(!text.empty() && end == text.c_str() + text.size() && errno == 0,
+                "Invalid value '" + text + "' for a floating-point column");
+    return static_cast<T>(value);
+  }
+}
+
+template <typename T>
+T convert_binary(const std::string& bytes) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // The binary representation of text is the text itself
+    return pmr_string{bytes};
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    return from_network_bytes<T, Bits>(bytes);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+// Collects the values of one column of a batch and converts them to the column's data type
+class BaseCopyColumnBuilder {
+ public:
+  virtual ~BaseCopyColumnBuilder() = default;
+
+  virtual void append(const std::string& field, const CopyFormat copy_format) = 0;
+  virtual void append_null() = 0;
+
+  // Returns the ValueSegment containing the appended values. Afterwards, the builder starts a new batch.
+  virtual std::shared_ptr<BaseSegment> finish() = 0;
+};
+
+template <typename T>
+class CopyColumnBuilder : public BaseCopyColumnBuilder {
+ public:
+  CopyColumnBuilder(const ChunkOffset batch_size, const bool is_nullable)
+      : _batch_size(batch_size), _is_nullable(is_nullable) {
+    _reserve();
+  }
+
+  void append(const std::string& field, const CopyFormat copy_format) final {
+    if (copy_format == CopyFormat::Binary) {
+      _values.emplace_back(convert_binary<T>(field));
+    } else {
+      _values.emplace_back(convert_text<T>(field));
+    }
+    if (_is_nullable) _null_values.emplace_back(false);
+  }
+
+  void append_null() final {
+    AssertInput(_is_nullable, "Cannot insert NULL into NOT NULL column");
+    _values.emplace_back();
+    _null_values.emplace_back(true);
+  }
+
+  std::shared_ptr<BaseSegment> finish() final {
+    auto segment = _is_nullable ? std::make_shared<ValueSegment<T>>(std::move(_values), std::move(_null_values))
+                                : std::make_shared<ValueSegment<T>>(std::move(_values));
+    _values = {};
+    _null_values = {};
+    _reserve();
+    return segment;
+  }
+
+ private:
+  void _reserve() {
+    _values.reserve(_batch_size);
+    if (_is_nullable) _null_values.reserve(_batch_size);
+  }
+
+  const ChunkOffset _batch_size;
+  const bool _is_nullable;
+  pmr_vector<T> _values;
+  pmr_vector<bool> _null_values;
+};
+
+std::optional<CopyStatement> CopyHandler::parse_copy_statement(const std::string& query) {
+  // COPY {table | (query)} {FROM STDIN | TO STDOUT} [[WITH] {(FORMAT format) | format}]
+  static const auto copy_regex = std::regex{
+      R"(^\s*COPY\s+(?:(\w+|"[^"]+")|\(([\s\S]+)\))\s+(FROM\s+STDIN|TO\s+STDOUT))"
+      R"((?:\s+(?:WITH\s*)?(?:\(\s*FORMAT\s+(\w+)\s*\)|(\w+)))?\s*;?\s*$)",
+      std::regex::icase};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(query, match, copy_regex)) return std::nullopt;
+
+  auto copy_statement = CopyStatement{};
+  copy_statement.direction =
+      boost::istarts_with(match[3].str(), "FROM") ? CopyDirection::FromStdin : CopyDirection::ToStdout;
+
+  if (match[1].matched) {
+    copy_statement.table_name = match[1].str();
+    boost::trim_if(copy_statement.table_name, boost::is_any_of("\""));
+    copy_statement.query = "SELECT * FROM \"" + copy_statement.table_name + "\"";
+  } else {
+    AssertInput(copy_statement.direction == CopyDirection::ToStdout, "COPY FROM STDIN requires a table");
+    copy_statement.query = match[2].str();
+  }
+
+  const auto format = boost::to_lower_copy(match[4].matched ? match[4].str() : match[5].str());
+  if (format.empty() || format == "text") {
+    copy_statement.format = CopyFormat::Text;
+  } else if (format == "csv") {
+    copy_statement.format = CopyFormat::Csv;
+  } else if (format == "binary") {
+    copy_statement.format = CopyFormat::Binary;
+  } else {
+    FailInput("Unknown COPY format " + format);
+  }
+
+  return copy_statement;
+}
+
+template <typename SocketType>
+uint64_t CopyHandler::copy_from_stdin(
+    const CopyStatement& copy_statement,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+  const auto& table_name = copy_statement.table_name;
+  AssertInput(Hyrise::get().storage_manager.has_table(table_name), "Table " + table_name + " does not exist");
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  // The last chunk might not be full yet, so that copied rows are inserted into it as well
+  const auto first_chunk_id = ChunkID{std::max(table->chunk_count(), ChunkID{1}) - 1};
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  auto row_count = uint64_t{0};
+
+  postgres_protocol_handler->send_copy_response(
+      PostgresMessageType::CopyInResponse,
+      copy_statement.format == CopyFormat::Binary ? FormatCode::Binary : FormatCode::Text,
+      static_cast<uint16_t>(table->column_count()));
+  postgres_protocol_handler->force_flush();
+
+  try {
+    auto copy_data_loader = CopyDataLoader{table_name, copy_statement.format, transaction_context};
+    auto copy_done = false;
+    while (!copy_done) {
+      switch (postgres_protocol_handler->read_packet_type()) {
+        case PostgresMessageType::CopyData:
+          copy_data_loader.append(postgres_protocol_handler->read_copy_data_packet());
+          break;
+        case PostgresMessageType::CopyDone:
+          postgres_protocol_handler->read_copy_done_packet();
+          copy_done = true;
+          break;
+        case PostgresMessageType::CopyFail:
+          FailInput("COPY FROM STDIN failed: " + postgres_protocol_handler->read_copy_fail_packet());
+        case PostgresMessageType::FlushCommand:
+        case PostgresMessageType::SyncCommand:
+          // Flush and Sync messages are ignored during COPY FROM STDIN
+          postgres_protocol_handler->read_sync_packet();
+          break;
+        default:
+          // Skip the message's content so that the following messages can be read
+          postgres_protocol_handler->read_copy_data_packet();
+          FailInput("Unexpected message during COPY FROM STDIN");
+      }
+    }
+    row_count = copy_data_loader.finish();
+  } catch (...) {
+    transaction_context->rollback();
+    throw;
+  }
+
+  transaction_context->commit();
+
+  CopyDataLoader::compress_completed_chunks(table_name, first_chunk_id);
+
+  return row_count;
+}
+
+template <typename SocketType>
+void CopyHandler::copy_to_stdout(
+    const std::shared_ptr<const Table>& table, const CopyFormat copy_format,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+  const auto format_code = copy_format == CopyFormat::Binary ? FormatCode::Binary : FormatCode::Text;
+  postgres_protocol_handler->send_copy_response(PostgresMessageType::CopyOutResponse, format_code,
+                                                static_cast<uint16_t>(table->column_count()));
+  ResultSerializer::send_copy_data(table, postgres_protocol_handler, copy_format);
+  postgres_protocol_handler->send_status_message(PostgresMessageType::CopyDone);
+}
+
+CopyDataLoader::CopyDataLoader(const std::string& table_name, const CopyFormat copy_format,
+                               const std::shared_ptr<TransactionContext>& transaction_context)
+    : _table_name(table_name),
+      _table(Hyrise::get().storage_manager.get_table(table_name)),
+      _copy_format(copy_format),
+      _transaction_context(transaction_context) {
+  const auto column_count = _table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    _column_builders.emplace_back(make_unique_by_data_type<BaseCopyColumnBuilder, CopyColumnBuilder>(
+        _table->column_data_type(column_id), _table->target_chunk_size(), _table->column_is_nullable(column_id)));
+  }
+  _fields.resize(column_count);
+  _field_is_null.resize(column_count);
+}
+
+CopyDataLoader::~CopyDataLoader() = default;
+
+void CopyDataLoader::append(const std::string_view copy_data) {
+  _pending_data.append(copy_data);
+  _parse_pending_data(false);
+}
+
+uint64_t CopyDataLoader::finish() {
+  _parse_pending_data(true);
+  AssertInput(_pending_data.empty() || _end_of_data, "Incomplete row at the end of the COPY data");
+  AssertInput(_copy_format != CopyFormat::Binary || _binary_header_read, "Missing header of binary COPY data");
+
+  if (_batch_row_count > 0) _insert_batch();
+  return _row_count;
+}
+
+void CopyDataLoader::compress_completed_chunks(const std::string& table_name, const ChunkID first_chunk_id) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = first_chunk_id; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || !ChunkCompressionTask::chunk_is_completed(chunk, table->target_chunk_size())) continue;
+
+    {
+      // The Insert operator checks whether the last chunk is mutable while holding the append mutex
+      const auto append_lock = table->acquire_append_mutex();
+      if (!chunk->is_mutable()) continue;
+      chunk->finalize();
+    }
+    tasks.emplace_back(std::make_shared<ChunkCompressionTask>(table_name, chunk_id));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+}
+
+void CopyDataLoader::_parse_pending_data(const bool is_last_data) {
+  const auto data = std::string_view{_pending_data};
+  auto position = size_t{0};
+  while (position < data.size() && !_end_of_data) {
+    auto row_end = std::optional<size_t>{};
+    switch (_copy_format) {
+      case CopyFormat::Text:
+        row_end = _parse_text_row(data, position, is_last_data);
+        break;
+      case CopyFormat::Csv:
+        row_end = _parse_csv_row(data, position, is_last_data);
+        break;
+      case CopyFormat::Binary:
+        row_end = _parse_binary_row(data, position);
+        break;
+    }
+    if (!row_end) break;
+    position = *row_end;
+  }
+
+  // Data after the end-of-data marker is ignored
+  _pending_data.erase(0, _end_of_data ? _pending_data.size() : position);
+}
+
+std::optional<size_t> CopyDataLoader::_parse_text_row(const std::string_view data, const size_t begin,
+                                                      const bool is_last_data) {
+  auto line_end = data.find('\n', begin);
+  auto next_row = line_end + 1;
+  if (line_end == std::string_view::npos) {
+    if (!is_last_data) return std::nullopt;
+    line_end = data.size();
+    next_row = data.size();
+  }
+
+  auto line = data.substr(begin, line_end - begin);
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+  if (line == "\\.") {
+    _end_of_data = true;
+    return next_row;
+  }
+
+  // Fields are separated by tabs. Tabs and line breaks within values are escaped.
+  _field_count = 0;
+  auto field_begin = size_t{0};
+  while (true) {
+    const auto field_end = std::min(line.find('\t', field_begin), line.size());
+    const auto field = line.substr(field_begin, field_end - field_begin);
+    if (field == "\\N") {
+      _add_null_field();
+    } else {
+      auto& value = _add_field(field);
+      if (value.find('\\') != std::string::npos) unescape_copy_text(value);
+    }
+
+    if (field_end == line.size()) break;
+    field_begin = field_end + 1;
+  }
+
+  _append_row();
+  return next_row;
+}
+
+std::optional<size_t> CopyDataLoader::_parse_csv_row(const std::string_view data, const size_t begin,
+                                                     const bool is_last_data) {
+  // Fields are separated by commas. Quoted fields may contain commas, line breaks, and quotes, which are escaped by
+  // another quote. Unquoted empty fields are NULL values.
+  _field_count = 0;
+  auto position = begin;
+  while (true) {
+    if (position < data.size() && data[position] == '"') {
+      auto& value = _add_field({});
+      ++position;
+      while (true) {
+        const auto quote = data.find('"', position);
+        if (quote == std::string_view::npos) {
+          AssertInput(!is_last_data, "Unterminated quoted field in CSV data");
+          return std::nullopt;
+        }
+        value.append(data.substr(position, quote - position));
+        position = quote + 1;
+
+        // We cannot tell whether the quote is escaped before the next character has arrived
+        if (position == data.size() && !is_last_data) return std::nullopt;
+        if (position == data.size() || data[position] != '"') break;
+
+        value.push_back('"');
+        ++position;
+      }
+    } else {
+      const auto field_end = data.find_first_of(",\n", position);
+      if (field_end == std::string_view::npos && !is_last_data) return std::nullopt;
+
+      auto field = data.substr(position, std::min(field_end, data.size()) - position);
+      if (!field.empty() && field.back() == '\r' && field_end != std::string_view::npos && data[field_end] == '\n') {
+        field.remove_suffix(1);
+      }
+      if (field.empty()) {
+        _add_null_field();
+      } else {
+        _add_field(field);
+      }
+      position = std::min(field_end, data.size());
+    }
+
+    if (position < data.size() && data[position] == '\r') ++position;
+    if (position == data.size()) {
+      if (!is_last_data) return std::nullopt;
+      break;
+    }
+    if (data[position] == ',') {
+      ++position;
+      continue;
+    }
+    AssertInput(data[position] == '\n', "Unexpected character after quoted field in CSV data");
+    ++position;
+    break;
+  }
+
+  if (_field_count == 1 && !_field_is_null[0] && _fields[0] == "\\.") {
+    _end_of_data = true;
+    return position;
+  }
+
+  _append_row();
+  return position;
+}
+
+std::optional<size_t> CopyDataLoader::_parse_binary_row(const std::string_view data, const size_t begin) {
+  auto position = begin;
+  const auto available_bytes = [&]() { return data.size() - position; };
+
+  if (!_binary_header_read) {
+    // Signature, flags field, and length of the header extension area, followed by the extension area
+    constexpr auto HEADER_SIZE = BINARY_COPY_SIGNATURE.size() + 2 * sizeof(uint32_t);
+    if (available_bytes() < HEADER_SIZE) return std::nullopt;
+    AssertInput(data.substr(position, BINARY_COPY_SIGNATURE.size()) == BINARY_COPY_SIGNATURE,
+                "Invalid signature of binary COPY data");
+    const auto extension_size = from_network_bytes<uint32_t, uint32_t>(
+        data.substr(position + BINARY_COPY_SIGNATURE.size() + sizeof(uint32_t), sizeof(uint32_t)));
+    if (available_bytes() < HEADER_SIZE + extension_size) return std::nullopt;
+
+    _binary_header_read = true;
+    return position + HEADER_SIZE + extension_size;
+  }
+
+  // Each tuple starts with its number of fields. The trailer is a field count of -1.
+  if (available_bytes() < sizeof(int16_t)) return std::nullopt;
+  const auto field_count = from_network_bytes<int16_t, uint16_t>(data.substr(position, sizeof(int16_t)));
+  position += sizeof(int16_t);
+  if (field_count == -1) {
+    _end_of_data = true;
+    return position;
+  }
+
+  _field_count = 0;
+  for (auto field_id = int16_t{0}; field_id < field_count; ++field_id) {
+    if (available_bytes() < sizeof(int32_t)) return std::nullopt;
+    const auto field_length = from_network_bytes<int32_t, uint32_t>(data.substr(position, sizeof(int32_t)));
+    position += sizeof(int32_t);
+
+    // NULL values are represented by a length of -1
+    if (field_length == -1) {
+      _add_null_field();
+      continue;
+    }
+    AssertInput(field_length >= 0, "Invalid field length in binary COPY data");
+    if (available_bytes() < static_cast<size_t>(field_length)) return std::nullopt;
+    _add_field(data.substr(position, field_length));
+    position += field_length;
+  }
+
+  _append_row();
+  return position;
+}
+
+std::string& CopyDataLoader::_add_field(const std::string_view field) {
+  AssertInput(_field_count < _fields.size(), "COPY data contains more fields than the table has columns");
+  _field_is_null[_field_count] = false;
+  return _fields[_field_count++].assign(field);
+}
+
+void CopyDataLoader::_add_null_field() {
+  AssertInput(_field_count < _fields.size(), "COPY data contains more fields than the table has columns");
+  _field_is_null[_field_count] = true;
+  ++_field_count;
+}
+
+void CopyDataLoader::_append_row() {
+  AssertInput(_field_count == _fields.size(), "COPY data contains fewer fields than the table has columns");
+
+  for (auto column_id = size_t{0}; column_id < _field_count; ++column_id) {
+    if (_field_is_null[column_id]) {
+      _column_builders[column_id]->append_null();
+    } else {
+      _column_builders[column_id]->append(_fields[column_id], _copy_format);
+    }
+  }
+
+  ++_row_count;
+  ++_batch_row_count;
+  if (_batch_row_count == _table->target_chunk_size()) _insert_batch();
+}
+
+void CopyDataLoader::_insert_batch() {
+  auto segments = Segments{};
+  for (const auto& column_builder : _column_builders) {
+    segments.emplace_back(column_builder->finish());
+  }
+
+  const auto batch =
+      std::make_shared<Table>(_table->column_definitions(), TableType::Data, _table->target_chunk_size());
+  batch->append_chunk(segments);
+  _batch_row_count = ChunkOffset{0};
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(batch);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+  insert->set_transaction_context(_transaction_context);
+  insert->execute();
+  Assert(!insert->execute_failed(), "Inserting the COPY data failed");
+}
+
+template uint64_t CopyHandler::copy_from_stdin<Socket>(const CopyStatement&,
+                                                       const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+
+template uint64_t CopyHandler::copy_from_stdin<boost::asio::posix::stream_descriptor>(
+    const CopyStatement&, const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+
+template void CopyHandler::copy_to_stdout<Socket>(const std::shared_ptr<const Table>&, const CopyFormat,
+                                                  const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+
+template void CopyHandler::copy_to_stdout<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&, const CopyFormat,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+
+}  // namespace opossum
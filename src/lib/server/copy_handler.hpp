@@ -0,0 +1,104 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "postgres_protocol_handler.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class BaseCopyColumnBuilder;
+
+enum class CopyDirection { FromStdin, ToStdout };
+
+// A COPY statement that transfers data between the client and a table (or, for COPY TO STDOUT, a query result)
+struct CopyStatement {
+  CopyDirection direction;
+  std::string table_name;
+  // The query whose result is copied to the client. For COPY table TO STDOUT, all rows of the table are selected.
+  std::string query;
+  CopyFormat format;
+};
+
+// COPY FROM STDIN and COPY TO STDOUT use the COPY sub-protocol of the PostgreSQL Wire Protocol instead of sending a
+// query result. Hence, they are handled by the server instead of the SQL pipeline, which translates COPY from and to
+// files to the Import and Export operators. For further documentation see here:
+// https://www.postgresql.org/docs/12/protocol-flow.html#PROTOCOL-COPY
+class CopyHandler {
+ public:
+  // Returns std::nullopt if the query is not a COPY FROM STDIN or COPY TO STDOUT statement
+  static std::optional<CopyStatement> parse_copy_statement(const std::string& query);
+
+  // Read CopyData messages until the client sends CopyDone, load them into the table within a single transaction, and
+  // return the number of copied rows
+  template <typename SocketType>
+  static uint64_t copy_from_stdin(
+      const CopyStatement& copy_statement,
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+
+  // Send the result table as CopyData messages
+  template <typename SocketType>
+  static void copy_to_stdout(const std::shared_ptr<const Table>& table, const CopyFormat copy_format,
+                             const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+};
+
+// The CopyDataLoader parses the data sent by COPY FROM STDIN and collects the rows in chunk-sized batches of
+// ValueSegments. Each full batch is inserted into the table by an Insert operator of the given transaction, so that
+// the copied rows only become visible once the transaction commits. CopyData messages do not need to be aligned with
+// the rows, incomplete rows are kept until the next message arrives.
+class CopyDataLoader {
+ public:
+  CopyDataLoader(const std::string& table_name, const CopyFormat copy_format,
+                 const std::shared_ptr<TransactionContext>& transaction_context);
+  ~CopyDataLoader();
+
+  void append(const std::string_view copy_data);
+
+  // Parses the last row, which does not need to be terminated by a line break, inserts the remaining rows, and returns
+  // the number of copied rows
+  uint64_t finish();
+
+  // Finalizes and encodes (in parallel) the chunks of the table that are full and whose inserts have all committed,
+  // starting at the given chunk. This is done after the transaction that copied the data has committed.
+  static void compress_completed_chunks(const std::string& table_name, const ChunkID first_chunk_id);
+
+ private:
+  void _parse_pending_data(const bool is_last_data);
+
+  // The parse functions return the position after the parsed row or std::nullopt if the row is not complete yet
+  std::optional<size_t> _parse_text_row(const std::string_view data, const size_t begin, const bool is_last_data);
+  std::optional<size_t> _parse_csv_row(const std::string_view data, const size_t begin, const bool is_last_data);
+  std::optional<size_t> _parse_binary_row(const std::string_view data, const size_t begin);
+
+  std::string& _add_field(const std::string_view field);
+  void _add_null_field();
+  void _append_row();
+  void _insert_batch();
+
+  const std::string _table_name;
+  const std::shared_ptr<Table> _table;
+  const CopyFormat _copy_format;
+  const std::shared_ptr<TransactionContext> _transaction_context;
+
+  std::vector<std::unique_ptr<BaseCopyColumnBuilder>> _column_builders;
+  ChunkOffset _batch_row_count{0};
+  uint64_t _row_count{0};
+
+  // Data of the last CopyData message that does not form a complete row yet
+  std::string _pending_data;
+
+  // Fields of the row that is being parsed. The strings are reused for all rows.
+  std::vector<std::string> _fields;
+  std::vector<bool> _field_is_null;
+  size_t _field_count{0};
+
+  bool _binary_header_read{false};
+  bool _end_of_data{false};
+};
+
+}  // namespace opossum
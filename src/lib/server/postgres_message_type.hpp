@@ -1,11 +1,16 @@
 #pragma once
 
+#include <string_view>
+
 namespace opossum {
 
 // Each message contains a field (4 bytes) indicating the packet's size including itself. Using extra variable here to
 // avoid magic numbers.
 static constexpr auto LENGTH_FIELD_SIZE = 4u;
 
+// Binary COPY data starts with this signature, see https://www.postgresql.org/docs/12/sql-copy.html
+static constexpr auto BINARY_COPY_SIGNATURE = std::string_view{"PGCOPY\n\377\r\n\0", 11};
+
 // Documentation of the message types can be found here:
 // https://www.postgresql.org/docs/12/protocol-message-formats.html
 enum class PostgresMessageType : unsigned char {
@@ -22,6 +27,14 @@ enum class PostgresMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  PortalSuspended = 's',
+  CopyInResponse = 'G',
+  CopyOutResponse = 'H',
+
+  // COPY data is sent in both directions
+  CopyData = 'd',
+  CopyDone = 'c',
+  CopyFail = 'f',
 
   // Selection of error and notice message fields. All possible fields are documented at:
   // https://www.postgresql.org/docs/12/protocol-error-fields.html
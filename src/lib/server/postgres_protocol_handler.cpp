@@ -1,16 +1,50 @@
 #include "postgres_protocol_handler.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Documentation of the PostgreSQL object_ids can be found at:
+// https://crate.io/docs/crate/reference/en/latest/interfaces/postgres.html
+AllTypeVariant read_binary_parameter(const std::string& bytes, const uint32_t object_id) {
+  switch (object_id) {
+    case 16:  // bool
+      return static_cast<int32_t>(from_network_bytes<uint8_t, uint8_t>(bytes));
+    case 21:  // int2
+      return static_cast<int32_t>(from_network_bytes<int16_t, uint16_t>(bytes));
+    case 23:  // int4
+      return from_network_bytes<int32_t, uint32_t>(bytes);
+    case 20:  // int8
+      return from_network_bytes<int64_t, uint64_t>(bytes);
+    case 700:  // float4
+      return from_network_bytes<float, uint32_t>(bytes);
+    case 701:  // float8
+      return from_network_bytes<double, uint64_t>(bytes);
+    case 25:    // text
+    case 1043:  // varchar
+      return pmr_string{bytes};
+    default:
+      AssertInput(object_id != 0, "Binary parameters require their type to be specified in the Parse message");
+      FailInput("Binary parameters of type " + std::to_string(object_id) + " are not supported");
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
+FormatCode format_code_at(const std::vector<FormatCode>& format_codes, const size_t index) {
+  if (format_codes.empty()) return FormatCode::Text;
+  if (format_codes.size() == 1) return format_codes.front();
+  return format_codes.at(index);
+}
+
 template <typename SocketType>
 PostgresProtocolHandler<SocketType>::PostgresProtocolHandler(const std::shared_ptr<SocketType>& socket)
     : _read_buffer(socket), _write_buffer(socket) {}
 
 template <typename SocketType>
 uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
-  // Special SSL version number that we catch to deny SSL support
-  constexpr auto SSL_REQUEST_CODE = 80877103u;
-
   const auto body_length = _read_buffer.template get_value<uint32_t>();
   const auto protocol_version = _read_buffer.template get_value<uint32_t>();
 
@@ -25,11 +59,26 @@ uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
 }
 
 template <typename SocketType>
-void PostgresProtocolHandler<SocketType>::read_startup_packet_body(const uint32_t size) {
-  // As of now, we do not do anything with the startup packet body. It contains authentication data and the
-  // database name the user desires to connect to. Hence, we read this information from the network device as
-  // one large string and throw it away.
-  _read_buffer.get_string(size, HasNullTerminator::No);
+std::unordered_map<std::string, std::string> PostgresProtocolHandler<SocketType>::read_startup_packet_body(
+    const uint32_t size) {
+  // The body consists of null-terminated key/value pairs (e.g., "user", "database") followed by a single null
+  // terminator. We read it as one large string and split it afterwards. Incomplete pairs are ignored.
+  const auto body = _read_buffer.get_string(size, HasNullTerminator::No);
+
+  auto parameters = std::unordered_map<std::string, std::string>{};
+  auto position = size_t{0};
+  while (position < body.size()) {
+    const auto key_end = body.find('\0', position);
+    if (key_end == std::string::npos || key_end == position) break;
+
+    const auto value_end = body.find('\0', key_end + 1);
+    if (value_end == std::string::npos) break;
+
+    parameters[body.substr(position, key_end - position)] = body.substr(key_end + 1, value_end - key_end - 1);
+    position = value_end + 1;
+  }
+
+  return parameters;
 }
 
 template <typename SocketType>
@@ -59,6 +108,27 @@ void PostgresProtocolHandler<SocketType>::send_ready_for_query() {
   _write_buffer.flush();
 }
 
+template <typename SocketType>
+bool PostgresProtocolHandler<SocketType>::is_message_buffered() const {
+  constexpr auto HEADER_SIZE = sizeof(PostgresMessageType) + LENGTH_FIELD_SIZE;
+  return _read_buffer.size() >= HEADER_SIZE &&
+         _read_buffer.size() >= sizeof(PostgresMessageType) + _read_buffer.template peek_value<uint32_t>(1);
+}
+
+template <typename SocketType>
+std::optional<std::string> PostgresProtocolHandler<SocketType>::buffered_query() const {
+  if (!is_message_buffered() ||
+      _read_buffer.template peek_value<char>(0) != static_cast<char>(PostgresMessageType::SimpleQueryCommand)) {
+    return std::nullopt;
+  }
+
+  // The query is followed by a null terminator
+  const auto message_length = _read_buffer.template peek_value<uint32_t>(1);
+  if (message_length <= LENGTH_FIELD_SIZE) return std::nullopt;
+  return _read_buffer.peek_string(sizeof(PostgresMessageType) + LENGTH_FIELD_SIZE,
+                                  message_length - LENGTH_FIELD_SIZE - sizeof('\0'));
+}
+
 template <typename SocketType>
 PostgresMessageType PostgresProtocolHandler<SocketType>::read_packet_type() {
   return static_cast<PostgresMessageType>(_read_buffer.template get_value<char>());
@@ -89,7 +159,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width, const FormatCode format_code) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -99,7 +169,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));
 }
 
 template <typename SocketType>
@@ -132,6 +202,11 @@ void PostgresProtocolHandler<SocketType>::send_data_row(
   }
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_data_rows(const std::vector<boost::asio::const_buffer>& data_rows) {
+  _write_buffer.put_buffers(data_rows);
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_command_complete(const std::string& command_complete_message) {
   const auto packet_size = LENGTH_FIELD_SIZE + command_complete_message.size() + 1u /* null terminator */;
@@ -140,6 +215,50 @@ void PostgresProtocolHandler<SocketType>::send_command_complete(const std::strin
   _write_buffer.put_string(command_complete_message);
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_response(const PostgresMessageType message_type,
+                                                             const FormatCode format_code,
+                                                             const uint16_t column_count) {
+  DebugAssert(message_type == PostgresMessageType::CopyInResponse ||
+                  message_type == PostgresMessageType::CopyOutResponse,
+              "Expected CopyInResponse or CopyOutResponse");
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(char) + sizeof(uint16_t) + column_count * sizeof(uint16_t);
+  _write_buffer.template put_value(message_type);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
+  // Overall format, followed by the format of each column
+  _write_buffer.template put_value<char>(static_cast<char>(format_code));
+  _write_buffer.template put_value<uint16_t>(column_count);
+  for (auto column_id = uint16_t{0}; column_id < column_count; ++column_id) {
+    _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));
+  }
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_data(const std::string& data) {
+  _write_buffer.template put_value(PostgresMessageType::CopyData);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(LENGTH_FIELD_SIZE + data.size()));
+  _write_buffer.put_string(data, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_data_packet() {
+  const auto packet_size = _read_buffer.template get_value<uint32_t>();
+  return _read_buffer.get_string(packet_size - LENGTH_FIELD_SIZE, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::read_copy_done_packet() {
+  // This packet has no body. Hence, only read and ignore its size.
+  _read_buffer.template get_value<uint32_t>();
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_fail_packet() {
+  const auto packet_size = _read_buffer.template get_value<uint32_t>();
+  // Error message sent by the client
+  return _read_buffer.get_string(packet_size - LENGTH_FIELD_SIZE);
+}
+
 template <typename SocketType>
 std::pair<std::string, std::string> PostgresProtocolHandler<SocketType>::read_parse_packet() {
   _read_buffer.template get_value<uint32_t>();  // Ignore packet size
@@ -147,18 +266,43 @@ std::pair<std::string, std::string> PostgresProtocolHandler<SocketType>::read_pa
   const std::string statement_name = _read_buffer.get_string();
   const std::string query = _read_buffer.get_string();
 
-  // The number of parameter data types specified (can be zero). These data types are ignored currently.
+  // The number of parameter data types specified (can be zero). These data types are only needed for reading binary
+  // parameters. Text parameters are converted by the prepared plan.
   const auto data_types_specified = _read_buffer.template get_value<uint16_t>();
 
+  auto parameter_object_ids = std::vector<uint32_t>(data_types_specified);
   for (auto i = 0; i < data_types_specified; i++) {
     // Specifies the object ID of the parameter data type.
     // Placing a zero here is equivalent to leaving the type unspecified.
-    /*auto data_type = */ _read_buffer.template get_value<int32_t>();
+    parameter_object_ids[i] = _read_buffer.template get_value<uint32_t>();
+  }
+
+  // The statement replaces a previous one with the same name, including its object IDs
+  if (parameter_object_ids.empty()) {
+    _parameter_object_ids.erase(statement_name);
+  } else {
+    _parameter_object_ids[statement_name] = std::move(parameter_object_ids);
   }
 
   return {statement_name, query};
 }
 
+template <typename SocketType>
+std::pair<char, std::string> PostgresProtocolHandler<SocketType>::read_close_packet() {
+  const auto packet_size = _read_buffer.template get_value<uint32_t>();
+
+  // Client closes a statement (S) or a portal (P)
+  const auto close_target = _read_buffer.template get_value<char>();
+  AssertInput(close_target == 'S' || close_target == 'P', "Unknown close target " + std::string{close_target});
+
+  const auto name = _read_buffer.get_string(packet_size - LENGTH_FIELD_SIZE - sizeof(char));
+  if (close_target == 'S') {
+    _parameter_object_ids.erase(name);
+  }
+
+  return {close_target, name};
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::read_sync_packet() {
   // This packet has no body. Hence, only read and ignore its size.
@@ -191,31 +335,42 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
   _read_buffer.template get_value<uint32_t>();
   const auto portal = _read_buffer.get_string();
   const auto statement_name = _read_buffer.get_string();
-  const auto num_format_codes = _read_buffer.template get_value<int16_t>();
+  const auto parameter_format_codes = _read_format_codes();
 
-  for (auto i = 0; i < num_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all parameters to be in text format (0)");
-  }
+  const auto num_parameter_values = _read_buffer.template get_value<uint16_t>();
+  AssertInput(parameter_format_codes.size() <= 1 || parameter_format_codes.size() == num_parameter_values,
+              "Number of parameter format codes does not match the number of parameters");
 
-  const auto num_parameter_values = _read_buffer.template get_value<int16_t>();
+  const auto parameter_object_ids_iter = _parameter_object_ids.find(statement_name);
 
   std::vector<AllTypeVariant> parameter_values;
-  for (auto i = 0; i < num_parameter_values; ++i) {
+  for (auto i = size_t{0}; i < num_parameter_values; ++i) {
     const auto parameter_value_length = _read_buffer.template get_value<int32_t>();
-    parameter_values.emplace_back(pmr_string{_read_buffer.get_string(parameter_value_length, HasNullTerminator::No)});
-  }
-
-  const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
+    // NULL values are represented by setting the value's length to -1
+    if (parameter_value_length == -1) {
+      parameter_values.emplace_back(NULL_VALUE);
+      continue;
+    }
 
-  for (auto i = 0; i < num_result_column_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
+    auto parameter_value = _read_buffer.get_string(parameter_value_length, HasNullTerminator::No);
+    if (format_code_at(parameter_format_codes, i) == FormatCode::Text) {
+      parameter_values.emplace_back(pmr_string{parameter_value});
+    } else {
+      auto object_id = uint32_t{0};
+      if (parameter_object_ids_iter != _parameter_object_ids.end() && i < parameter_object_ids_iter->second.size()) {
+        object_id = parameter_object_ids_iter->second[i];
+      }
+      parameter_values.emplace_back(read_binary_parameter(parameter_value, object_id));
+    }
   }
 
-  return {statement_name, portal, parameter_values};
+  auto result_format_codes = _read_format_codes();
+
+  return {statement_name, portal, parameter_values, result_format_codes};
 }
 
 template <typename SocketType>
-std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
+std::pair<std::string, uint32_t> PostgresProtocolHandler<SocketType>::read_execute_packet() {
   const auto packet_size = _read_buffer.template get_value<uint32_t>();
   const auto portal = _read_buffer.get_string(packet_size - 2 * sizeof(uint32_t));
   /* https://www.postgresql.org/docs/12/protocol-flow.html:
@@ -223,8 +378,8 @@ std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
    the command is always executed to completion, and the row count is ignored.
   */
   const auto row_limit = _read_buffer.template get_value<int32_t>();
-  Assert(row_limit == 0, "Row limit of 0 (unlimited) expected.");
-  return portal;
+  AssertInput(row_limit >= 0, "Row limit must not be negative.");
+  return {portal, static_cast<uint32_t>(row_limit)};
 }
 
 template <typename SocketType>
@@ -272,6 +427,20 @@ void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   _write_buffer.flush();
 }
 
+template <typename SocketType>
+std::vector<FormatCode> PostgresProtocolHandler<SocketType>::_read_format_codes() {
+  const auto num_format_codes = _read_buffer.template get_value<uint16_t>();
+
+  auto format_codes = std::vector<FormatCode>(num_format_codes);
+  for (auto i = 0; i < num_format_codes; i++) {
+    const auto format_code = _read_buffer.template get_value<int16_t>();
+    AssertInput(format_code == 0 || format_code == 1, "Unknown format code " + std::to_string(format_code));
+    format_codes[i] = static_cast<FormatCode>(format_code);
+  }
+
+  return format_codes;
+}
+
 template class PostgresProtocolHandler<Socket>;
 // For testing purposes only. stream_descriptor is used to write data to file
 template class PostgresProtocolHandler<boost::asio::posix::stream_descriptor>;
@@ -1,23 +1,51 @@
 #pragma once
 
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include "all_type_variant.hpp"
 #include "postgres_message_type.hpp"
 #include "read_buffer.hpp"
+#include "utils/assert.hpp"
 #include "write_buffer.hpp"
 
 namespace opossum {
 
 using ErrorMessage = std::unordered_map<PostgresMessageType, std::string>;
 
-// This struct stores a prepared statement's name, its portal used and the specified parameters.
+// This struct stores a prepared statement's name, its portal used, the specified parameters, and the format codes
+// requested for the result columns.
 struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
   std::vector<AllTypeVariant> parameters;
+  std::vector<FormatCode> result_format_codes;
 };
 
+// Returns the format of the value at the given index. Bind messages specify either no format code (all values are in
+// text format), a single one that applies to all values, or one format code per value.
+FormatCode format_code_at(const std::vector<FormatCode>& format_codes, const size_t index);
+
+// Converts a binary value (e.g., of a parameter or of binary COPY data) from network byte order (big-endian). Bits is
+// the unsigned integer type with the size of T.
+template <typename T, typename Bits>
+T from_network_bytes(const std::string_view bytes) {
+  static_assert(sizeof(T) == sizeof(Bits));
+  AssertInput(bytes.size() == sizeof(T), "Invalid length of binary value");
+
+  auto bits = Bits{0};
+  for (const auto byte : bytes) {
+    bits = static_cast<Bits>((bits << 8u) | static_cast<unsigned char>(byte));
+  }
+  auto value = T{};
+  std::memcpy(&value, &bits, sizeof(T));
+  return value;
+}
+
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
 // Wire Protocol.
 template <typename SocketType>
@@ -25,9 +53,33 @@ class PostgresProtocolHandler {
  public:
   explicit PostgresProtocolHandler(const std::shared_ptr<SocketType>& socket);
 
+  // Receive the startup packet without blocking the calling thread and call handler(error_code) once it is buffered.
+  // SSL requests that precede the startup packet are denied in the meantime.
+  template <typename Handler>
+  void async_receive_startup_packet(const Handler& handler) {
+    _read_buffer.async_receive(2 * LENGTH_FIELD_SIZE, [this, handler](const boost::system::error_code& error_code) {
+      if (error_code) {
+        handler(error_code);
+        return;
+      }
+
+      if (_read_buffer.template peek_value<uint32_t>(LENGTH_FIELD_SIZE) == SSL_REQUEST_CODE) {
+        _read_buffer.template get_value<uint32_t>();
+        _read_buffer.template get_value<uint32_t>();
+        _ssl_deny();
+        async_receive_startup_packet(handler);
+        return;
+      }
+
+      _read_buffer.async_receive(_read_buffer.template peek_value<uint32_t>(0), handler);
+    });
+  }
+
   // Handle the startup packet header returning the body's size
   uint32_t read_startup_packet_header();
-  void read_startup_packet_body(const uint32_t size);
+
+  // Read the startup packet body returning the parameters sent by the client (e.g., user, database)
+  std::unordered_map<std::string, std::string> read_startup_packet_body(const uint32_t size);
 
   // Setup new connection: successful authentication + sending parameters
   void send_authentication_response();
@@ -36,6 +88,27 @@ class PostgresProtocolHandler {
   // Ready to receive a new packet
   void send_ready_for_query();
 
+  // Receive the next message without blocking the calling thread and call handler(error_code) once it is buffered or
+  // once the read buffer is full, i.e., if the message is larger than the buffer.
+  template <typename Handler>
+  void async_receive_message(const Handler& handler) {
+    _read_buffer.async_receive(sizeof(PostgresMessageType) + LENGTH_FIELD_SIZE,
+                               [this, handler](const boost::system::error_code& error_code) {
+                                 if (error_code) {
+                                   handler(error_code);
+                                   return;
+                                 }
+                                 const auto message_length = _read_buffer.template peek_value<uint32_t>(1);
+                                 _read_buffer.async_receive(sizeof(PostgresMessageType) + message_length, handler);
+                               });
+  }
+
+  // Returns whether the next message has been received completely, so that reading it does not block.
+  bool is_message_buffered() const;
+
+  // Returns the query of the next message if it is a completely received SQL query packet.
+  std::optional<std::string> buffered_query() const;
+
   // Read first byte of next packet to determine its type
   PostgresMessageType read_packet_type();
 
@@ -44,22 +117,37 @@ class PostgresProtocolHandler {
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const FormatCode format_code = FormatCode::Text);
   void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
                      const uint32_t string_length_sum);
+  // Send a batch of DataRow messages that have already been serialized (including their message type and length)
+  void send_data_rows(const std::vector<boost::asio::const_buffer>& data_rows);
   void send_command_complete(const std::string& command_complete_message);
 
   // Messages for parsing prepared statements
   std::pair<std::string, std::string> read_parse_packet();
   void read_sync_packet();
 
+  // Messages of the COPY sub-protocol. CopyInResponse and CopyOutResponse specify the format of all columns, the end
+  // of the COPY data is signaled by a status message (CopyDone).
+  void send_copy_response(const PostgresMessageType message_type, const FormatCode format_code,
+                          const uint16_t column_count);
+  void send_copy_data(const std::string& data);
+  std::string read_copy_data_packet();
+  void read_copy_done_packet();
+  std::string read_copy_fail_packet();
+
   // Send out status message containing PostgresMessageType and length
   void send_status_message(const PostgresMessageType message_type);
 
   // Series of packets for binding and executing prepared statements
   void read_describe_packet();
   PreparedStatementDetails read_bind_packet();
-  std::string read_execute_packet();
+  // Returns the portal's name and the maximum number of rows to send (0 means all rows)
+  std::pair<std::string, uint32_t> read_execute_packet();
+  // Returns whether a statement ('S') or a portal ('P') is closed and its name
+  std::pair<char, std::string> read_close_packet();
 
   // Send error message to client if there is an error during parsing or execution
   void send_error_message(const ErrorMessage& error_message);
@@ -67,12 +155,24 @@ class PostgresProtocolHandler {
   // Additional (optional) message containing execution times of different components (such as translator or optimizer)
   void send_execution_info(const std::string& execution_information);
 
-  // This method is required for testing. Otherwise we cannot make the protocol handler flush its data.
+  // This method is required for testing and for COPY FROM STDIN, where the client waits for the CopyInResponse.
+  // Otherwise we cannot make the protocol handler flush its data.
   void force_flush() { _write_buffer.flush(); }
 
+
  private:
+  // Special SSL version number that we catch to deny SSL support
+  static constexpr auto SSL_REQUEST_CODE = 80877103u;
+
   void _ssl_deny();
+
+  // Read the format codes of parameters or result columns in a Bind message
+  std::vector<FormatCode> _read_format_codes();
+
   ReadBuffer<SocketType> _read_buffer;
   WriteBuffer<SocketType> _write_buffer;
+
+  // Object IDs of the parameter types specified in the Parse messages, needed to read binary parameters
+  std::unordered_map<std::string, std::vector<uint32_t>> _parameter_object_ids;
 };
 }  // namespace opossum
@@ -7,13 +7,14 @@
 namespace opossum {
 
 ExecutionInformation QueryHandler::execute_pipeline(const std::string& query,
-                                                    const SendExecutionInfo send_execution_info) {
+                                                    const SendExecutionInfo send_execution_info,
+                                                    const SchedulingClass scheduling_class) {
   // A simple query command invalidates unnamed statements
   // See: https://postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
   if (Hyrise::get().storage_manager.has_prepared_plan("")) Hyrise::get().storage_manager.drop_prepared_plan("");
 
   auto execution_info = ExecutionInformation();
-  auto sql_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+  auto sql_pipeline = SQLPipelineBuilder{query}.with_scheduling_class(scheduling_class).create_pipeline();
 
   const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
   if (pipeline_status == SQLPipelineStatus::Success) {
@@ -74,12 +75,28 @@ std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const Prepare
   }
 
   const auto lqp = prepared_plan->instantiate(parameter_expressions);
+
+  // The result format codes are looked up by column when the result is sent (see format_code_at). Check them now, so
+  // that the Bind fails instead of the Execute after the plan has been executed.
+  const auto& result_format_codes = statement_details.result_format_codes;
+  AssertInput(result_format_codes.size() <= 1 || result_format_codes.size() == lqp->column_expressions().size(),
+              "Number of result format codes does not match the number of result columns");
+
   return LQPTranslator{}.translate_node(lqp);
 }
 
-std::shared_ptr<const Table> QueryHandler::execute_prepared_plan(
-    const std::shared_ptr<AbstractOperator>& physical_plan) {
+void QueryHandler::close_prepared_plan(const std::string& statement_name) {
+  if (!Hyrise::get().storage_manager.has_prepared_plan(statement_name)) return;
+  Hyrise::get().storage_manager.drop_prepared_plan(statement_name);
+}
+
+std::shared_ptr<const Table> QueryHandler::execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan,
+                                                                 const SchedulingClass scheduling_class) {
   const auto tasks = OperatorTask::make_tasks_from_operator(physical_plan);
+  const auto task_group_id = AbstractTask::create_task_group_id();
+  for (const auto& task : tasks) {
+    task->set_scheduling_class(scheduling_class, task_group_id);
+  }
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
   return tasks.back()->get_operator()->get_output();
 }
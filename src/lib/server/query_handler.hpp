@@ -22,13 +22,21 @@ struct ExecutionInformation {
 // error handling happens in this class.
 class QueryHandler {
  public:
-  static ExecutionInformation execute_pipeline(const std::string& query, const SendExecutionInfo send_execution_info);
+  // The tasks of the query are scheduled with the given scheduling class, so that the queries of different sessions can
+  // be prioritized against each other (see TaskQueue).
+  static ExecutionInformation execute_pipeline(const std::string& query, const SendExecutionInfo send_execution_info,
+                                               const SchedulingClass scheduling_class = SchedulingClass::Default);
 
   static void setup_prepared_plan(const std::string& statement_name, const std::string& query);
 
   static std::shared_ptr<AbstractOperator> bind_prepared_plan(const PreparedStatementDetails& statement_details);
 
-  static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan);
+  // Removes the prepared plan if it exists
+  static void close_prepared_plan(const std::string& statement_name);
+
+  static std::shared_ptr<const Table> execute_prepared_plan(
+      const std::shared_ptr<AbstractOperator>& physical_plan,
+      const SchedulingClass scheduling_class = SchedulingClass::Default);
 };
 
 }  // namespace opossum
@@ -81,24 +81,9 @@ void ReadBuffer<SocketType>::_receive_if_necessary(const size_t bytes_required)
     return;
   }
 
-  // Buffer might contain unread data, so cannot read full buffer size
-  const auto maximum_readable_size = maximum_capacity() - size();
-
-  size_t bytes_read;
   boost::system::error_code error_code;
-  // We cannot forward an iterator to the read system call. Hence, we need to use raw pointers. Therefore, we need to
-  // distinguish between reading into continuous memory or partially read the data.
-  if (std::distance(&*_start_position, &*_current_position) < 0 || &*_start_position == &_data[0]) {
-    bytes_read = boost::asio::read(*_socket, boost::asio::buffer(&*_current_position, maximum_readable_size),
-                                   boost::asio::transfer_at_least(bytes_required - size()), error_code);
-  } else {
-    bytes_read =
-        boost::asio::read(*_socket,
-                          std::array<boost::asio::mutable_buffer, 2>{
-                              boost::asio::buffer(&*_current_position, std::distance(&*_current_position, _data.end())),
-                              boost::asio::buffer(_data.begin(), std::distance(_data.begin(), &*_start_position - 1))},
-                          boost::asio::transfer_at_least(bytes_required - size()), error_code);
-  }
+  const auto bytes_read = boost::asio::read(*_socket, _free_space(),
+                                            boost::asio::transfer_at_least(bytes_required - size()), error_code);
 
   // Socket was closed by client during execution
   if (error_code == boost::asio::error::broken_pipe || error_code == boost::asio::error::connection_reset ||
@@ -111,6 +96,29 @@ void ReadBuffer<SocketType>::_receive_if_necessary(const size_t bytes_required)
   std::advance(_current_position, bytes_read);
 }
 
+template <typename SocketType>
+std::string ReadBuffer<SocketType>::peek_string(const size_t offset, const size_t string_length) const {
+  DebugAssert(size() >= offset + string_length, "String has not been received yet");
+  auto result = std::string{};
+  result.reserve(string_length);
+  std::copy_n(std::next(_start_position, offset), string_length, std::back_inserter(result));
+  return result;
+}
+
+template <typename SocketType>
+std::array<boost::asio::mutable_buffer, 2> ReadBuffer<SocketType>::_free_space() {
+  // Buffer might contain unread data, so cannot read full buffer size
+  const auto maximum_readable_size = maximum_capacity() - size();
+
+  // We cannot forward an iterator to the read system call. Hence, we need to use raw pointers. Therefore, we need to
+  // distinguish between reading into continuous memory or partially read the data.
+  if (std::distance(&*_start_position, &*_current_position) < 0 || &*_start_position == &_data[0]) {
+    return {boost::asio::buffer(&*_current_position, maximum_readable_size), boost::asio::mutable_buffer{}};
+  }
+  return {boost::asio::buffer(&*_current_position, std::distance(&*_current_position, _data.end())),
+          boost::asio::buffer(_data.begin(), std::distance(_data.begin(), &*_start_position - 1))};
+}
+
 template class ReadBuffer<Socket>;
 template class ReadBuffer<boost::asio::posix::stream_descriptor>;
 
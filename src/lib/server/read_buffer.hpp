@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <string>
+
 #include "ring_buffer_iterator.hpp"
 #include "server_types.hpp"
 #include "types.hpp"
@@ -29,9 +33,18 @@ class ReadBuffer {
   template <typename T>
   T get_value() {
     _receive_if_necessary(sizeof(T));
-    T network_value = 0;
-    std::copy_n(_start_position, sizeof(T), reinterpret_cast<char*>(&network_value));
+    const auto value = peek_value<T>(0);
     std::advance(_start_position, sizeof(T));
+    return value;
+  }
+
+  // Returns the value that starts offset bytes after the first unread byte without consuming it. The value has to be
+  // buffered already.
+  template <typename T>
+  T peek_value(const size_t offset) const {
+    DebugAssert(size() >= offset + sizeof(T), "Value has not been received yet");
+    T network_value = 0;
+    std::copy_n(std::next(_start_position, offset), sizeof(T), reinterpret_cast<char*>(&network_value));
     if constexpr (std::is_same_v<T, uint16_t> || std::is_same_v<T, int16_t>) {
       return ntohs(network_value);
     } else if constexpr (std::is_same_v<T, uint32_t> || std::is_same_v<T, int32_t>) {
@@ -47,9 +60,33 @@ class ReadBuffer {
                          const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
   std::string get_string();
 
+  // Returns string_length bytes that start offset bytes after the first unread byte without consuming them. They have
+  // to be buffered already.
+  std::string peek_string(const size_t offset, const size_t string_length) const;
+
+  // Receives data without blocking until at least bytes_required bytes are buffered or the buffer is full. Then,
+  // handler(error_code) is called, right away if enough data is buffered already. No other read may happen meanwhile.
+  template <typename Handler>
+  void async_receive(const size_t bytes_required, const Handler& handler) {
+    const auto bytes_to_buffer = std::min(bytes_required, maximum_capacity());
+    if (size() >= bytes_to_buffer) {
+      handler(boost::system::error_code{});
+      return;
+    }
+
+    boost::asio::async_read(*_socket, _free_space(), boost::asio::transfer_at_least(bytes_to_buffer - size()),
+                            [this, handler](const boost::system::error_code& error_code, const size_t bytes_read) {
+                              std::advance(_current_position, bytes_read);
+                              handler(error_code);
+                            });
+  }
+
  private:
   void _receive_if_necessary(const size_t bytes_required = 1);
 
+  // Returns the part of the buffer that can be received into. It consists of two parts if it wraps around.
+  std::array<boost::asio::mutable_buffer, 2> _free_space();
+
   std::array<char, SERVER_BUFFER_SIZE> _data;
   // This iterator points to the first element that has not been read yet.
   RingBufferIterator _start_position{_data};
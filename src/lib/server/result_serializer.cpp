@@ -1,12 +1,314 @@
 #include "result_serializer.hpp"
-#include "lossy_cast.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Maximum number of characters of a value's text representation (e.g., "-2147483648" or "-1.23456791e+38")
+template <typename T>
+constexpr size_t max_text_width() {
+  if constexpr (std::is_integral_v<T>) {
+    return std::numeric_limits<T>::digits10 + 2;
+  } else {
+    // Sign, digits, decimal point, and exponent
+    return std::numeric_limits<T>::max_digits10 + 8;
+  }
+}
+
+size_t estimated_text_width(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Int:
+      return max_text_width<int32_t>();
+    case DataType::Long:
+      return max_text_width<int64_t>();
+    case DataType::Float:
+      return max_text_width<float>();
+    case DataType::Double:
+      return max_text_width<double>();
+    case DataType::String:
+      return 16;
+    case DataType::Null:
+      break;
+  }
+  Fail("Bad DataType");
+}
+
+using FieldFormat = ResultStream::FieldFormat;
+
+void append_network_value(std::string& row, const int32_t value) {
+  const auto network_value = htonl(static_cast<uint32_t>(value));
+  row.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+}
+
+void append_network_value(std::string& row, const int16_t value) {
+  const auto network_value = htons(static_cast<uint16_t>(value));
+  row.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+}
+
+// Appends the text representation of a numeric value
+template <typename T>
+void append_text(std::string& row, const T value) {
+  auto text = std::array<char, max_text_width<T>() + 1>{};
+  auto text_length = size_t{0};
+  if constexpr (std::is_integral_v<T>) {
+    text_length = std::to_chars(text.data(), text.data() + text.size(), value).ptr - text.data();
+  } else {
+    // Same representation as boost::lexical_cast, which was used before (i.e., precise enough for a round trip)
+    text_length = std::snprintf(text.data(), text.size(), "%.*g", std::numeric_limits<T>::max_digits10,
+                                static_cast<double>(value));
+  }
+  row.append(text.data(), text_length);
+}
+
+// Appends the length of the value's text representation followed by the text itself. Text mode means that all values
+// are sent as non-terminated strings.
+template <typename T>
+void append_text_value(std::string& row, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    append_network_value(row, static_cast<int32_t>(value.size()));
+    row.append(value.data(), value.size());
+  } else {
+    // The length is only known after formatting the value
+    const auto length_position = row.size();
+    append_network_value(row, int32_t{0});
+    append_text(row, value);
+    const auto network_length = htonl(static_cast<uint32_t>(row.size() - length_position - LENGTH_FIELD_SIZE));
+    std::memcpy(&row[length_position], &network_length, LENGTH_FIELD_SIZE);
+  }
+}
+
+// Appends the length of the value's binary representation followed by the value in network byte order
+template <typename T>
+void append_binary_value(std::string& row, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // The binary representation of text is the text itself
+    append_text_value(row, value);
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    static_assert(sizeof(T) == sizeof(Bits));
+
+    auto bits = Bits{};
+    std::memcpy(&bits, &value, sizeof(T));
+    auto bytes = std::array<char, sizeof(T)>{};
+    for (auto byte_id = size_t{0}; byte_id < sizeof(T); ++byte_id) {
+      bytes[byte_id] = static_cast<char>(bits >> (8u * (sizeof(T) - 1 - byte_id)));
+    }
+
+    append_network_value(row, static_cast<int32_t>(sizeof(T)));
+    row.append(bytes.data(), bytes.size());
+  }
+}
+
+// Appends the value in COPY's text format, where backslashes, tabs, and line breaks in strings are escaped
+template <typename T>
+void append_copy_text_value(std::string& row, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (const auto character : value) {
+      switch (character) {
+        case '\\':
+          row.append("\\\\");
+          break;
+        case '\t':
+          row.append("\\t");
+          break;
+        case '\n':
+          row.append("\\n");
+          break;
+        case '\r':
+          row.append("\\r");
+          break;
+        default:
+          row.push_back(character);
+      }
+    }
+  } else {
+    append_text(row, value);
+  }
+}
+
+// Appends the value in COPY's CSV format. Strings are quoted if necessary, empty strings are always quoted so that
+// they can be told apart from NULL values.
+template <typename T>
+void append_copy_csv_value(std::string& row, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    if (!value.empty() && value.find_first_of(",\"\n\r") == pmr_string::npos) {
+      row.append(value.data(), value.size());
+      return;
+    }
+
+    row.push_back('"');
+    for (const auto character : value) {
+      if (character == '"') row.push_back('"');
+      row.push_back(character);
+    }
+    row.push_back('"');
+  } else {
+    append_text(row, value);
+  }
+}
+
+// Appends the segment's values to the rows they belong to. The format is a template parameter so that it is not
+// checked for each value.
+template <typename T, FieldFormat field_format>
+void append_segment(const BaseSegment& segment, std::vector<std::string>& rows, const bool is_first_column) {
+  segment_iterate<T>(segment, [&](const auto& position) {
+    auto& row = rows[position.chunk_offset()];
+
+    if constexpr (field_format == FieldFormat::Text || field_format == FieldFormat::Binary) {
+      if (position.is_null()) {
+        // NULL values are represented by setting the value's length to -1
+        append_network_value(row, int32_t{-1});
+      } else if constexpr (field_format == FieldFormat::Binary) {
+        append_binary_value(row, position.value());
+      } else {
+        append_text_value(row, position.value());
+      }
+    } else if constexpr (field_format == FieldFormat::CopyText) {
+      if (!is_first_column) row.push_back('\t');
+      if (position.is_null()) {
+        row.append("\\N");
+      } else {
+        append_copy_text_value(row, position.value());
+      }
+    } else {
+      // NULL values are represented by an empty field
+      if (!is_first_column) row.push_back(',');
+      if (!position.is_null()) append_copy_csv_value(row, position.value());
+    }
+  });
+}
+
+// Header of a DataRow message: message type, message length (filled in once the row is complete), column count
+std::string data_row_header(const size_t column_count) {
+  auto header = std::string(sizeof(PostgresMessageType), static_cast<char>(PostgresMessageType::DataRow));
+  append_network_value(header, int32_t{0});
+  append_network_value(header, static_cast<int16_t>(column_count));
+  return header;
+}
+
+}  // namespace
 
 namespace opossum {
 
+ResultStream::ResultStream(const std::shared_ptr<const Table>& table, const std::string& row_header,
+                           const std::vector<FieldFormat>& field_formats)
+    : _table(table), _row_header(row_header), _field_formats(field_formats) {
+  DebugAssert(_field_formats.size() == static_cast<size_t>(_table->column_count()),
+              "Expected one field format per column");
+  _estimated_row_size = _row_header.size() + sizeof(char);
+  for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+    _estimated_row_size += LENGTH_FIELD_SIZE + estimated_text_width(_table->column_data_type(column_id));
+  }
+}
+
+template <typename SocketType>
+uint64_t ResultStream::send_rows(PostgresProtocolHandler<SocketType>& postgres_protocol_handler,
+                                 const uint64_t max_row_count) {
+  auto sent_row_count = uint64_t{0};
+  while (sent_row_count < max_row_count) {
+    if (_chunk_offset == _chunk_size && !_serialize_next_chunk()) break;
+
+    const auto row_count = static_cast<ChunkOffset>(
+        std::min(static_cast<uint64_t>(_chunk_size - _chunk_offset), max_row_count - sent_row_count));
+    _row_buffers.clear();
+    for (auto chunk_offset = _chunk_offset; chunk_offset < _chunk_offset + row_count; ++chunk_offset) {
+      _row_buffers.emplace_back(boost::asio::buffer(_rows[chunk_offset]));
+    }
+    postgres_protocol_handler.send_data_rows(_row_buffers);
+
+    _chunk_offset += row_count;
+    sent_row_count += row_count;
+  }
+  return sent_row_count;
+}
+
+bool ResultStream::has_unsent_rows() const {
+  if (_chunk_offset < _chunk_size) return true;
+
+  const auto chunk_count = _table->chunk_count();
+  for (auto chunk_id = _next_chunk_id; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    if (chunk && chunk->size() > 0) return true;
+  }
+  return false;
+}
+
+bool ResultStream::_serialize_next_chunk() {
+  const auto chunk_count = _table->chunk_count();
+  auto chunk = std::shared_ptr<const Chunk>{};
+  while (_next_chunk_id < chunk_count && (!chunk || chunk->size() == 0)) {
+    chunk = _table->get_chunk(_next_chunk_id);
+    ++_next_chunk_id;
+  }
+  if (!chunk || chunk->size() == 0) return false;
+
+  const auto chunk_size = chunk->size();
+  if (_rows.size() < chunk_size) _rows.resize(chunk_size);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    auto& row = _rows[chunk_offset];
+    row.reserve(_estimated_row_size);
+    row.assign(_row_header);
+  }
+
+  const auto column_count = _table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& segment = *chunk->get_segment(column_id);
+    const auto is_first_column = column_id == ColumnID{0};
+    resolve_data_type(_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      switch (_field_formats[column_id]) {
+        case FieldFormat::Text:
+          append_segment<ColumnDataType, FieldFormat::Text>(segment, _rows, is_first_column);
+          break;
+        case FieldFormat::Binary:
+          append_segment<ColumnDataType, FieldFormat::Binary>(segment, _rows, is_first_column);
+          break;
+        case FieldFormat::CopyText:
+          append_segment<ColumnDataType, FieldFormat::CopyText>(segment, _rows, is_first_column);
+          break;
+        case FieldFormat::CopyCsv:
+          append_segment<ColumnDataType, FieldFormat::CopyCsv>(segment, _rows, is_first_column);
+          break;
+      }
+    });
+  }
+
+  const auto is_delimited =
+      _field_formats.front() == FieldFormat::CopyText || _field_formats.front() == FieldFormat::CopyCsv;
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    auto& row = _rows[chunk_offset];
+    if (is_delimited) row.push_back('\n');
+
+    // The message length does not include the message type
+    const auto network_message_length = htonl(static_cast<uint32_t>(row.size() - sizeof(PostgresMessageType)));
+    std::memcpy(&row[sizeof(PostgresMessageType)], &network_message_length, LENGTH_FIELD_SIZE);
+  }
+
+  _chunk_size = chunk_size;
+  _chunk_offset = ChunkOffset{0};
+  return true;
+}
+
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& result_format_codes) {
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -47,45 +349,69 @@ void ResultSerializer::send_table_description(
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width,
+                                                    format_code_at(result_format_codes, column_id));
   }
 }
 
 template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& result_format_codes) {
+  create_query_response_stream(table, result_format_codes)->send_rows(*postgres_protocol_handler);
+}
 
-  const auto chunk_count = table->chunk_count();
+std::shared_ptr<ResultStream> ResultSerializer::create_query_response_stream(
+    const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& result_format_codes) {
+  const auto column_count = table->column_count();
+  AssertInput(result_format_codes.size() <= 1 || result_format_codes.size() == static_cast<size_t>(column_count),
+              "Number of result format codes does not match the number of result columns");
 
-  // Iterate over each chunk in result table
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
-    const auto chunk = table->get_chunk(chunk_id);
-    const auto chunk_size = chunk->size();
+  auto field_formats = std::vector<FieldFormat>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto format_code = format_code_at(result_format_codes, column_id);
+    field_formats[column_id] = format_code == FormatCode::Binary ? FieldFormat::Binary : FieldFormat::Text;
+  }
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
-    for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
-    }
+  return std::make_shared<ResultStream>(table, data_row_header(column_count), field_formats);
+}
 
-    // Iterate over each row in chunk
-    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = 0;
-      // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value.has_value()) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += string_value.value().size();
-        }
-        values_as_strings[segment_id] = string_value;
-      }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
-    }
+template <typename SocketType>
+void ResultSerializer::send_copy_data(
+    const std::shared_ptr<const Table>& table,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const CopyFormat copy_format) {
+  const auto column_count = table->column_count();
+
+  // Header of a CopyData message: message type, message length (filled in once the row is complete)
+  auto copy_data_header = std::string(sizeof(PostgresMessageType), static_cast<char>(PostgresMessageType::CopyData));
+  append_network_value(copy_data_header, int32_t{0});
+
+  switch (copy_format) {
+    case CopyFormat::Text:
+      ResultStream{table, copy_data_header, std::vector<FieldFormat>(column_count, FieldFormat::CopyText)}.send_rows(
+          *postgres_protocol_handler);
+      break;
+    case CopyFormat::Csv:
+      ResultStream{table, copy_data_header, std::vector<FieldFormat>(column_count, FieldFormat::CopyCsv)}.send_rows(
+          *postgres_protocol_handler);
+      break;
+    case CopyFormat::Binary: {
+      // Signature, flags field, and length of the header extension area
+      postgres_protocol_handler->send_copy_data(
+          std::string{BINARY_COPY_SIGNATURE.data(), BINARY_COPY_SIGNATURE.size()} + std::string(8, '\0'));
+
+      // Each tuple starts with its number of fields
+      append_network_value(copy_data_header, static_cast<int16_t>(column_count));
+      ResultStream{table, copy_data_header, std::vector<FieldFormat>(column_count, FieldFormat::Binary)}.send_rows(
+          *postgres_protocol_handler);
+
+      // The trailer is a field count of -1
+      auto trailer = std::string{};
+      append_network_value(trailer, int16_t{-1});
+      postgres_protocol_handler->send_copy_data(trailer);
+    } break;
   }
 }
 
@@ -112,18 +438,35 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
   }
 }
 
+template uint64_t ResultStream::send_rows<Socket>(PostgresProtocolHandler<Socket>&, const uint64_t);
+
+template uint64_t ResultStream::send_rows<boost::asio::posix::stream_descriptor>(
+    PostgresProtocolHandler<boost::asio::posix::stream_descriptor>&, const uint64_t);
+
 template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                               const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                            const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
+
+template void ResultSerializer::send_copy_data<Socket>(const std::shared_ptr<const Table>&,
+                                                       const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                       const CopyFormat);
+
+template void ResultSerializer::send_copy_data<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&, const CopyFormat);
 
 }  // namespace opossum
@@ -1,26 +1,87 @@
 #pragma once
 
+#include <limits>
 #include <memory>
+#include <string>
+#include <vector>
+
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
+// Sends the rows of a result table as DataRow messages (or CopyData messages for COPY TO STDOUT). The rows are
+// serialized column by column (i.e., the segment's type is resolved once per chunk) into per-row buffers, which are
+// then sent as a batch. A result can be sent in several portions, e.g., if Execute messages limit the number of rows
+// that are sent from a portal. Only the rows of the current chunk are kept in serialized form, and each chunk is only
+// serialized once.
+class ResultStream {
+ public:
+  // How values are written into the rows: Length-prefixed text or binary values (DataRow messages and binary COPY
+  // data) or escaped text values separated by delimiters (COPY data in text or CSV format)
+  enum class FieldFormat { Text, Binary, CopyText, CopyCsv };
+
+  // Each row starts with the given header, whose length field is filled in once the row is complete
+  ResultStream(const std::shared_ptr<const Table>& table, const std::string& row_header,
+               const std::vector<FieldFormat>& field_formats);
+
+  // Send up to max_row_count of the rows that have not been sent yet and return the number of sent rows
+  template <typename SocketType>
+  uint64_t send_rows(PostgresProtocolHandler<SocketType>& postgres_protocol_handler,
+                     const uint64_t max_row_count = std::numeric_limits<uint64_t>::max());
+
+  bool has_unsent_rows() const;
+
+ private:
+  // Serialize the rows of the next chunk that is not empty. Returns false if there is none.
+  bool _serialize_next_chunk();
+
+  const std::shared_ptr<const Table> _table;
+  const std::string _row_header;
+  const std::vector<FieldFormat> _field_formats;
+  // Estimated size of a row, used for pre-sizing the row buffers
+  size_t _estimated_row_size{0};
+
+  // The row buffers are reused for all chunks so that their memory is only allocated once
+  std::vector<std::string> _rows;
+  std::vector<boost::asio::const_buffer> _row_buffers;
+
+  ChunkID _next_chunk_id{0};
+  // Rows of the current chunk that have been serialized (_chunk_size) and sent (_chunk_offset)
+  ChunkOffset _chunk_size{0};
+  ChunkOffset _chunk_offset{0};
+};
+
 // The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
 class ResultSerializer {
  public:
-  // Serialize information about the result table
+  // Serialize information about the result table. The format codes are the ones requested in the Bind message (see
+  // format_code_at), the simple query protocol always uses the text format.
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& result_format_codes = {});
 
+  // Send the result table's rows as DataRow messages. Values are converted to their text or binary representation
+  // (see ResultStream).
   template <typename SocketType>
-  // Cast attributes of the result table and send them row-wise
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& result_format_codes = {});
+
+  // Create a stream that sends the result table's rows as DataRow messages in several portions
+  static std::shared_ptr<ResultStream> create_query_response_stream(
+      const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& result_format_codes = {});
+
+  // Send the result table's rows as CopyData messages (COPY TO STDOUT). In the binary format, the rows are preceded by
+  // the header and followed by the trailer of PostgreSQL's binary COPY format.
+  template <typename SocketType>
+  static void send_copy_data(const std::shared_ptr<const Table>& table,
+                             const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+                             const CopyFormat copy_format);
 
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const OperatorType root_operator_type, const uint64_t row_count);
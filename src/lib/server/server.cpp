@@ -4,20 +4,37 @@
 
 #include <iostream>
 #include <thread>
+#include <vector>
 
 namespace opossum {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const SessionMode session_mode,
+               const uint32_t io_thread_count)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)),
+      _send_execution_info(send_execution_info),
+      _session_mode(session_mode),
+      _io_thread_count(io_thread_count) {
+  Assert(_io_thread_count > 0, "The server requires at least one I/O thread");
   std::cout << "Server started at " << server_address() << " and port " << server_port() << std::endl
             << "Run 'psql -h localhost' to connect to the server" << std::endl;
 }
 
 void Server::run() {
   _accept_new_session();
+
+  // The calling thread is one of the I/O threads
+  auto io_threads = std::vector<std::thread>{};
+  io_threads.reserve(_io_thread_count - 1);
+  for (auto thread_id = uint32_t{1}; thread_id < _io_thread_count; ++thread_id) {
+    io_threads.emplace_back([&]() { _io_service.run(); });
+  }
   _io_service.run();
+
+  for (auto& io_thread : io_threads) {
+    io_thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
@@ -32,6 +49,12 @@ void Server::_accept_new_session() {
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
   Assert(!error, error.message());
 
+  if (_session_mode == SessionMode::Asynchronous) {
+    new_session->start_async();
+    _accept_new_session();
+    return;
+  }
+
   std::thread session_thread([new_session] {
     const std::string thread_name = "server_p_" + std::to_string(new_session->socket()->remote_endpoint().port());
 #ifdef __APPLE__
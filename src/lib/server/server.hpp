@@ -10,7 +10,8 @@ namespace opossum {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client, either on a thread of its own or
+*           asynchronously on the server's I/O threads (see SessionMode).
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
 *            session-specific data.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
@@ -29,9 +30,12 @@ namespace opossum {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  // For asynchronous sessions, io_thread_count threads wait for new connections and requests. Threaded sessions only
+  // use them for accepting connections.
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const SessionMode session_mode = SessionMode::Threaded, const uint32_t io_thread_count = 1);
 
-  // Start server to accept new sessions.
+  // Start server to accept new sessions. Returns once the server has been shut down.
   void run();
 
   // Return the port the server is running on.
@@ -51,5 +55,7 @@ class Server {
   boost::asio::io_service _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   const SendExecutionInfo _send_execution_info;
+  const SessionMode _session_mode;
+  const uint32_t _io_thread_count;
 };
 }  // namespace opossum
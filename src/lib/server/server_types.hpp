@@ -10,4 +10,16 @@ enum class HasNullTerminator : bool { Yes = true, No = false };
 
 enum class SendExecutionInfo : bool { Yes = true, No = false };
 
+// Format of parameters and result columns as specified in Bind messages. Binary values use the type's binary
+// representation in network byte order, e.g., four bytes for an int4.
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
+// Threaded sessions run on a dedicated thread per connection, which blocks while waiting for the client. Asynchronous
+// sessions wait for requests on the server's fixed pool of I/O threads and handle each request as a task on the
+// scheduler, so that idle connections do not occupy a thread.
+enum class SessionMode { Threaded, Asynchronous };
+
+// Formats of the data transferred by COPY FROM STDIN and COPY TO STDOUT
+enum class CopyFormat { Text, Csv, Binary };
+
 }  // namespace opossum
@@ -1,9 +1,15 @@
 #include "session.hpp"
 
+#include <limits>
+#include <thread>
+
 #include "client_disconnect_exception.hpp"
+#include "constant_mappings.hpp"
+#include "copy_handler.hpp"
 #include "postgres_message_type.hpp"
 #include "query_handler.hpp"
 #include "result_serializer.hpp"
+#include "scheduler/job_task.hpp"
 
 namespace opossum {
 
@@ -21,35 +27,113 @@ void Session::run() {
   _socket->set_option(boost::asio::ip::tcp::no_delay(true));
   _establish_connection();
   while (!_terminate_session) {
+    _handle_request_or_send_error();
+  }
+}
+
+void Session::start_async() {
+  // See Session::run()
+  _socket->set_option(boost::asio::ip::tcp::no_delay(true));
+  // The startup packet is received on the I/O thread so that reading it does not block a worker
+  _postgres_protocol_handler->async_receive_startup_packet(
+      [session = shared_from_this()](const boost::system::error_code& error) {
+        if (error) return;
+        session->_schedule_async(&Session::_establish_connection, false);
+      });
+}
+
+void Session::_handle_request_or_send_error() {
+  try {
+    _handle_request();
+  } catch (const ClientDisconnectException&) {
+    _terminate_session = true;
+  } catch (const std::exception& e) {
+    std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
+              << e.what() << std::endl;
+    const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
+    _postgres_protocol_handler->send_error_message(error_message);
+    _postgres_protocol_handler->send_ready_for_query();
+    // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+    // Messages that have already been received are processed further. A "sync" message makes the server send another
+    // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
+    // query arrives it must be set to false again to ensure correct message flow.
+    _sync_send_after_error = true;
+  }
+}
+
+void Session::_wait_for_request_async() {
+  _postgres_protocol_handler->async_receive_message(
+      [session = shared_from_this()](const boost::system::error_code& error) {
+        // The receive is aborted if the server shuts down or the client disconnects. Otherwise, the next message is
+        // buffered, unless it is larger than the read buffer.
+        if (error) return;
+        const auto may_block =
+            !session->_postgres_protocol_handler->is_message_buffered() || session->_is_copy_from_stdin_buffered();
+        session->_schedule_async(&Session::_handle_request_or_send_error, may_block);
+      });
+}
+
+bool Session::_is_copy_from_stdin_buffered() const {
+  const auto query = _postgres_protocol_handler->buffered_query();
+  if (!query) return false;
+
+  try {
+    const auto copy_statement = CopyHandler::parse_copy_statement(*query);
+    return copy_statement && copy_statement->direction == CopyDirection::FromStdin;
+  } catch (const InvalidInputException&) {
+    // The error is sent to the client when the query is handled
+    return false;
+  }
+}
+
+void Session::_schedule_async(void (Session::*handler)(), const bool may_block) {
+  // The task holds a reference to the session so that the session is destroyed (and the socket is closed) once the
+  // client disconnects and no further request is waited for. Query execution schedules the operator tasks of the
+  // request and waits for them. If this happens within a worker, the worker executes other tasks in the meantime.
+  auto handle = [session = shared_from_this(), handler]() {
     try {
-      _handle_request();
+      (session.get()->*handler)();
     } catch (const ClientDisconnectException&) {
       return;
     } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
-                << e.what() << std::endl;
-      const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_message);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
+      // Unlike Session::run(), the task must not let exceptions escape, e.g., if the startup packet is invalid
+      std::cerr << "Exception in session: " << e.what() << std::endl;
+      return;
     }
+
+    if (!session->_terminate_session) session->_wait_for_request_async();
+  };
+
+  // Handlers that wait for the client would occupy a worker for as long as the client takes to send its data. Hence,
+  // they run on a thread of their own.
+  if (may_block) {
+    std::thread{std::move(handle)}.detach();
+    return;
   }
+
+  const auto task = std::make_shared<JobTask>(std::move(handle));
+  task->schedule();
 }
 
 void Session::_establish_connection() {
   const auto body_length = _postgres_protocol_handler->read_startup_packet_header();
 
-  // Currently, the information available in the start up packet body (such as db name, user name) is ignored
-  _postgres_protocol_handler->read_startup_packet_body(body_length);
+  // Currently, most of the information available in the start up packet body (such as db name, user name) is ignored.
+  // The only parameter we evaluate is the scheduling class of the session's queries. Unknown classes are ignored. The
+  // client learns about the class that is actually used from the parameters sent back to it.
+  const auto startup_parameters = _postgres_protocol_handler->read_startup_packet_body(body_length);
+  const auto scheduling_class_iter = startup_parameters.find("scheduling_class");
+  if (scheduling_class_iter != startup_parameters.end()) {
+    const auto scheduling_class = scheduling_class_to_string.right.find(scheduling_class_iter->second);
+    if (scheduling_class != scheduling_class_to_string.right.end()) _scheduling_class = scheduling_class->second;
+  }
+
   _postgres_protocol_handler->send_authentication_response();
   _postgres_protocol_handler->send_parameter("server_version", "12");
   _postgres_protocol_handler->send_parameter("server_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("client_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("DateStyle", "ISO, DMY");
+  _postgres_protocol_handler->send_parameter("scheduling_class", scheduling_class_to_string.left.at(_scheduling_class));
   _postgres_protocol_handler->send_ready_for_query();
 }
 
@@ -94,6 +178,17 @@ void Session::_handle_request() {
       _handle_execute();
       break;
     }
+    case PostgresMessageType::CloseCommand: {
+      _handle_close_command();
+      break;
+    }
+    case PostgresMessageType::CopyData:
+    case PostgresMessageType::CopyDone:
+    case PostgresMessageType::CopyFail: {
+      // COPY messages that arrive after an error during COPY FROM STDIN are dropped
+      _postgres_protocol_handler->read_copy_data_packet();
+      break;
+    }
     default:
       Fail("Unknown packet type");
   }
@@ -105,7 +200,13 @@ void Session::_handle_simple_query() {
   // A simple query command invalidates unnamed portals
   _portals.erase("");
 
-  const auto execution_information = QueryHandler::execute_pipeline(query, _send_execution_info);
+  if (const auto copy_statement = CopyHandler::parse_copy_statement(query)) {
+    _handle_copy(*copy_statement);
+    _postgres_protocol_handler->send_ready_for_query();
+    return;
+  }
+
+  const auto execution_information = QueryHandler::execute_pipeline(query, _send_execution_info, _scheduling_class);
 
   if (!execution_information.error_message.empty()) {
     _postgres_protocol_handler->send_error_message(execution_information.error_message);
@@ -127,6 +228,27 @@ void Session::_handle_simple_query() {
   _postgres_protocol_handler->send_ready_for_query();
 }
 
+void Session::_handle_copy(const CopyStatement& copy_statement) {
+  auto row_count = uint64_t{0};
+  if (copy_statement.direction == CopyDirection::FromStdin) {
+    row_count = CopyHandler::copy_from_stdin(copy_statement, _postgres_protocol_handler);
+  } else {
+    const auto execution_information =
+        QueryHandler::execute_pipeline(copy_statement.query, SendExecutionInfo::No, _scheduling_class);
+    if (!execution_information.error_message.empty()) {
+      _postgres_protocol_handler->send_error_message(execution_information.error_message);
+      return;
+    }
+    AssertInput(execution_information.result_table, "COPY TO STDOUT requires a query that returns rows");
+
+    CopyHandler::copy_to_stdout(execution_information.result_table, copy_statement.format,
+                                _postgres_protocol_handler);
+    row_count = execution_information.result_table->row_count();
+  }
+
+  _postgres_protocol_handler->send_command_complete("COPY " + std::to_string(row_count));
+}
+
 void Session::_handle_parse_command() {
   const auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
   QueryHandler::setup_prepared_plan(statement_name, query);
@@ -149,18 +271,34 @@ void Session::_handle_bind_command() {
   }
 
   // Since bind and execute packet usually arrive together, we still have to handle the execute packet. Therefore,
-  // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
-  // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
-  _portals.emplace(parameters.portal, nullptr);
+  // we first store a portal without pqp in the portals map to signalize an error. However, if binding succeeds in the
+  // next step it gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
+  _portals.emplace(parameters.portal, Portal{});
 
   const auto pqp = QueryHandler::bind_prepared_plan(parameters);
 
-  _portals[parameters.portal] = pqp;
+  _portals[parameters.portal] = Portal{pqp, parameters.result_format_codes, nullptr};
   _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
 
   // Ready for query + flush will be done after reading sync message
 }
 
+void Session::_handle_close_command() {
+  const auto [close_target, name] = _postgres_protocol_handler->read_close_packet();
+
+  // Closing a statement or portal that does not exist is not an error
+  // https://www.postgresql.org/docs/12/protocol-message-formats.html
+  if (close_target == 'S') {
+    QueryHandler::close_prepared_plan(name);
+  } else {
+    _portals.erase(name);
+  }
+
+  _postgres_protocol_handler->send_status_message(PostgresMessageType::CloseComplete);
+
+  // Ready for query + flush will be done after reading sync message
+}
+
 void Session::_sync() {
   _postgres_protocol_handler->read_sync_packet();
   if (_transaction) {
@@ -171,35 +309,55 @@ void Session::_sync() {
 }
 
 void Session::_handle_execute() {
-  const std::string& portal_name = _postgres_protocol_handler->read_execute_packet();
+  const auto [portal_name, row_limit] = _postgres_protocol_handler->read_execute_packet();
 
   auto portal_it = _portals.find(portal_name);
   AssertInput(portal_it != _portals.end(), "The specified portal does not exist.");
+  auto& portal = portal_it->second;
 
   // In case of an error occured during binding there is no pqp available. Hence, early return here since there is
   // nothing to execute.
-  if (!portal_it->second) {
+  if (!portal.physical_plan) {
     _portals.erase(portal_it);
     return;
   }
 
-  const auto physical_plan = portal_it->second;
+  const auto physical_plan = portal.physical_plan;
 
-  if (portal_name.empty()) _portals.erase(portal_it);
+  if (!portal.result_stream) {
+    if (!_transaction) _transaction = Hyrise::get().transaction_manager.new_transaction_context();
+    physical_plan->set_transaction_context_recursively(_transaction);
 
-  if (!_transaction) _transaction = Hyrise::get().transaction_manager.new_transaction_context();
-  physical_plan->set_transaction_context_recursively(_transaction);
+    const auto result_table = QueryHandler::execute_prepared_plan(physical_plan, _scheduling_class);
 
-  const auto result_table = QueryHandler::execute_prepared_plan(physical_plan);
+    // If there is no result table, e.g. after an INSERT command, we cannot send row data
+    if (!result_table) {
+      if (portal_name.empty()) _portals.erase(portal_it);
+      _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+      _postgres_protocol_handler->send_command_complete(
+          ResultSerializer::build_command_complete_message(physical_plan->type(), 0));
+      return;
+    }
 
-  uint64_t row_count = 0;
-  // If there is no result table, e.g. after an INSERT command, we cannot send row data
-  if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
-    row_count = result_table->row_count();
+    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler, portal.result_format_codes);
+    portal.result_stream = ResultSerializer::create_query_response_stream(result_table, portal.result_format_codes);
+  }
+
+  // A row limit of zero requests all (remaining) rows
+  const auto max_row_count = row_limit == 0 ? std::numeric_limits<uint64_t>::max() : uint64_t{row_limit};
+  const auto row_count = portal.result_stream->send_rows(*_postgres_protocol_handler, max_row_count);
+
+  // The client fetches the remaining rows with further Execute messages for the same portal
+  if (portal.result_stream->has_unsent_rows()) {
+    _postgres_protocol_handler->send_status_message(PostgresMessageType::PortalSuspended);
+    return;
+  }
+
+  if (portal_name.empty()) {
+    _portals.erase(portal_it);
   } else {
-    _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+    // Executing the named portal again executes the plan again
+    portal.result_stream.reset();
   }
 
   _postgres_protocol_handler->send_command_complete(
@@ -1,24 +1,40 @@
 #pragma once
 
 #include "concurrency/transaction_context.hpp"
+#include "copy_handler.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
+#include "result_serializer.hpp"
 #include "scheduler/operator_task.hpp"
 
 namespace opossum {
 
+// A portal is a prepared statement that has been bound to parameters. It also stores the format codes requested for
+// the result columns, which are needed when the portal is executed. If an Execute message limits the number of rows,
+// the portal keeps the stream of the remaining result rows, from which the next Execute message continues.
+struct Portal {
+  std::shared_ptr<AbstractOperator> physical_plan;
+  std::vector<FormatCode> result_format_codes;
+  std::shared_ptr<ResultStream> result_stream;
+};
+
 // The session class implements the communication flow and stores session-specific information such as portals. Those
 // portals are required by the PostgreSQL message protocol for the execution of prepared statements. However, named
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+class Session : public std::enable_shared_from_this<Session> {
  public:
   explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
 
-  // Start new session.
+  // Start new session and handle its requests on the calling thread until the client disconnects.
   void run();
 
+  // Start new session without blocking the calling thread. The session waits asynchronously until the client sends a
+  // request and then handles it in a task on the scheduler. The session keeps itself alive until the client
+  // disconnects.
+  void start_async();
+
   std::shared_ptr<Socket> socket();
 
  private:
@@ -28,19 +44,40 @@ class Session {
   // Determine message and call the appropriate method.
   void _handle_request();
 
+  // Handle the next request. If it fails, send the error message to the client.
+  void _handle_request_or_send_error();
+
+  // Receive the next request without blocking the thread and schedule its handling.
+  void _wait_for_request_async();
+
+  // Returns whether the buffered request starts COPY FROM STDIN, which reads the data to copy from further messages.
+  bool _is_copy_from_stdin_buffered() const;
+
+  // Schedule a task that calls the given handler and then waits for the next request. Handlers that may block while
+  // reading from the client (i.e., the request is not buffered completely or it is COPY FROM STDIN) are called on a
+  // separate thread instead.
+  void _schedule_async(void (Session::*handler)(), const bool may_block);
+
   // Execute plain SQL statement.
   void _handle_simple_query();
 
+  // Execute COPY FROM STDIN or COPY TO STDOUT using the COPY sub-protocol.
+  void _handle_copy(const CopyStatement& copy_statement);
+
   // Parse prepared statement.
   void _handle_parse_command();
 
   // Bind prepared statement.
   void _handle_bind_command();
 
+  // Close prepared statement or portal.
+  void _handle_close_command();
+
   // Read describe message. Row description will be send after execution.
   void _handle_describe();
 
-  // Execute prepared statement and send row description.
+  // Execute prepared statement and send row description. If the portal has been executed before but not all rows have
+  // been sent, send the next rows instead.
   void _handle_execute();
 
   // Commit current transaction.
@@ -51,7 +88,9 @@ class Session {
   const SendExecutionInfo _send_execution_info;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
+  // Can be chosen by the client via the "scheduling_class" startup parameter.
+  SchedulingClass _scheduling_class = SchedulingClass::Default;
   std::shared_ptr<TransactionContext> _transaction;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, Portal> _portals;
 };
 }  // namespace opossum
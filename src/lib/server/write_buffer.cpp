@@ -68,16 +68,44 @@ void WriteBuffer<SocketType>::flush(const size_t bytes_required) {
                                     boost::asio::transfer_at_least(bytes_to_send), error_code);
   }
 
-  // Socket was closed by client during execution
-  if (error_code == boost::asio::error::broken_pipe || error_code == boost::asio::error::connection_reset ||
-      bytes_sent == 0) {
-    throw ClientDisconnectException("Write operation failed. Client closed connection.");
-  }
-  Assert(!error_code, error_code.message());
+  _check_write_result(bytes_sent, error_code);
 
   std::advance(_start_position, bytes_sent);
 }
 
+template <typename SocketType>
+void WriteBuffer<SocketType>::put_buffers(const std::vector<boost::asio::const_buffer>& buffers) {
+  const auto total_size = boost::asio::buffer_size(buffers);
+
+  // Small batches are copied into the available space
+  if (total_size < maximum_capacity() - size()) {
+    for (const auto& buffer : buffers) {
+      std::copy_n(static_cast<const char*>(buffer.data()), buffer.size(), _current_position);
+      std::advance(_current_position, buffer.size());
+    }
+    return;
+  }
+
+  // Large batches are written together with the unflushed data in a single gathering write
+  auto gathered_buffers = std::vector<boost::asio::const_buffer>{};
+  gathered_buffers.reserve(buffers.size() + 2);
+  if (std::distance(&*_start_position, &*_current_position) < 0) {
+    // Data not continuously stored in buffer
+    gathered_buffers.emplace_back(&*_start_position, std::distance(&*_start_position, _data.end()));
+    gathered_buffers.emplace_back(_data.begin(), std::distance(_data.begin(), &*_current_position));
+  } else if (size() > 0) {
+    gathered_buffers.emplace_back(&*_start_position, size());
+  }
+  gathered_buffers.insert(gathered_buffers.end(), buffers.cbegin(), buffers.cend());
+
+  boost::system::error_code error_code;
+  const auto bytes_sent = boost::asio::write(*_socket, gathered_buffers, error_code);
+  _check_write_result(bytes_sent, error_code);
+
+  // boost::asio::write only returns once all data has been written
+  _start_position = _current_position;
+}
+
 template <typename SocketType>
 void WriteBuffer<SocketType>::_flush_if_necessary(const size_t bytes_required) {
   if (bytes_required >= maximum_capacity() - size()) {
@@ -85,6 +113,17 @@ void WriteBuffer<SocketType>::_flush_if_necessary(const size_t bytes_required) {
   }
 }
 
+template <typename SocketType>
+void WriteBuffer<SocketType>::_check_write_result(const size_t bytes_sent,
+                                                  const boost::system::error_code& error_code) {
+  // Socket was closed by client during execution
+  if (error_code == boost::asio::error::broken_pipe || error_code == boost::asio::error::connection_reset ||
+      bytes_sent == 0) {
+    throw ClientDisconnectException("Write operation failed. Client closed connection.");
+  }
+  Assert(!error_code, error_code.message());
+}
+
 template class WriteBuffer<Socket>;
 template class WriteBuffer<boost::asio::posix::stream_descriptor>;
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "ring_buffer_iterator.hpp"
 #include "server_types.hpp"
 #include "types.hpp"
@@ -45,12 +47,19 @@ class WriteBuffer {
   // Put string into the buffer. If the string is longer than the buffer itself the buffer will flush automatically.
   void put_string(const std::string& value, const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
 
+  // Put already serialized data into the buffer. If it does not fit into the available memory, the buffered data and
+  // the given buffers are written to the network device at once (scatter-gather) instead of being copied chunk-wise.
+  void put_buffers(const std::vector<boost::asio::const_buffer>& buffers);
+
   // Flush buffer by at least bytes_required. 0 means, flush whole buffer.
   void flush(const size_t bytes_required = 0);
 
  private:
   void _flush_if_necessary(const size_t bytes_required);
 
+  // Throws a ClientDisconnectException if the client closed the connection during the write operation
+  static void _check_write_result(const size_t bytes_sent, const boost::system::error_code& error_code);
+
   std::array<char, SERVER_BUFFER_SIZE> _data;
   // This iterator points to the first element that has not been flushed yet.
   RingBufferIterator _start_position{_data};
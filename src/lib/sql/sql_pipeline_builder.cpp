@@ -35,13 +35,28 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_scheduling_class(const SchedulingClass scheduling_class) {
+  _scheduling_class = scheduling_class;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_morsel_pipelines(const UseMorselPipelines use_morsel_pipelines) {
+  _use_morsel_pipelines = use_morsel_pipelines;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_memory_limit(const size_t memory_limit) {
+  _memory_limit = memory_limit;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline =
-      SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache,
+                              _scheduling_class, _use_morsel_pipelines, _memory_limit);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_per_statement().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -51,8 +66,8 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
     std::shared_ptr<hsql::SQLParserResult> parsed_sql) const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,       std::move(parsed_sql), _use_mvcc, _transaction_context, optimizer, _pqp_cache,
-          _lqp_cache};
+  return {_sql,       std::move(parsed_sql), _use_mvcc,         _transaction_context,  optimizer,
+          _pqp_cache, _lqp_cache,            _scheduling_class, _use_morsel_pipelines, _memory_limit};
 }
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 
+#include "memory/memory_budget.hpp"
 #include "types.hpp"
 
 #include "sql/sql_plan_cache.hpp"
@@ -28,6 +29,8 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
+ *  - The tasks are scheduled with SchedulingClass::Default.
+ *  - Chunk-local operators are not fused into MorselPipelines.
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -42,6 +45,11 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
+  SQLPipelineBuilder& with_scheduling_class(const SchedulingClass scheduling_class);
+  SQLPipelineBuilder& with_morsel_pipelines(const UseMorselPipelines use_morsel_pipelines);
+
+  // Limits the memory of the intermediate data structures of each statement's operators (see MemoryBudget)
+  SQLPipelineBuilder& with_memory_limit(const size_t memory_limit);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -64,6 +72,9 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  SchedulingClass _scheduling_class{SchedulingClass::Default};
+  UseMorselPipelines _use_morsel_pipelines{UseMorselPipelines::No};
+  size_t _memory_limit{MemoryBudget::UNLIMITED};
 };
 
 }  // namespace opossum
@@ -32,7 +32,10 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                                           const SchedulingClass scheduling_class,
+                                           const UseMorselPipelines use_morsel_pipelines,
+                                           const size_t memory_limit)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
       _sql_string(sql),
@@ -40,6 +43,10 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
       _transaction_context(transaction_context),
       _optimizer(optimizer),
+      _scheduling_class(scheduling_class),
+      _task_group_id(AbstractTask::create_task_group_id()),
+      _use_morsel_pipelines(use_morsel_pipelines),
+      _memory_limit(memory_limit),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
@@ -173,12 +180,14 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
     // Reset time to exclude previous pipeline steps
     started = std::chrono::high_resolution_clock::now();
-    _physical_plan = LQPTranslator{}.translate_node(lqp);
+    _physical_plan = LQPTranslator{_use_morsel_pipelines}.translate_node(lqp);
   }
 
   done = std::chrono::high_resolution_clock::now();
 
   if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
+  _physical_plan->set_memory_budget_recursively(
+      std::make_shared<MemoryBudget>(_memory_limit, Hyrise::get().memory_budget));
 
   // Cache newly created plan for the according sql statement (only if not already cached)
   if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable) {
@@ -196,6 +205,9 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
   }
 
   _tasks = OperatorTask::make_tasks_from_operator(get_physical_plan());
+  for (const auto& task : _tasks) {
+    task->set_scheduling_class(_scheduling_class, _task_group_id);
+  }
   return _tasks;
 }
 
@@ -52,7 +52,9 @@ class SQLPipelineStatement : public Noncopyable {
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const SchedulingClass scheduling_class, const UseMorselPipelines use_morsel_pipelines,
+                       const size_t memory_limit);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -71,7 +73,8 @@ class SQLPipelineStatement : public Noncopyable {
   // optimized LQP.
   const std::shared_ptr<AbstractOperator>& get_physical_plan();
 
-  // Returns all tasks that need to be executed for this query.
+  // Returns all tasks that need to be executed for this query. All tasks belong to the statement's task group and are
+  // scheduled with the statement's scheduling class.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns
@@ -109,6 +112,14 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<Optimizer> _optimizer;
 
+  const SchedulingClass _scheduling_class;
+  const TaskGroupID _task_group_id;
+
+  const UseMorselPipelines _use_morsel_pipelines;
+
+  // Limit of the per-query MemoryBudget of the physical plan's operators
+  const size_t _memory_limit;
+
   // Execution results
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
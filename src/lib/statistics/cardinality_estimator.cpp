@@ -22,6 +22,7 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/static_table_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "lossy_cast.hpp"
@@ -65,6 +66,39 @@ std::optional<float> estimate_null_value_ratio_of_column(const TableStatistics&
   return std::nullopt;
 }
 
+std::shared_ptr<TableStatistics> estimate_num_rows_expression(
+    const std::shared_ptr<AbstractExpression>& num_rows_expression,
+    const std::shared_ptr<TableStatistics>& input_table_statistics) {
+  // For LimitNodes and TopNNodes with a value as num_rows_expression, create a TableStatistics object with that value
+  // as row_count. Otherwise, forward the input statistics for now.
+
+  if (const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(num_rows_expression)) {
+    const auto row_count = lossy_variant_cast<float>(value_expression->value);
+    if (!row_count) {
+      // `value_expression->value` being NULL does not make much sense, but that is not the concern of the
+      // CardinalityEstimator
+      return input_table_statistics;
+    }
+
+    // Number of rows can never exceed number of input rows
+    const auto clamped_row_count = std::min(*row_count, input_table_statistics->row_count);
+
+    auto column_statistics =
+        std::vector<std::shared_ptr<BaseAttributeStatistics>>{input_table_statistics->column_statistics.size()};
+
+    for (auto column_id = ColumnID{0}; column_id < input_table_statistics->column_statistics.size(); ++column_id) {
+      resolve_data_type(input_table_statistics->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        column_statistics[column_id] = std::make_shared<AttributeStatistics<ColumnDataType>>();
+      });
+    }
+
+    return std::make_shared<TableStatistics>(std::move(column_statistics), clamped_row_count);
+  } else {
+    return input_table_statistics;
+  }
+}
+
 }  // namespace
 
 namespace opossum {
@@ -192,6 +226,11 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
       output_table_statistics = estimate_validate_node(*validate_node, left_input_table_statistics);
     } break;
 
+    case LQPNodeType::TopN: {
+      const auto top_n_node = std::dynamic_pointer_cast<TopNNode>(lqp);
+      output_table_statistics = estimate_top_n_node(*top_n_node, left_input_table_statistics);
+    } break;
+
     case LQPNodeType::Union: {
       const auto union_node = std::dynamic_pointer_cast<UnionNode>(lqp);
       output_table_statistics =
@@ -507,34 +546,12 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_union_node(
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_limit_node(
     const LimitNode& limit_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
-  // For LimitNodes with a value as limit_expression, create a TableStatistics object with that value as row_count.
-  // Otherwise, forward the input statistics for now.
-
-  if (const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node.num_rows_expression())) {
-    const auto row_count = lossy_variant_cast<float>(value_expression->value);
-    if (!row_count) {
-      // `value_expression->value` being NULL does not make much sense, but that is not the concern of the
-      // CardinalityEstimator
-      return input_table_statistics;
-    }
-
-    // Number of rows can never exceed number of input rows
-    const auto clamped_row_count = std::min(*row_count, input_table_statistics->row_count);
-
-    auto column_statistics =
-        std::vector<std::shared_ptr<BaseAttributeStatistics>>{limit_node.column_expressions().size()};
-
-    for (auto column_id = ColumnID{0}; column_id < input_table_statistics->column_statistics.size(); ++column_id) {
-      resolve_data_type(input_table_statistics->column_data_type(column_id), [&](const auto data_type_t) {
-        using ColumnDataType = typename decltype(data_type_t)::type;
-        column_statistics[column_id] = std::make_shared<AttributeStatistics<ColumnDataType>>();
-      });
-    }
+  return estimate_num_rows_expression(limit_node.num_rows_expression(), input_table_statistics);
+}
 
-    return std::make_shared<TableStatistics>(std::move(column_statistics), clamped_row_count);
-  } else {
-    return input_table_statistics;
-  }
+std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_top_n_node(
+    const TopNNode& top_n_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
+  return estimate_num_rows_expression(top_n_node.num_rows_expression(), input_table_statistics);
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_predicate(
@@ -0,0 +1,211 @@
+#include "statistics_serialization.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    write_value(stream, static_cast<uint64_t>(value.size()));
+    stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+  } else {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
+template <typename T>
+T read_value(std::istream& stream) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    auto value = pmr_string(read_value<uint64_t>(stream), '\0');
+    stream.read(value.data(), static_cast<std::streamsize>(value.size()));
+    return value;
+  } else {
+    auto value = T{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+}
+
+template <typename T>
+void write_histogram_domain(std::ostream& stream, const HistogramDomain<T>& domain) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    write_value(stream, domain.min_char);
+    write_value(stream, domain.max_char);
+    write_value(stream, static_cast<uint64_t>(domain.prefix_length));
+  }
+}
+
+template <typename T>
+HistogramDomain<T> read_histogram_domain(std::istream& stream) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto min_char = read_value<char>(stream);
+    const auto max_char = read_value<char>(stream);
+    const auto prefix_length = read_value<uint64_t>(stream);
+    return HistogramDomain<T>{min_char, max_char, prefix_length};
+  } else {
+    return HistogramDomain<T>{};
+  }
+}
+
+// Every statistics object is preceded by a flag that tells whether it exists
+void serialize_attribute_statistics(const BaseAttributeStatistics& base_attribute_statistics, std::ostream& stream) {
+  write_value(stream, static_cast<uint8_t>(base_attribute_statistics.data_type));
+
+  resolve_data_type(base_attribute_statistics.data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto& attribute_statistics =
+        static_cast<const AttributeStatistics<ColumnDataType>&>(base_attribute_statistics);
+
+    const auto& histogram = attribute_statistics.histogram;
+    write_value(stream, static_cast<uint8_t>(histogram != nullptr));
+    if (histogram) {
+      write_histogram_domain(stream, histogram->domain());
+      const auto bin_count = histogram->bin_count();
+      write_value(stream, static_cast<uint64_t>(bin_count));
+      for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+        write_value(stream, histogram->bin_minimum(bin_id));
+        write_value(stream, histogram->bin_maximum(bin_id));
+        write_value(stream, histogram->bin_height(bin_id));
+        write_value(stream, histogram->bin_distinct_count(bin_id));
+      }
+    }
+
+    const auto& min_max_filter = attribute_statistics.min_max_filter;
+    write_value(stream, static_cast<uint8_t>(min_max_filter != nullptr));
+    if (min_max_filter) {
+      write_value(stream, min_max_filter->min);
+      write_value(stream, min_max_filter->max);
+    }
+
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      const auto& range_filter = attribute_statistics.range_filter;
+      write_value(stream, static_cast<uint8_t>(range_filter != nullptr));
+      if (range_filter) {
+        write_value(stream, static_cast<uint64_t>(range_filter->ranges.size()));
+        for (const auto& [range_minimum, range_maximum] : range_filter->ranges) {
+          write_value(stream, range_minimum);
+          write_value(stream, range_maximum);
+        }
+      }
+    } else {
+      write_value(stream, uint8_t{0});
+    }
+
+    const auto& null_value_ratio = attribute_statistics.null_value_ratio;
+    write_value(stream, static_cast<uint8_t>(null_value_ratio != nullptr));
+    if (null_value_ratio) write_value(stream, null_value_ratio->ratio);
+  });
+}
+
+std::shared_ptr<BaseAttributeStatistics> deserialize_attribute_statistics(std::istream& stream) {
+  const auto data_type = static_cast<DataType>(read_value<uint8_t>(stream));
+
+  auto attribute_statistics = std::shared_ptr<BaseAttributeStatistics>{};
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto typed_attribute_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
+
+    if (read_value<uint8_t>(stream)) {
+      const auto domain = read_histogram_domain<ColumnDataType>(stream);
+      const auto bin_count = read_value<uint64_t>(stream);
+
+      auto bin_minima = std::vector<ColumnDataType>(bin_count);
+      auto bin_maxima = std::vector<ColumnDataType>(bin_count);
+      auto bin_heights = std::vector<HistogramCountType>(bin_count);
+      auto bin_distinct_counts = std::vector<HistogramCountType>(bin_count);
+      for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+        bin_minima[bin_id] = read_value<ColumnDataType>(stream);
+        bin_maxima[bin_id] = read_value<ColumnDataType>(stream);
+        bin_heights[bin_id] = read_value<HistogramCountType>(stream);
+        bin_distinct_counts[bin_id] = read_value<HistogramCountType>(stream);
+      }
+
+      typed_attribute_statistics->set_statistics_object(std::make_shared<GenericHistogram<ColumnDataType>>(
+          std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights), std::move(bin_distinct_counts),
+          domain));
+    }
+
+    if (read_value<uint8_t>(stream)) {
+      auto min = read_value<ColumnDataType>(stream);
+      auto max = read_value<ColumnDataType>(stream);
+      typed_attribute_statistics->set_statistics_object(
+          std::make_shared<MinMaxFilter<ColumnDataType>>(std::move(min), std::move(max)));
+    }
+
+    if (read_value<uint8_t>(stream)) {
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        auto ranges = std::vector<std::pair<ColumnDataType, ColumnDataType>>(read_value<uint64_t>(stream));
+        for (auto& range : ranges) {
+          range.first = read_value<ColumnDataType>(stream);
+          range.second = read_value<ColumnDataType>(stream);
+        }
+        typed_attribute_statistics->set_statistics_object(
+            std::make_shared<RangeFilter<ColumnDataType>>(std::move(ranges)));
+      } else {
+        Fail("RangeFilters are only supported for arithmetic types");
+      }
+    }
+
+    if (read_value<uint8_t>(stream)) {
+      typed_attribute_statistics->set_statistics_object(
+          std::make_shared<NullValueRatioStatistics>(read_value<float>(stream)));
+    }
+
+    attribute_statistics = typed_attribute_statistics;
+  });
+
+  return attribute_statistics;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void serialize_table_statistics(const TableStatistics& table_statistics, std::ostream& stream) {
+  write_value(stream, table_statistics.row_count);
+  write_value(stream, static_cast<uint64_t>(table_statistics.column_statistics.size()));
+  for (const auto& column_statistics : table_statistics.column_statistics) {
+    serialize_attribute_statistics(*column_statistics, stream);
+  }
+}
+
+std::shared_ptr<TableStatistics> deserialize_table_statistics(std::istream& stream) {
+  const auto row_count = read_value<Cardinality>(stream);
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(read_value<uint64_t>(stream));
+  for (auto& attribute_statistics : column_statistics) {
+    attribute_statistics = deserialize_attribute_statistics(stream);
+  }
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+}
+
+void serialize_chunk_pruning_statistics(const ChunkPruningStatistics& pruning_statistics, std::ostream& stream) {
+  write_value(stream, static_cast<uint64_t>(pruning_statistics.size()));
+  for (const auto& attribute_statistics : pruning_statistics) {
+    serialize_attribute_statistics(*attribute_statistics, stream);
+  }
+}
+
+ChunkPruningStatistics deserialize_chunk_pruning_statistics(std::istream& stream) {
+  auto pruning_statistics = ChunkPruningStatistics(read_value<uint64_t>(stream));
+  for (auto& attribute_statistics : pruning_statistics) {
+    attribute_statistics = deserialize_attribute_statistics(stream);
+  }
+  return pruning_statistics;
+}
+
+}  // namespace opossum
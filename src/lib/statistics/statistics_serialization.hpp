@@ -0,0 +1,26 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+class TableStatistics;
+
+/**
+ * Binary (de)serialization of the statistics that StorageManager::add_table creates for every table, so that they do
+ * not have to be rebuilt when a table is recovered from a checkpoint (see Checkpoint).
+ *
+ * Histograms are stored bin by bin and deserialized as GenericHistograms, which behave like the original histograms
+ * for cardinality estimation. MinMaxFilters, RangeFilters, and NullValueRatioStatistics are restored as they are.
+ * CountingQuotientFilters are not created by add_table and thus not stored.
+ */
+void serialize_table_statistics(const TableStatistics& table_statistics, std::ostream& stream);
+std::shared_ptr<TableStatistics> deserialize_table_statistics(std::istream& stream);
+
+void serialize_chunk_pruning_statistics(const ChunkPruningStatistics& pruning_statistics, std::ostream& stream);
+ChunkPruningStatistics deserialize_chunk_pruning_statistics(std::istream& stream);
+
+}  // namespace opossum
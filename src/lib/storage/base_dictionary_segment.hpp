@@ -50,5 +50,13 @@ class BaseDictionarySegment : public BaseEncodedSegment {
    * @brief Returns encoding specific null value ID
    */
   virtual ValueID null_value_id() const = 0;
+
+  /**
+   * @brief Returns true if both segments use the very same dictionary object
+   *
+   * This is the case for segments that were encoded with a column-wide dictionary (see
+   * ChunkEncoder::encode_column_with_shared_dictionary). Their value IDs can be compared across chunks.
+   */
+  virtual bool shares_dictionary_with(const BaseDictionarySegment& other) const = 0;
 };
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "chunk_encoder.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -10,13 +11,105 @@
 #include "statistics/generate_pruning_statistics.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/base_segment_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Dictionary-encodes a segment using the given sorted dictionary (see
+// ChunkEncoder::encode_column_with_shared_dictionary). If fixed_string_dictionary is set, it has to hold the same
+// strings as dictionary and a FixedStringDictionarySegment is created. Returns nullptr if a value of the segment is not
+// part of the dictionary.
+template <typename T>
+std::shared_ptr<BaseSegment> encode_segment_with_dictionary(
+    const BaseSegment& segment, const std::shared_ptr<const pmr_vector<T>>& dictionary,
+    const std::shared_ptr<const FixedStringVector>& fixed_string_dictionary,
+    const VectorCompressionType vector_compression_type) {
+  const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+
+  auto uncompressed_attribute_vector = pmr_vector<uint32_t>{};
+  uncompressed_attribute_vector.reserve(segment.size());
+  auto value_is_missing = false;
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (value_is_missing) return;
+
+    if (position.is_null()) {
+      uncompressed_attribute_vector.emplace_back(null_value_id);
+      return;
+    }
+
+    const auto it = std::lower_bound(dictionary->cbegin(), dictionary->cend(), position.value());
+    if (it == dictionary->cend() || *it != position.value()) {
+      value_is_missing = true;
+      return;
+    }
+    uncompressed_attribute_vector.emplace_back(static_cast<uint32_t>(std::distance(dictionary->cbegin(), it)));
+  });
+
+  if (value_is_missing) return nullptr;
+
+  const auto attribute_vector = std::shared_ptr<const BaseCompressedVector>(
+      compress_vector(uncompressed_attribute_vector, vector_compression_type, {}, {null_value_id}));
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    if (fixed_string_dictionary) {
+      return std::make_shared<FixedStringDictionarySegment<pmr_string>>(fixed_string_dictionary, attribute_vector);
+    }
+  }
+  return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector);
+}
+
+// Returns one of the column's dictionary segments if the segments of all immutable chunks except for the given one
+// share it. Mutable chunks are skipped, as they are not encoded yet. A single chunk does not count as sharing.
+std::shared_ptr<const BaseDictionarySegment> find_dictionary_segment_shared_by_other_chunks(const Table& table,
+                                                                                            const ChunkID chunk_id,
+                                                                                            const ColumnID column_id) {
+  auto shared_dictionary_segment = std::shared_ptr<const BaseDictionarySegment>{};
+  auto sharing_segment_count = size_t{0};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto other_chunk_id = ChunkID{0}; other_chunk_id < chunk_count; ++other_chunk_id) {
+    if (other_chunk_id == chunk_id) continue;
+
+    const auto chunk = table.get_chunk(other_chunk_id);
+    if (!chunk || chunk->is_mutable()) continue;
+
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(column_id));
+    if (!dictionary_segment) return nullptr;
+
+    if (!shared_dictionary_segment) {
+      shared_dictionary_segment = dictionary_segment;
+    } else if (!dictionary_segment->shares_dictionary_with(*shared_dictionary_segment)) {
+      return nullptr;
+    }
+    ++sharing_segment_count;
+  }
+
+  return sharing_segment_count > 1 ? shared_dictionary_segment : nullptr;
+}
+
+// Calls encode_column_with_shared_dictionary for all columns whose spec asks for a shared dictionary
+void encode_shared_dictionary_columns(const std::shared_ptr<Table>& table,
+                                      const ChunkEncodingSpec& chunk_encoding_spec) {
+  for (auto column_id = ColumnID{0}; column_id < chunk_encoding_spec.size(); ++column_id) {
+    if (!chunk_encoding_spec[column_id].shared_dictionary) continue;
+    ChunkEncoder::encode_column_with_shared_dictionary(table, column_id, chunk_encoding_spec[column_id]);
+  }
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -40,7 +133,9 @@ std::shared_ptr<BaseSegment> ChunkEncoder::encode_segment(const std::shared_ptr<
     // Check if early exit is possible when passed segment is already encoded with requested spec.
     // In case no vector compression is specified, only the correct encoding type is checked and the current vector
     // compression type is ignored.
-    const auto current_segment_encoding_spec = get_segment_encoding_spec(segment);
+    // Sharing a dictionary concerns the whole column and is handled by encode_column_with_shared_dictionary().
+    auto current_segment_encoding_spec = get_segment_encoding_spec(segment);
+    current_segment_encoding_spec.shared_dictionary = encoding_spec.shared_dictionary;
     if (current_segment_encoding_spec == encoding_spec ||
         (!encoding_spec.vector_compression_type &&
          current_segment_encoding_spec.encoding_type == encoding_spec.encoding_type)) {
@@ -153,6 +248,19 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
     encode_chunk(chunk, column_types, chunk_encoding_spec);
   }
+
+  if (chunk_count == 0) return;
+
+  // A column can only share a dictionary if it is encoded the same way in all chunks
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    const auto& segment_encoding_spec = chunk_encoding_specs.front()[column_id];
+    for (const auto& chunk_encoding_spec : chunk_encoding_specs) {
+      Assert(chunk_encoding_spec[column_id].shared_dictionary == segment_encoding_spec.shared_dictionary &&
+                 (!segment_encoding_spec.shared_dictionary || chunk_encoding_spec[column_id] == segment_encoding_spec),
+             "A column with a shared dictionary needs the same encoding spec for all chunks.");
+    }
+  }
+  encode_shared_dictionary_columns(table, chunk_encoding_specs.front());
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
@@ -168,6 +276,8 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
 
     encode_chunk(chunk, column_types, chunk_encoding_spec);
   }
+
+  encode_shared_dictionary_columns(table, chunk_encoding_spec);
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
@@ -181,6 +291,135 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
 
     encode_chunk(chunk, column_types, segment_encoding_spec);
   }
+
+  encode_shared_dictionary_columns(table, ChunkEncodingSpec{table->column_count(), segment_encoding_spec});
+}
+
+void ChunkEncoder::encode_appended_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id,
+                                         const SegmentEncodingSpec& segment_encoding_spec) {
+  Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
+  const auto chunk = table->get_chunk(chunk_id);
+  Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  Assert(!chunk->is_mutable(), "Only immutable chunks can be encoded.");
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{chunk->column_count(), segment_encoding_spec};
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto shared_dictionary_segment = find_dictionary_segment_shared_by_other_chunks(*table, chunk_id, column_id);
+    if (!shared_dictionary_segment) continue;
+
+    const auto shared_encoding_spec = get_segment_encoding_spec(shared_dictionary_segment);
+
+    // The other chunks' segments are read concurrently, so that they cannot be re-encoded with a new shared
+    // dictionary. Thus, the chunk can only join the shared dictionary if the dictionary holds all of its values.
+    auto encoded_segment = std::shared_ptr<BaseSegment>{};
+    resolve_data_type(table->column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto dictionary = std::shared_ptr<const pmr_vector<ColumnDataType>>{};
+      auto fixed_string_dictionary = std::shared_ptr<const FixedStringVector>{};
+      if (const auto dictionary_segment =
+              std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(shared_dictionary_segment)) {
+        dictionary = dictionary_segment->dictionary();
+      }
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        if (const auto fixed_string_dictionary_segment =
+                std::dynamic_pointer_cast<const FixedStringDictionarySegment<pmr_string>>(shared_dictionary_segment)) {
+          fixed_string_dictionary = fixed_string_dictionary_segment->fixed_string_dictionary();
+          auto strings = std::make_shared<pmr_vector<pmr_string>>();
+          strings->reserve(fixed_string_dictionary->size());
+          for (auto value_id = size_t{0}; value_id < fixed_string_dictionary->size(); ++value_id) {
+            strings->emplace_back(fixed_string_dictionary->get_string_at(value_id));
+          }
+          dictionary = strings;
+        }
+      }
+      if (!dictionary) return;
+
+      encoded_segment = encode_segment_with_dictionary<ColumnDataType>(
+          *chunk->get_segment(column_id), dictionary, fixed_string_dictionary,
+          shared_encoding_spec.vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned));
+    });
+
+    if (!encoded_segment) {
+      PerformanceWarning("Appended chunk of table holds values that its shared dictionary lacks, column " +
+                         table->column_name(column_id) + " no longer shares a dictionary");
+      continue;
+    }
+
+    chunk->replace_segment(column_id, encoded_segment);
+    chunk_encoding_spec[column_id] = shared_encoding_spec;
+  }
+
+  encode_chunk(chunk, table->column_data_types(), chunk_encoding_spec);
+}
+
+void ChunkEncoder::encode_column_with_shared_dictionary(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                                                        const SegmentEncodingSpec& segment_encoding_spec) {
+  const auto encoding_type = segment_encoding_spec.encoding_type;
+  Assert(encoding_type == EncodingType::Dictionary || encoding_type == EncodingType::FixedStringDictionary,
+         "Shared dictionaries are only supported for Dictionary and FixedStringDictionary encoding.");
+  const auto vector_compression_type =
+      segment_encoding_spec.vector_compression_type.value_or(VectorCompressionType::FixedSizeByteAligned);
+
+  const auto data_type = table->column_data_type(column_id);
+  const auto chunk_count = table->chunk_count();
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if constexpr (!std::is_same_v<ColumnDataType, pmr_string>) {
+      Assert(encoding_type == EncodingType::Dictionary, "FixedStringDictionary encoding only supports strings.");
+    }
+
+    // First pass: collect the distinct values of all chunks
+    auto values = std::vector<ColumnDataType>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      Assert(!chunk->is_mutable(), "Only immutable chunks can be encoded.");
+
+      const auto first_value_of_chunk = values.size();
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (!position.is_null()) values.emplace_back(position.value());
+      });
+
+      // Deduplicate per chunk to keep the memory footprint close to the size of the final dictionary
+      std::sort(values.begin() + first_value_of_chunk, values.end());
+      values.erase(std::unique(values.begin() + first_value_of_chunk, values.end()), values.end());
+    }
+
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    const auto dictionary = std::make_shared<pmr_vector<ColumnDataType>>(values.cbegin(), values.cend());
+    values = {};
+
+    auto fixed_string_dictionary = std::shared_ptr<const FixedStringVector>{};
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      if (encoding_type == EncodingType::FixedStringDictionary) {
+        auto max_string_length = size_t{0};
+        for (const auto& value : *dictionary) {
+          max_string_length = std::max(max_string_length, value.size());
+        }
+        fixed_string_dictionary =
+            std::make_shared<FixedStringVector>(dictionary->cbegin(), dictionary->cend(), max_string_length);
+      }
+    }
+
+    // Second pass: build the attribute vectors against the shared dictionary
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto& segment = *chunk->get_segment(column_id);
+
+      const auto encoded_segment = encode_segment_with_dictionary<ColumnDataType>(
+          segment, dictionary, fixed_string_dictionary, vector_compression_type);
+      DebugAssert(encoded_segment, "Shared dictionary lacks a value of the column");
+
+      chunk->replace_segment(column_id, encoded_segment);
+      generate_chunk_pruning_statistics(chunk);
+    }
+  });
 }
 
 }  // namespace opossum
@@ -63,7 +63,9 @@ class ChunkEncoder {
   /**
    * @brief Encodes an entire table
    *
-   * The encoding is specified per segment for each chunk.
+   * The encoding is specified per segment for each chunk. Columns whose SegmentEncodingSpec requests a shared
+   * dictionary are then encoded using encode_column_with_shared_dictionary. This applies to the other overloads of
+   * encode_all_chunks as well.
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
                                 const std::vector<ChunkEncodingSpec>& chunk_encoding_specs);
@@ -80,6 +82,30 @@ class ChunkEncoder {
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
                                 const SegmentEncodingSpec& segment_encoding_spec = {});
+
+  /**
+   * @brief Encodes a chunk that was appended to a table after the table was encoded
+   *
+   * Columns whose other immutable chunks share a dictionary (see encode_column_with_shared_dictionary) keep doing so if
+   * the dictionary holds all values of the new chunk. Otherwise, the chunk gets a dictionary of its own, so that the
+   * column no longer has a shared dictionary, and a PerformanceWarning is issued. The existing segments are never
+   * re-encoded, as they might be read concurrently. All other columns are encoded using the passed spec.
+   */
+  static void encode_appended_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id,
+                                    const SegmentEncodingSpec& segment_encoding_spec = {});
+
+  /**
+   * @brief Dictionary-encodes one column of an entire table using a single dictionary shared by all chunks
+   *
+   * Usually, each chunk has its own dictionary, so value IDs of different chunks cannot be compared. Here, all
+   * segments reference the same sorted (i.e., order-preserving) dictionary of all values in the column. Operators can
+   * detect this via BaseDictionarySegment::shares_dictionary_with and work on the value IDs across chunks, e.g., when
+   * grouping. As each segment reports the full dictionary, chunk pruning becomes less selective for this column.
+   *
+   * Only Dictionary and FixedStringDictionary encoding are supported. All chunks must be immutable.
+   */
+  static void encode_column_with_shared_dictionary(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                                                   const SegmentEncodingSpec& segment_encoding_spec = {});
 };
 
 }  // namespace opossum
@@ -127,6 +127,12 @@ ValueID DictionarySegment<T>::null_value_id() const {
   return ValueID{static_cast<ValueID::base_type>(_dictionary->size())};
 }
 
+template <typename T>
+bool DictionarySegment<T>::shares_dictionary_with(const BaseDictionarySegment& other) const {
+  const auto* other_segment = dynamic_cast<const DictionarySegment<T>*>(&other);
+  return other_segment && other_segment->_dictionary == _dictionary;
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionarySegment);
 
 }  // namespace opossum
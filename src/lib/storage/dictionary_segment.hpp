@@ -82,6 +82,8 @@ class DictionarySegment : public BaseDictionarySegment {
 
   ValueID null_value_id() const final;
 
+  bool shares_dictionary_with(const BaseDictionarySegment& other) const final;
+
   /**@}*/
 
  protected:
@@ -0,0 +1,500 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/pos_lists/rowid_pos_list.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using SegmentStatistics = EncodingAdvisor::SegmentStatistics;
+using EncodingCandidate = EncodingAdvisor::EncodingCandidate;
+
+// Relative cost of decoding a single value, either as part of a sequential scan or when it is accessed on its own.
+// Reading a value from an unencoded segment is the reference (1.0). Point accesses to a SimdBp128-compressed vector
+// decompress the entire block of 128 values, which is why its random access cost is much higher. Scans on dictionary
+// segments evaluate the predicate on the value IDs (see ColumnVsValueTableScanImpl), so their sequential cost is low.
+struct AccessCostFactors {
+  double sequential;
+  double random;
+};
+
+AccessCostFactors access_cost_factors(const SegmentEncodingSpec& spec, const SegmentStatistics& statistics) {
+  const auto simd_bp128 = spec.vector_compression_type == VectorCompressionType::SimdBp128;
+
+  switch (spec.encoding_type) {
+    case EncodingType::Unencoded:
+      return {1.0, 1.0};
+    case EncodingType::Dictionary:
+      return simd_bp128 ? AccessCostFactors{1.6, 8.0} : AccessCostFactors{1.2, 2.0};
+    case EncodingType::FixedStringDictionary:
+      return simd_bp128 ? AccessCostFactors{1.9, 8.5} : AccessCostFactors{1.5, 2.5};
+    case EncodingType::FrameOfReference:
+      return simd_bp128 ? AccessCostFactors{1.7, 8.0} : AccessCostFactors{1.3, 2.0};
+    case EncodingType::RunLength: {
+      // Scans decode each run once. Random accesses use the run index to find the few runs of a sample range, which
+      // are then searched binarily.
+      const auto runs_per_row =
+          static_cast<double>(statistics.run_count) / static_cast<double>(std::max(statistics.row_count, size_t{1}));
+      const auto runs_per_sample_range = runs_per_row * RunLengthSegment<int32_t>::run_index_sample_distance;
+      return {0.2 + runs_per_row, 2.0 + std::log2(1.0 + runs_per_sample_range)};
+    }
+    case EncodingType::LZ4:
+      break;
+  }
+  Fail("Unexpected encoding type");
+}
+
+// The block size does not depend on the data type
+constexpr auto frame_of_reference_block_size = size_t{FrameOfReferenceSegment<int32_t>::block_size};
+
+size_t bit_width(const uint64_t value) {
+  auto width = size_t{0};
+  while (width < 64 && (value >> width) != 0) ++width;
+  return width;
+}
+
+size_t estimate_compressed_vector_size(const size_t size, const uint64_t max_value,
+                                       const VectorCompressionType vector_compression_type) {
+  if (vector_compression_type == VectorCompressionType::FixedSizeByteAligned) {
+    if (max_value <= std::numeric_limits<uint8_t>::max()) return size;
+    if (max_value <= std::numeric_limits<uint16_t>::max()) return size * 2;
+    return size * 4;
+  }
+
+  // SimdBp128 packs each block of 128 values with the bit width of the block's largest value, for which we take the
+  // overall maximum. It stores one byte of meta information per block.
+  const auto block_count = (size + 127) / 128;
+  return block_count * 128 * std::max(bit_width(max_value), size_t{1}) / 8 + block_count;
+}
+
+// Average memory used by a single value, including heap-allocated string data
+template <typename T>
+double estimate_value_size(const SegmentStatistics& statistics) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto small_string_capacity = pmr_string{}.capacity();
+    if (statistics.average_string_length <= static_cast<double>(small_string_capacity)) return sizeof(pmr_string);
+    return static_cast<double>(sizeof(pmr_string)) + statistics.average_string_length + 1.0;
+  } else {
+    return sizeof(T);
+  }
+}
+
+template <typename T>
+size_t estimate_memory_usage(const SegmentEncodingSpec& spec, const SegmentStatistics& statistics) {
+  const auto row_count = statistics.row_count;
+  const auto distinct_count = statistics.distinct_count;
+  const auto run_count = statistics.run_count;
+  const auto value_size = estimate_value_size<T>(statistics);
+  const auto null_vector_size = (row_count + 7) / 8;
+
+  switch (spec.encoding_type) {
+    case EncodingType::Unencoded:
+      return static_cast<size_t>(static_cast<double>(row_count) * value_size) +
+             (statistics.null_count > 0 ? null_vector_size : 0);
+
+    case EncodingType::Dictionary:
+      // The null value ID is the size of the dictionary
+      return static_cast<size_t>(static_cast<double>(distinct_count) * value_size) +
+             estimate_compressed_vector_size(row_count, distinct_count, *spec.vector_compression_type);
+
+    case EncodingType::FixedStringDictionary:
+      return distinct_count * statistics.max_string_length +
+             estimate_compressed_vector_size(row_count, distinct_count, *spec.vector_compression_type);
+
+    case EncodingType::RunLength: {
+      constexpr auto sample_distance = RunLengthSegment<T>::run_index_sample_distance;
+      const auto run_index_sample_count = (row_count + sample_distance - 1) / sample_distance;
+      const auto run_index_size =
+          run_index_sample_count <= run_count ? run_index_sample_count * sizeof(ChunkOffset) : size_t{0};
+      return static_cast<size_t>(static_cast<double>(run_count) * value_size) + run_count * sizeof(ChunkOffset) +
+             (run_count + 7) / 8 + run_index_size;
+    }
+
+    case EncodingType::FrameOfReference: {
+      const auto block_count = (row_count + frame_of_reference_block_size - 1) / frame_of_reference_block_size;
+      const auto max_offset = statistics.max_block_offset;
+      auto offset_values_size = size_t{0};
+      if (max_offset <= std::numeric_limits<uint32_t>::max()) {
+        offset_values_size = estimate_compressed_vector_size(row_count, max_offset, *spec.vector_compression_type);
+      } else {
+        // 64-bit offsets are split into two vectors of 32-bit values. Both use the same compressed vector type, so
+        // FixedSizeByteAligned stores the high offsets with the width of the low ones (see FrameOfReferenceEncoder).
+        const auto vector_compression_type = *spec.vector_compression_type;
+        const auto max_high_offset = vector_compression_type == VectorCompressionType::FixedSizeByteAligned
+                                         ? uint64_t{std::numeric_limits<uint32_t>::max()}
+                                         : max_offset >> 32u;
+        offset_values_size =
+            estimate_compressed_vector_size(row_count, std::numeric_limits<uint32_t>::max(), vector_compression_type) +
+            estimate_compressed_vector_size(row_count, max_high_offset, vector_compression_type);
+      }
+      return block_count * sizeof(T) + null_vector_size + offset_values_size;
+    }
+
+    case EncodingType::LZ4:
+      break;
+  }
+  Fail("Unexpected encoding type");
+}
+
+// Occurrences of a value in the sample and the sample range in which it was seen first
+struct SampledValue {
+  size_t count{0};
+  size_t range_index{0};
+  bool in_multiple_ranges{false};
+};
+
+template <typename T>
+void sample_values(const BaseSegment& segment, const size_t sample_size, SegmentStatistics& statistics) {
+  const auto row_count = statistics.row_count;
+
+  auto range_count = size_t{1};
+  auto range_length = row_count;
+  if (row_count > sample_size) {
+    range_count = EncodingAdvisor::SAMPLE_RANGE_COUNT;
+    range_length = std::max(sample_size / range_count, size_t{1});
+  }
+
+  auto sample_positions = std::make_shared<RowIDPosList>();
+  sample_positions->reserve(range_count * range_length);
+  for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+    const auto range_begin =
+        range_count == 1 ? size_t{0} : range_index * (row_count - range_length) / (range_count - 1);
+    for (auto chunk_offset = range_begin; chunk_offset < range_begin + range_length; ++chunk_offset) {
+      sample_positions->push_back(RowID{ChunkID{0}, static_cast<ChunkOffset>(chunk_offset)});
+    }
+  }
+  sample_positions->guarantee_single_chunk();
+
+  auto sampled_values = std::unordered_map<T, SampledValue>{};
+  auto transition_count = size_t{0};
+  auto string_length_sum = size_t{0};
+
+  auto block_index = std::numeric_limits<size_t>::max();
+  auto block_min = uint64_t{0};
+  auto block_max = uint64_t{0};
+
+  auto sample_index = size_t{0};
+  auto previous_value = std::optional<T>{};
+  auto previous_is_null = false;
+
+  segment_iterate_filtered<T>(segment, sample_positions, [&](const auto& position) {
+    const auto chunk_offset = (*sample_positions)[sample_index].chunk_offset;
+    const auto range_index = sample_index / range_length;
+    const auto range_begins = sample_index % range_length == 0;
+    ++sample_index;
+
+    // Runs are counted as transitions between neighboring values within the ranges
+    const auto is_null = position.is_null();
+    if (!range_begins && (is_null != previous_is_null || (!is_null && !(position.value() == *previous_value)))) {
+      ++transition_count;
+    }
+    previous_is_null = is_null;
+
+    if (is_null) {
+      ++statistics.null_count;
+      return;
+    }
+
+    const auto& value = position.value();
+    auto& sampled_value = sampled_values[value];
+    if (sampled_value.count == 0) {
+      sampled_value.range_index = range_index;
+    } else if (sampled_value.range_index != range_index) {
+      sampled_value.in_multiple_ranges = true;
+    }
+    ++sampled_value.count;
+    previous_value = value;
+
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      string_length_sum += value.size();
+      statistics.max_string_length = std::max(statistics.max_string_length, value.size());
+    } else {
+      const auto ordered_value = uint64_t{FrameOfReferenceSegment<T>::to_ordered_unsigned(value)};
+      if (chunk_offset / frame_of_reference_block_size != block_index) {
+        block_index = chunk_offset / frame_of_reference_block_size;
+        block_min = ordered_value;
+        block_max = ordered_value;
+      }
+      block_min = std::min(block_min, ordered_value);
+      block_max = std::max(block_max, ordered_value);
+      statistics.max_block_offset = std::max(statistics.max_block_offset, block_max - block_min);
+    }
+  });
+
+  // The sampling is not an access by a query and should not influence the advisor's next decision
+  segment.access_counter[SegmentAccessCounter::access_type(*sample_positions)] -= sample_positions->size();
+
+  const auto sampled_row_count = sample_positions->size();
+  const auto non_null_sample_count = sampled_row_count - statistics.null_count;
+  statistics.sampled_row_count = sampled_row_count;
+
+  if (non_null_sample_count > 0) {
+    statistics.average_string_length =
+        static_cast<double>(string_length_sum) / static_cast<double>(non_null_sample_count);
+  }
+
+  const auto scale = static_cast<double>(row_count) / static_cast<double>(sampled_row_count);
+  const auto sample_distinct_count = sampled_values.size();
+
+  if (sampled_row_count == row_count) {
+    statistics.distinct_count = sample_distinct_count;
+    statistics.run_count = transition_count + 1;
+    return;
+  }
+
+  const auto transitions_per_row = static_cast<double>(transition_count) /
+                                   static_cast<double>(std::max(sampled_row_count - range_count, size_t{1}));
+  statistics.run_count =
+      std::clamp(static_cast<size_t>(std::round(transitions_per_row * static_cast<double>(row_count - 1))) + 1,
+                 transition_count + 1, row_count);
+
+  // Values that occur in several sample ranges are spread over the segment and were most likely all observed. Values
+  // that occur repeatedly, but only within a single range, are clustered (e.g., in sorted data), so the other parts of
+  // the segment have values of their own. Values that occur only once are extrapolated as in the guaranteed-error
+  // estimator (Charikar et al., "Towards Estimation Error Guarantees for Distinct Values"), i.e., each of them stands
+  // for sqrt(scale) values of the segment.
+  auto estimated_distinct_count = 0.0;
+  for (const auto& [value, sampled_value] : sampled_values) {
+    if (sampled_value.in_multiple_ranges) {
+      estimated_distinct_count += 1.0;
+    } else if (sampled_value.count > 1) {
+      estimated_distinct_count += scale;
+    } else {
+      estimated_distinct_count += std::sqrt(scale);
+    }
+  }
+
+  // A value cannot be distinct from its neighbor without starting a new run
+  statistics.null_count = static_cast<size_t>(std::round(static_cast<double>(statistics.null_count) * scale));
+  const auto max_distinct_count = std::min(statistics.run_count, row_count - statistics.null_count);
+  statistics.distinct_count = std::max(
+      sample_distinct_count, std::min(static_cast<size_t>(std::round(estimated_distinct_count)), max_distinct_count));
+}
+
+// Orders the candidates by memory usage and keeps those on the lower convex hull of (memory usage, access cost). Going
+// from one candidate to the next saves less access cost per additional byte than the step before.
+std::vector<EncodingCandidate> upgrade_path(std::vector<EncodingCandidate> candidates) {
+  std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    return std::tie(lhs.estimated_memory_usage, lhs.estimated_access_cost) <
+           std::tie(rhs.estimated_memory_usage, rhs.estimated_access_cost);
+  });
+
+  const auto efficiency = [](const auto& from, const auto& to) {
+    return (from.estimated_access_cost - to.estimated_access_cost) /
+           static_cast<double>(to.estimated_memory_usage - from.estimated_memory_usage);
+  };
+
+  auto path = std::vector<EncodingCandidate>{};
+  for (const auto& candidate : candidates) {
+    if (!path.empty() && candidate.estimated_access_cost >= path.back().estimated_access_cost) continue;
+
+    while (path.size() >= 2 && efficiency(path[path.size() - 2], candidate) >= efficiency(path[path.size() - 2],
+                                                                                           path.back())) {
+      path.pop_back();
+    }
+    path.push_back(candidate);
+  }
+  return path;
+}
+
+}  // namespace
+
+namespace opossum {
+
+EncodingAdvisor::EncodingAdvisor(const size_t sample_size) : _sample_size(sample_size) {
+  Assert(_sample_size >= SAMPLE_RANGE_COUNT, "Sample size must allow for at least one value per sample range");
+}
+
+EncodingAdvisor::SegmentStatistics EncodingAdvisor::sample_segment(const BaseSegment& segment) const {
+  auto statistics = SegmentStatistics{};
+  statistics.row_count = segment.size();
+  if (statistics.row_count == 0) return statistics;
+
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    sample_values<ColumnDataType>(segment, _sample_size, statistics);
+  });
+
+  // Dictionary segments know their number of distinct values
+  if (const auto dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    statistics.distinct_count = dictionary_segment->unique_values_count();
+  }
+
+  return statistics;
+}
+
+std::vector<EncodingAdvisor::EncodingCandidate> EncodingAdvisor::estimate_candidates(
+    const SegmentStatistics& statistics, const DataType data_type, const SegmentAccessCounter& access_counter) {
+  using AccessType = SegmentAccessCounter::AccessType;
+
+  // Monotonic accesses skip values, but still benefit from decoding neighboring values together
+  const auto monotonic_accesses = static_cast<double>(access_counter[AccessType::Monotonic]);
+  const auto sequential_accesses = static_cast<double>(access_counter[AccessType::Sequential]) + monotonic_accesses / 2;
+  const auto random_accesses = static_cast<double>(access_counter[AccessType::Point]) +
+                               static_cast<double>(access_counter[AccessType::Random]) + monotonic_accesses / 2;
+
+  auto candidates = std::vector<EncodingCandidate>{};
+  for (const auto encoding_type : all_encoding_types) {
+    if (encoding_type == EncodingType::LZ4 || !encoding_supports_data_type(encoding_type, data_type)) continue;
+
+    auto specs = std::vector<SegmentEncodingSpec>{};
+    if (encoding_type == EncodingType::Unencoded || encoding_type == EncodingType::RunLength) {
+      specs.emplace_back(encoding_type);
+    } else {
+      specs.emplace_back(encoding_type, VectorCompressionType::FixedSizeByteAligned);
+      specs.emplace_back(encoding_type, VectorCompressionType::SimdBp128);
+    }
+
+    for (const auto& spec : specs) {
+      const auto cost_factors = access_cost_factors(spec, statistics);
+      const auto access_cost = sequential_accesses * cost_factors.sequential + random_accesses * cost_factors.random;
+
+      resolve_data_type(data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        candidates.push_back({spec, estimate_memory_usage<ColumnDataType>(spec, statistics), access_cost});
+      });
+    }
+  }
+
+  return candidates;
+}
+
+std::vector<EncodingAdvisor::SegmentRecommendation> EncodingAdvisor::recommend(
+    const std::vector<std::shared_ptr<Table>>& tables, const size_t memory_budget) const {
+  auto recommendations = std::vector<SegmentRecommendation>{};
+  auto upgrade_paths = std::vector<std::vector<EncodingCandidate>>{};
+
+  // Segments that are not advised count towards the budget with their current memory usage
+  auto memory_usage = size_t{0};
+
+  for (const auto& table : tables) {
+    if (table->type() != TableType::Data) continue;
+
+    const auto column_count = table->column_count();
+    const auto chunk_count = table->chunk_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto shares_dictionary = find_shared_dictionary_segment(*table, column_id) != nullptr;
+      const auto data_type = table->column_data_type(column_id);
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (!chunk || chunk->is_mutable()) continue;
+
+        const auto segment = chunk->get_segment(column_id);
+        if (shares_dictionary || chunk->size() == 0 || !chunk->get_indexes(std::vector<ColumnID>{column_id}).empty()) {
+          memory_usage += segment->memory_usage(MemoryUsageCalculationMode::Sampled);
+          continue;
+        }
+
+        const auto statistics = sample_segment(*segment);
+        auto path = upgrade_path(estimate_candidates(statistics, data_type, segment->access_counter));
+
+        recommendations.push_back(
+            {table, chunk_id, column_id, path.front().encoding_spec, path.front().estimated_memory_usage});
+        memory_usage += path.front().estimated_memory_usage;
+        upgrade_paths.emplace_back(std::move(path));
+      }
+    }
+  }
+
+  // Greedily apply the upgrade with the largest access cost reduction per additional byte. As the upgrade paths are
+  // convex, the next upgrade of a segment is never more efficient than its previous one.
+  using Upgrade = std::pair<double, size_t>;
+  auto upgrades = std::priority_queue<Upgrade>{};
+  auto steps = std::vector<size_t>(recommendations.size(), 0);
+
+  const auto push_next_upgrade = [&](const size_t segment_index) {
+    const auto& path = upgrade_paths[segment_index];
+    const auto step = steps[segment_index];
+    if (step + 1 >= path.size()) return;
+
+    const auto saved_cost = path[step].estimated_access_cost - path[step + 1].estimated_access_cost;
+    const auto additional_bytes = path[step + 1].estimated_memory_usage - path[step].estimated_memory_usage;
+    upgrades.emplace(saved_cost / static_cast<double>(additional_bytes), segment_index);
+  };
+
+  for (auto segment_index = size_t{0}; segment_index < recommendations.size(); ++segment_index) {
+    push_next_upgrade(segment_index);
+  }
+
+  while (!upgrades.empty()) {
+    const auto segment_index = upgrades.top().second;
+    upgrades.pop();
+
+    const auto& path = upgrade_paths[segment_index];
+    auto& step = steps[segment_index];
+    const auto additional_bytes = path[step + 1].estimated_memory_usage - path[step].estimated_memory_usage;
+    if (memory_usage + additional_bytes > memory_budget) continue;
+
+    memory_usage += additional_bytes;
+    ++step;
+    recommendations[segment_index].encoding_spec = path[step].encoding_spec;
+    recommendations[segment_index].estimated_memory_usage = path[step].estimated_memory_usage;
+    push_next_upgrade(segment_index);
+  }
+
+  return recommendations;
+}
+
+size_t EncodingAdvisor::memory_usage(const std::vector<std::shared_ptr<Table>>& tables) {
+  auto memory_usage = size_t{0};
+  for (const auto& table : tables) {
+    if (table->type() != TableType::Data) continue;
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable()) continue;
+
+      const auto column_count = chunk->column_count();
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        memory_usage += chunk->get_segment(column_id)->memory_usage(MemoryUsageCalculationMode::Sampled);
+      }
+    }
+  }
+  return memory_usage;
+}
+
+size_t EncodingAdvisor::apply(const std::vector<SegmentRecommendation>& recommendations) {
+  auto reencoded_segment_count = size_t{0};
+
+  for (const auto& recommendation : recommendations) {
+    const auto chunk = recommendation.table->get_chunk(recommendation.chunk_id);
+    if (!chunk) continue;
+
+    const auto segment = chunk->get_segment(recommendation.column_id);
+    if (get_segment_encoding_spec(segment) == recommendation.encoding_spec) continue;
+
+    const auto data_type = recommendation.table->column_data_type(recommendation.column_id);
+    const auto encoded_segment = ChunkEncoder::encode_segment(segment, data_type, recommendation.encoding_spec);
+    encoded_segment->access_counter = segment->access_counter;
+    chunk->replace_segment(recommendation.column_id, encoded_segment);
+    ++reencoded_segment_count;
+  }
+
+  return reencoded_segment_count;
+}
+
+}  // namespace opossum
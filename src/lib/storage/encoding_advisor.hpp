@@ -0,0 +1,110 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class SegmentAccessCounter;
+class Table;
+
+/**
+ * @brief Chooses the encoding of each segment based on its data and on how it is accessed
+ *
+ * Instead of applying a single SegmentEncodingSpec to all segments, the advisor samples the values of each segment of
+ * the immutable chunks (cardinality, run lengths, value range per frame of reference block) and estimates, for each
+ * combination of EncodingType and VectorCompressionType that supports the column's data type, the memory usage of the
+ * encoded segment and the cost of the accesses recorded by the segment's SegmentAccessCounter. Sequential accesses
+ * (i.e., scans) and random accesses (i.e., accessors and point lookups) are weighted by cost factors that reflect how
+ * expensive the respective encoding is to decode.
+ *
+ * Given a memory budget for all advised segments, recommend() starts with the smallest encoding of each segment and
+ * greedily applies the upgrade that saves the most access cost per additional byte until the budget is exhausted
+ * (i.e., the greedy approximation of the multiple-choice knapsack problem). Segments that have never been accessed thus
+ * stay at their smallest encoding. apply() re-encodes the segments for which the recommended encoding differs from the
+ * current one. It is used by the EncodingAdvisorPlugin to re-encode chunks in the background.
+ *
+ * LZ4 is not considered: estimating its size requires compressing the values and its random access cost exceeds that of
+ * all other encodings by far. Segments that are indexed or that share their dictionary with the other segments of the
+ * column (see ChunkEncoder::encode_column_with_shared_dictionary) are left untouched.
+ */
+class EncodingAdvisor {
+ public:
+  // Characteristics of a segment's values. The counts are extrapolated from the sample to the entire segment.
+  struct SegmentStatistics {
+    size_t row_count{0};
+    size_t sampled_row_count{0};
+    size_t null_count{0};
+    size_t distinct_count{0};
+    size_t run_count{0};
+
+    // Largest difference between a value and the minimum of its frame of reference block (numeric columns only)
+    uint64_t max_block_offset{0};
+
+    // String columns only
+    double average_string_length{0.0};
+    size_t max_string_length{0};
+  };
+
+  struct EncodingCandidate {
+    SegmentEncodingSpec encoding_spec;
+    size_t estimated_memory_usage;
+    double estimated_access_cost;
+  };
+
+  struct SegmentRecommendation {
+    std::shared_ptr<Table> table;
+    ChunkID chunk_id;
+    ColumnID column_id;
+    SegmentEncodingSpec encoding_spec;
+    size_t estimated_memory_usage;
+  };
+
+  static constexpr auto DEFAULT_SAMPLE_SIZE = size_t{4'096};
+
+  // The sample consists of this many evenly spread ranges of consecutive values so that runs can be observed
+  static constexpr auto SAMPLE_RANGE_COUNT = size_t{8};
+
+  explicit EncodingAdvisor(const size_t sample_size = DEFAULT_SAMPLE_SIZE);
+
+  /**
+   * Samples the values of the segment. The accesses of the sampling itself are not recorded in the segment's
+   * SegmentAccessCounter.
+   */
+  SegmentStatistics sample_segment(const BaseSegment& segment) const;
+
+  /**
+   * Returns an estimate for each supported encoding, without LZ4. The access cost is relative to sequentially reading
+   * the values of an unencoded segment.
+   */
+  static std::vector<EncodingCandidate> estimate_candidates(const SegmentStatistics& statistics,
+                                                            const DataType data_type,
+                                                            const SegmentAccessCounter& access_counter);
+
+  /**
+   * Chooses an encoding for each segment of the immutable chunks of the given data tables so that the estimated memory
+   * usage of all these segments does not exceed memory_budget, unless even the smallest encodings do. Segments that
+   * are not advised (see above) count towards the budget with their current memory usage.
+   */
+  std::vector<SegmentRecommendation> recommend(const std::vector<std::shared_ptr<Table>>& tables,
+                                               const size_t memory_budget) const;
+
+  // Returns the current memory usage of the segments of the immutable chunks of the given data tables
+  static size_t memory_usage(const std::vector<std::shared_ptr<Table>>& tables);
+
+  /**
+   * Re-encodes the segments whose current encoding differs from the recommendation. The SegmentAccessCounter is carried
+   * over to the new segment. Returns the number of re-encoded segments.
+   */
+  static size_t apply(const std::vector<SegmentRecommendation>& recommendations);
+
+ private:
+  const size_t _sample_size;
+};
+
+}  // namespace opossum
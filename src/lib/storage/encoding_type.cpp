@@ -32,6 +32,9 @@ std::ostream& operator<<(std::ostream& stream, const SegmentEncodingSpec& spec)
   if (spec.vector_compression_type) {
     stream << " (" << *spec.vector_compression_type << ")";
   }
+  if (spec.shared_dictionary) {
+    stream << " (shared dictionary)";
+  }
   return stream;
 }
 
@@ -43,7 +43,8 @@ constexpr auto supported_data_types_for_encoding_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::Dictionary>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, hana::tuple_t<pmr_string>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                    hana::tuple_t<int32_t, int64_t, float, double>),
     hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, data_types));
 
 /**
@@ -66,14 +67,25 @@ struct SegmentEncodingSpec {
   constexpr SegmentEncodingSpec(EncodingType init_encoding_type,
                                 std::optional<VectorCompressionType> init_vector_compression_type)
       : encoding_type{init_encoding_type}, vector_compression_type{init_vector_compression_type} {}
+  constexpr SegmentEncodingSpec(EncodingType init_encoding_type,
+                                std::optional<VectorCompressionType> init_vector_compression_type,
+                                bool init_shared_dictionary)
+      : encoding_type{init_encoding_type},
+        vector_compression_type{init_vector_compression_type},
+        shared_dictionary{init_shared_dictionary} {}
 
   EncodingType encoding_type;
   std::optional<VectorCompressionType> vector_compression_type;
+
+  // If set, all segments of the column use a single dictionary (see
+  // ChunkEncoder::encode_column_with_shared_dictionary). As this concerns the whole column, it is ignored when encoding
+  // single segments or chunks.
+  bool shared_dictionary{false};
 };
 
 inline bool operator==(const SegmentEncodingSpec& lhs, const SegmentEncodingSpec& rhs) {
-  return std::tie(lhs.encoding_type, lhs.vector_compression_type) ==
-         std::tie(rhs.encoding_type, rhs.vector_compression_type);
+  return std::tie(lhs.encoding_type, lhs.vector_compression_type, lhs.shared_dictionary) ==
+         std::tie(rhs.encoding_type, rhs.vector_compression_type, rhs.shared_dictionary);
 }
 
 std::ostream& operator<<(std::ostream& stream, const SegmentEncodingSpec& spec);
@@ -125,6 +125,12 @@ ValueID FixedStringDictionarySegment<T>::null_value_id() const {
   return ValueID{static_cast<ValueID::base_type>(_dictionary->size())};
 }
 
+template <typename T>
+bool FixedStringDictionarySegment<T>::shares_dictionary_with(const BaseDictionarySegment& other) const {
+  const auto* other_segment = dynamic_cast<const FixedStringDictionarySegment<T>*>(&other);
+  return other_segment && other_segment->_dictionary == _dictionary;
+}
+
 template class FixedStringDictionarySegment<pmr_string>;
 
 }  // namespace opossum
@@ -67,6 +67,8 @@ class FixedStringDictionarySegment : public BaseDictionarySegment {
 
   ValueID null_value_id() const final;
 
+  bool shares_dictionary_with(const BaseDictionarySegment& other) const final;
+
   /**@}*/
 
  protected:
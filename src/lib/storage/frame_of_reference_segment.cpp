@@ -9,12 +9,22 @@ namespace opossum {
 
 template <typename T, typename U>
 FrameOfReferenceSegment<T, U>::FrameOfReferenceSegment(pmr_vector<T> block_minima, pmr_vector<bool> null_values,
-                                                       std::unique_ptr<const BaseCompressedVector> offset_values)
+                                                       std::unique_ptr<const BaseCompressedVector> offset_values,
+                                                       std::unique_ptr<const BaseCompressedVector> high_offset_values)
     : BaseEncodedSegment{data_type_from_type<T>()},
       _block_minima{std::move(block_minima)},
       _null_values{std::move(null_values)},
       _offset_values{std::move(offset_values)},
-      _decompressor{_offset_values->create_base_decompressor()} {}
+      _high_offset_values{std::move(high_offset_values)},
+      _decompressor{_offset_values->create_base_decompressor()} {
+  if (_high_offset_values) {
+    Assert(sizeof(T) == sizeof(uint64_t), "High offset values are only used for 64-bit data types");
+    Assert(_high_offset_values->type() == _offset_values->type() &&
+               _high_offset_values->size() == _offset_values->size(),
+           "High offset values must be compressed like the offset values");
+    _high_decompressor = _high_offset_values->create_base_decompressor();
+  }
+}
 
 template <typename T, typename U>
 const pmr_vector<T>& FrameOfReferenceSegment<T, U>::block_minima() const {
@@ -31,6 +41,11 @@ const BaseCompressedVector& FrameOfReferenceSegment<T, U>::offset_values() const
   return *_offset_values;
 }
 
+template <typename T, typename U>
+const BaseCompressedVector* FrameOfReferenceSegment<T, U>::high_offset_values() const {
+  return _high_offset_values.get();
+}
+
 template <typename T, typename U>
 AllTypeVariant FrameOfReferenceSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
@@ -54,9 +69,12 @@ std::shared_ptr<BaseSegment> FrameOfReferenceSegment<T, U>::copy_using_allocator
   auto new_block_minima = pmr_vector<T>{_block_minima, alloc};
   auto new_null_values = pmr_vector<bool>{_null_values, alloc};
   auto new_offset_values = _offset_values->copy_using_allocator(alloc);
+  auto new_high_offset_values = std::unique_ptr<const BaseCompressedVector>{};
+  if (_high_offset_values) new_high_offset_values = _high_offset_values->copy_using_allocator(alloc);
 
-  auto copy = std::make_shared<FrameOfReferenceSegment>(std::move(new_block_minima), std::move(new_null_values),
-                                                        std::move(new_offset_values));
+  auto copy =
+      std::make_shared<FrameOfReferenceSegment>(std::move(new_block_minima), std::move(new_null_values),
+                                                std::move(new_offset_values), std::move(new_high_offset_values));
 
   copy->access_counter = access_counter;
 
@@ -66,8 +84,9 @@ std::shared_ptr<BaseSegment> FrameOfReferenceSegment<T, U>::copy_using_allocator
 template <typename T, typename U>
 size_t FrameOfReferenceSegment<T, U>::memory_usage(const MemoryUsageCalculationMode) const {
   // MemoryUsageCalculationMode ignored since full calculation is efficient.
+  const auto high_offset_values_size = _high_offset_values ? _high_offset_values->data_size() : size_t{0u};
   return sizeof(*this) + sizeof(T) * _block_minima.capacity() + _offset_values->data_size() +
-         _null_values.capacity() / CHAR_BIT;
+         high_offset_values_size + _null_values.capacity() / CHAR_BIT;
 }
 
 template <typename T, typename U>
@@ -81,7 +100,8 @@ std::optional<CompressedVectorType> FrameOfReferenceSegment<T, U>::compressed_ve
 }
 
 template class FrameOfReferenceSegment<int32_t>;
-// int64_t disabled for now, as vector compression cannot handle 64 bit values - also in reference_segment_iterable.hpp
-// template class FrameOfReferenceSegment<int64_t>;
+template class FrameOfReferenceSegment<int64_t>;
+template class FrameOfReferenceSegment<float>;
+template class FrameOfReferenceSegment<double>;
 
 }  // namespace opossum
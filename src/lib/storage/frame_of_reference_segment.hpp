@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <climits>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 
@@ -27,13 +29,23 @@ class BaseCompressedVector;
  * FOR encoding on its own without vector compression does not
  * add any benefit.
  *
+ * To support floating-point numbers and 64-bit integers, values are
+ * first mapped to unsigned integers of the same width in an
+ * order-preserving way (see to_ordered_unsigned). Offsets are
+ * calculated on these unsigned integers. As vector compression
+ * handles 32-bit values only, the offsets of 64-bit types are split:
+ * offset_values stores the lower 32 bits and, only if any offset
+ * does not fit into 32 bits, high_offset_values stores the upper 32
+ * bits. For timestamps and ids, the values within a block usually
+ * lie close together so that the high offsets are not needed.
+ *
  * Null values are stored in a separate vector. Note, for correct
  * offset handling, the minimum of each frame is stored in the
  * offset_values vector at each position that is NULL.
  *
  * std::enable_if_t must be used here and cannot be replaced by a
  * static_assert in order to prevent instantiation of
- * FrameOfReferenceSegment<T> with T other than int32_t. Otherwise,
+ * FrameOfReferenceSegment<T> with unsupported types. Otherwise,
  * the compiler might instantiate FrameOfReferenceSegment with other
  * types even if they are never actually needed.
  * "If the function selected by overload resolution can be determined
@@ -54,13 +66,50 @@ class FrameOfReferenceSegment : public BaseEncodedSegment {
    */
   static constexpr auto block_size = 2048u;
 
+  // Unsigned integer type of the same width as T, on which offsets are calculated
+  using UnsignedType = std::conditional_t<sizeof(T) == sizeof(uint64_t), uint64_t, uint32_t>;
+
   explicit FrameOfReferenceSegment(pmr_vector<T> block_minima, pmr_vector<bool> null_values,
-                                   std::unique_ptr<const BaseCompressedVector> offset_values);
+                                   std::unique_ptr<const BaseCompressedVector> offset_values,
+                                   std::unique_ptr<const BaseCompressedVector> high_offset_values = nullptr);
 
   const pmr_vector<T>& block_minima() const;
   const pmr_vector<bool>& null_values() const;
   const BaseCompressedVector& offset_values() const;
 
+  // Upper 32 bits of the offsets. nullptr if all offsets fit into 32 bits. Otherwise, the vector has the same type as
+  // offset_values, so that both can be decoded with the same iterators.
+  const BaseCompressedVector* high_offset_values() const;
+
+  /**
+   * Maps a value to an unsigned integer so that the order of the values is preserved: For signed integers, the sign
+   * bit is flipped. For floating-point numbers, the sign bit is set for positive numbers and all bits are flipped for
+   * negative numbers. The mapping is bijective, thus, the encoding is lossless (including -0.0 and NaNs).
+   */
+  static UnsignedType to_ordered_unsigned(const T value) {
+    auto bits = UnsignedType{};
+    std::memcpy(&bits, &value, sizeof(T));
+
+    if constexpr (std::is_integral_v<T>) {
+      return bits ^ SIGN_BIT;
+    } else {
+      return (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    }
+  }
+
+  static T from_ordered_unsigned(const UnsignedType ordered_unsigned) {
+    auto bits = UnsignedType{};
+    if constexpr (std::is_integral_v<T>) {
+      bits = ordered_unsigned ^ SIGN_BIT;
+    } else {
+      bits = (ordered_unsigned & SIGN_BIT) ? ordered_unsigned ^ SIGN_BIT : ~ordered_unsigned;
+    }
+
+    auto value = T{};
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  }
+
   /**
    * @defgroup BaseSegment interface
    * @{
@@ -73,9 +122,14 @@ class FrameOfReferenceSegment : public BaseEncodedSegment {
     if (_null_values[chunk_offset]) {
       return std::nullopt;
     }
+    auto offset = static_cast<UnsignedType>(_decompressor->get(chunk_offset));
+    if constexpr (sizeof(UnsignedType) == sizeof(uint64_t)) {
+      if (_high_decompressor) {
+        offset |= static_cast<UnsignedType>(_high_decompressor->get(chunk_offset)) << 32u;
+      }
+    }
     const auto minimum = _block_minima[chunk_offset / block_size];
-    const auto value = static_cast<T>(_decompressor->get(chunk_offset)) + minimum;
-    return value;
+    return from_ordered_unsigned(to_ordered_unsigned(minimum) + offset);
   }
 
   ChunkOffset size() const final;
@@ -97,10 +151,14 @@ class FrameOfReferenceSegment : public BaseEncodedSegment {
   /**@}*/
 
  private:
+  static constexpr auto SIGN_BIT = UnsignedType{1u} << (sizeof(UnsignedType) * CHAR_BIT - 1u);
+
   const pmr_vector<T> _block_minima;
   const pmr_vector<bool> _null_values;
   const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  const std::unique_ptr<const BaseCompressedVector> _high_offset_values;
   std::unique_ptr<BaseVectorDecompressor> _decompressor;
+  std::unique_ptr<BaseVectorDecompressor> _high_decompressor;
 };
 
 }  // namespace opossum
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <optional>
 #include <type_traits>
 
 #include "storage/base_segment.hpp"
@@ -13,6 +16,7 @@ template <typename T>
 class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<FrameOfReferenceSegmentIterable<T>> {
  public:
   using ValueType = T;
+  using UnsignedType = typename FrameOfReferenceSegment<T>::UnsignedType;
 
   explicit FrameOfReferenceSegmentIterable(const FrameOfReferenceSegment<T>& segment) : _segment{segment} {}
 
@@ -22,12 +26,18 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
       using OffsetValueIteratorT = decltype(offset_values.cbegin());
 
-      auto begin = Iterator<OffsetValueIteratorT>{_segment.block_minima().cbegin(), offset_values.cbegin(),
-                                                  _segment.null_values().cbegin(), ChunkOffset{0}};
+      auto high_offset_value_it = std::optional<OffsetValueIteratorT>{};
+      if (const auto* high_offset_values = _typed_high_offset_values(offset_values)) {
+        high_offset_value_it = high_offset_values->cbegin();
+      }
+
+      auto begin =
+          Iterator<OffsetValueIteratorT>{_segment.block_minima().cbegin(), offset_values.cbegin(), high_offset_value_it,
+                                         _segment.null_values().cbegin(), ChunkOffset{0}};
 
-      auto end =
-          Iterator<OffsetValueIteratorT>{_segment.block_minima().cend(), offset_values.cend(),
-                                         _segment.null_values().cend(), static_cast<ChunkOffset>(_segment.size())};
+      auto end = Iterator<OffsetValueIteratorT>{_segment.block_minima().cend(), offset_values.cend(), std::nullopt,
+                                                _segment.null_values().cend(),
+                                                static_cast<ChunkOffset>(_segment.size())};
 
       functor(begin, end);
     });
@@ -40,10 +50,15 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
       auto decompressor = vector.create_decompressor();
       using OffsetValueDecompressorT = std::decay_t<decltype(decompressor)>;
 
+      auto high_decompressor = std::optional<OffsetValueDecompressorT>{};
+      if (const auto* high_offset_values = _typed_high_offset_values(vector)) {
+        high_decompressor = high_offset_values->create_decompressor();
+      }
+
       using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
       auto begin = PointAccessIterator<OffsetValueDecompressorT, PosListIteratorType>{
-          &_segment.block_minima(), &_segment.null_values(), std::move(decompressor), position_filter->cbegin(),
-          position_filter->cbegin()};
+          &_segment.block_minima(), &_segment.null_values(), std::move(decompressor),
+          std::move(high_decompressor), position_filter->cbegin(), position_filter->cbegin()};
       auto end = PointAccessIterator<OffsetValueDecompressorT, PosListIteratorType>{position_filter->cbegin(),
                                                                                     position_filter->cend()};
       functor(begin, end);
@@ -52,9 +67,102 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
   size_t _on_size() const { return _segment.size(); }
 
+  /**
+   * @defgroup Bulk materialization, see SegmentIterable
+   * Instead of decoding value by value, the offsets of a block are decompressed into a buffer first so that adding
+   * the block's minimum can be vectorized.
+   * @{
+   */
+
+  template <typename Container>
+  void materialize_values(Container& container) const {
+    auto index = container.size();
+    container.resize(container.size() + _segment.size());
+    _decode_blocks([&](const ChunkOffset block_begin, const T* values, const size_t count) {
+      std::copy(values, values + count, container.begin() + index + block_begin);
+    });
+  }
+
+  template <typename Container>
+  void materialize_values_and_nulls(Container& container) const {
+    auto index = container.size();
+    container.resize(container.size() + _segment.size());
+
+    const auto& null_values = _segment.null_values();
+    _decode_blocks([&](const ChunkOffset block_begin, const T* values, const size_t count) {
+      for (auto value_index = size_t{0u}; value_index < count; ++value_index) {
+        container[index + block_begin + value_index] =
+            std::make_pair(null_values[block_begin + value_index], values[value_index]);
+      }
+    });
+  }
+
+  /**@}*/
+
  private:
   const FrameOfReferenceSegment<T>& _segment;
 
+  // Returns the high offset values of the segment as the type of the (already resolved) offset values
+  template <typename OffsetValuesT>
+  const OffsetValuesT* _typed_high_offset_values(const OffsetValuesT& /*offset_values*/) const {
+    const auto* high_offset_values = _segment.high_offset_values();
+    if (!high_offset_values) return nullptr;
+
+    DebugAssert(dynamic_cast<const OffsetValuesT*>(high_offset_values),
+                "High offset values must have the same type as the offset values");
+    return static_cast<const OffsetValuesT*>(high_offset_values);
+  }
+
+  // Calls functor(block_begin, values, count) for each block of the segment with the decoded values of that block
+  template <typename Functor>
+  void _decode_blocks(const Functor& functor) const {
+    static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
+
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+
+    const auto& block_minima = _segment.block_minima();
+    const auto size = static_cast<size_t>(_segment.size());
+
+    auto offsets = std::array<UnsignedType, block_size>{};
+    auto values = std::array<T, block_size>{};
+
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      const auto* high_offset_values = _typed_high_offset_values(offset_values);
+
+      auto offset_value_it = offset_values.cbegin();
+      auto high_offset_value_it = high_offset_values ? high_offset_values->cbegin() : offset_values.cend();
+      for (auto block_index = size_t{0u}; block_index < block_minima.size(); ++block_index) {
+        const auto block_begin = block_index * block_size;
+        const auto count = std::min(size_t{block_size}, size - block_begin);
+
+        for (auto value_index = size_t{0u}; value_index < count; ++value_index, ++offset_value_it) {
+          offsets[value_index] = *offset_value_it;
+        }
+
+        if constexpr (sizeof(UnsignedType) == sizeof(uint64_t)) {
+          if (high_offset_values) {
+            for (auto value_index = size_t{0u}; value_index < count; ++value_index, ++high_offset_value_it) {
+              offsets[value_index] |= static_cast<UnsignedType>(*high_offset_value_it) << 32u;
+            }
+          }
+        }
+
+        const auto minimum = FrameOfReferenceSegment<T>::to_ordered_unsigned(block_minima[block_index]);
+
+        // This empty block is used to convince clang-format to keep the pragma indented
+        // NOLINTNEXTLINE
+        {}  // clang-format off
+        #pragma omp simd
+        // clang-format on
+        for (auto value_index = size_t{0u}; value_index < count; ++value_index) {
+          values[value_index] = FrameOfReferenceSegment<T>::from_ordered_unsigned(minimum + offsets[value_index]);
+        }
+
+        functor(static_cast<ChunkOffset>(block_begin), values.data(), count);
+      }
+    });
+  }
+
  private:
   template <typename OffsetValueIteratorT>
   class Iterator : public BaseSegmentIterator<Iterator<OffsetValueIteratorT>, SegmentPosition<T>> {
@@ -66,9 +174,11 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
    public:
     explicit Iterator(ReferenceFrameIterator block_minimum_it, OffsetValueIteratorT offset_value_it,
-                      NullValueIterator null_value_it, ChunkOffset chunk_offset)
+                      std::optional<OffsetValueIteratorT> high_offset_value_it, NullValueIterator null_value_it,
+                      ChunkOffset chunk_offset)
         : _block_minimum_it{std::move(block_minimum_it)},
           _offset_value_it{std::move(offset_value_it)},
+          _high_offset_value_it{std::move(high_offset_value_it)},
           _null_value_it{std::move(null_value_it)},
           _index_within_frame{0u},
           _chunk_offset{chunk_offset} {}
@@ -78,6 +188,7 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
     void increment() {
       ++_offset_value_it;
+      if (_high_offset_value_it) ++*_high_offset_value_it;
       ++_null_value_it;
       ++_index_within_frame;
       ++_chunk_offset;
@@ -90,6 +201,7 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
     void decrement() {
       --_offset_value_it;
+      if (_high_offset_value_it) --*_high_offset_value_it;
       --_null_value_it;
       --_chunk_offset;
 
@@ -120,13 +232,20 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     std::ptrdiff_t distance_to(const Iterator& other) const { return other._offset_value_it - _offset_value_it; }
 
     SegmentPosition<T> dereference() const {
-      const auto value = static_cast<T>(*_offset_value_it) + *_block_minimum_it;
+      auto offset = static_cast<UnsignedType>(*_offset_value_it);
+      if constexpr (sizeof(UnsignedType) == sizeof(uint64_t)) {
+        if (_high_offset_value_it) offset |= static_cast<UnsignedType>(**_high_offset_value_it) << 32u;
+      }
+
+      const auto minimum = FrameOfReferenceSegment<T>::to_ordered_unsigned(*_block_minimum_it);
+      const auto value = FrameOfReferenceSegment<T>::from_ordered_unsigned(minimum + offset);
       return SegmentPosition<T>{value, *_null_value_it, _chunk_offset};
     }
 
    private:
     ReferenceFrameIterator _block_minimum_it;
     OffsetValueIteratorT _offset_value_it;
+    std::optional<OffsetValueIteratorT> _high_offset_value_it;
     NullValueIterator _null_value_it;
     size_t _index_within_frame;
     ChunkOffset _chunk_offset;
@@ -143,18 +262,20 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     // Begin Iterator
     PointAccessIterator(const pmr_vector<T>* block_minima, const pmr_vector<bool>* null_values,
                         std::optional<OffsetValueDecompressorT> attribute_decompressor,
+                        std::optional<OffsetValueDecompressorT> high_attribute_decompressor,
                         PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
         : BasePointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressorT, PosListIteratorType>,
                                          SegmentPosition<T>, PosListIteratorType>{std::move(position_filter_begin),
                                                                                   std::move(position_filter_it)},
           _block_minima{block_minima},
           _null_values{null_values},
-          _offset_value_decompressor{std::move(attribute_decompressor)} {}
+          _offset_value_decompressor{std::move(attribute_decompressor)},
+          _high_offset_value_decompressor{std::move(high_attribute_decompressor)} {}
 
     // End Iterator
     explicit PointAccessIterator(const PosListIteratorType position_filter_begin,
                                  PosListIteratorType position_filter_it)
-        : PointAccessIterator{nullptr, nullptr, std::nullopt, std::move(position_filter_begin),
+        : PointAccessIterator{nullptr, nullptr, std::nullopt, std::nullopt, std::move(position_filter_begin),
                               std::move(position_filter_it)} {}
 
    private:
@@ -165,10 +286,20 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
       static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
 
-      const auto is_null = (*_null_values)[chunk_offsets.offset_in_referenced_chunk];
-      const auto block_minimum = (*_block_minima)[chunk_offsets.offset_in_referenced_chunk / block_size];
-      const auto offset_value = _offset_value_decompressor->get(chunk_offsets.offset_in_referenced_chunk);
-      const auto value = static_cast<T>(offset_value) + block_minimum;
+      const auto chunk_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      const auto is_null = (*_null_values)[chunk_offset];
+      const auto block_minimum = (*_block_minima)[chunk_offset / block_size];
+
+      auto offset = static_cast<UnsignedType>(_offset_value_decompressor->get(chunk_offset));
+      if constexpr (sizeof(UnsignedType) == sizeof(uint64_t)) {
+        if (_high_offset_value_decompressor) {
+          offset |= static_cast<UnsignedType>(_high_offset_value_decompressor->get(chunk_offset)) << 32u;
+        }
+      }
+
+      const auto minimum = FrameOfReferenceSegment<T>::to_ordered_unsigned(block_minimum);
+      const auto value = FrameOfReferenceSegment<T>::from_ordered_unsigned(minimum + offset);
 
       return SegmentPosition<T>{value, is_null, chunk_offsets.offset_in_poslist};
     }
@@ -177,6 +308,7 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     const pmr_vector<T>* _block_minima;
     const pmr_vector<bool>* _null_values;
     mutable std::optional<OffsetValueDecompressorT> _offset_value_decompressor;
+    mutable std::optional<OffsetValueDecompressorT> _high_offset_value_decompressor;
   };
 };
 
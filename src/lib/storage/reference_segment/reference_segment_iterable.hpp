@@ -70,7 +70,8 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 #endif
 
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
-            if constexpr (std::is_same_v<T, int32_t>) {
+            if constexpr (hana::value(encoding_supports_data_type(
+                              enum_c<EncodingType, EncodingType::FrameOfReference>, hana::type_c<T>))) {
               if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) return;
             }
 #endif
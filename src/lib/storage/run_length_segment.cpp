@@ -16,7 +16,20 @@ RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<const pmr_vector<T>>
     : BaseEncodedSegment(data_type_from_type<T>()),
       _values{values},
       _null_values{null_values},
-      _end_positions{end_positions} {}
+      _end_positions{end_positions},
+      _run_index{end_positions->get_allocator()} {
+  const auto row_count = size();
+  const auto sample_count = (row_count + run_index_sample_distance - 1u) / run_index_sample_distance;
+  if (sample_count > _end_positions->size()) return;
+
+  _run_index.reserve(sample_count);
+
+  auto run = size_t{0u};
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < row_count; chunk_offset += run_index_sample_distance) {
+    while ((*_end_positions)[run] < chunk_offset) ++run;
+    _run_index.push_back(static_cast<ChunkOffset>(run));
+  }
+}
 
 template <typename T>
 std::shared_ptr<const pmr_vector<T>> RunLengthSegment<T>::values() const {
@@ -33,6 +46,11 @@ std::shared_ptr<const pmr_vector<ChunkOffset>> RunLengthSegment<T>::end_position
   return _end_positions;
 }
 
+template <typename T>
+const pmr_vector<ChunkOffset>& RunLengthSegment<T>::run_index() const {
+  return _run_index;
+}
+
 template <typename T>
 AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
@@ -67,7 +85,8 @@ template <typename T>
 size_t RunLengthSegment<T>::memory_usage([[maybe_unused]] const MemoryUsageCalculationMode mode) const {
   const auto common_elements_size =
       sizeof(*this) + _null_values->capacity() / CHAR_BIT +
-      _end_positions->capacity() * sizeof(typename decltype(_end_positions)::element_type::value_type);
+      _end_positions->capacity() * sizeof(typename decltype(_end_positions)::element_type::value_type) +
+      _run_index.capacity() * sizeof(ChunkOffset);
 
   if constexpr (std::is_same_v<T, pmr_string>) {  // NOLINT
     return common_elements_size + string_vector_memory_usage(*_values, mode);
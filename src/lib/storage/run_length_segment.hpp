@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 
 #include "base_encoded_segment.hpp"
@@ -38,10 +39,23 @@ class BaseCompressedVector;
  *  values:          1 2 2 3  (note, repeating values)
  *  null values:     0 0 1 0
  *  end positions:   2 4 6 8
+ *
+ * To speed up random accesses (e.g., via ReferenceSegments), the
+ * segment additionally keeps a sampled run index, which is derived
+ * from the end positions when the segment is created. For every
+ * run_index_sample_distance-th chunk offset, it stores the index of
+ * the run containing that offset. Point accesses thus only need to
+ * search the few runs between two samples instead of all runs. The
+ * index is only built if it is not larger than the end positions,
+ * i.e., if there are many short runs. Otherwise, the binary search
+ * over all end positions is cheap anyway.
  */
 template <typename T>
 class RunLengthSegment : public BaseEncodedSegment {
  public:
+  // Distance between two chunk offsets that are sampled in the run index (a power of two so that the division is cheap)
+  static constexpr auto run_index_sample_distance = ChunkOffset{64};
+
   explicit RunLengthSegment(const std::shared_ptr<const pmr_vector<T>>& values,
                             const std::shared_ptr<const pmr_vector<bool>>& null_values,
                             const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions);
@@ -49,6 +63,25 @@ class RunLengthSegment : public BaseEncodedSegment {
   std::shared_ptr<const pmr_vector<T>> values() const;
   std::shared_ptr<const pmr_vector<bool>> null_values() const;
   std::shared_ptr<const pmr_vector<ChunkOffset>> end_positions() const;
+  const pmr_vector<ChunkOffset>& run_index() const;
+
+  // Returns the index of the run containing the given chunk offset (i.e., the position in values and end_positions)
+  size_t run_for_chunk_offset(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    const auto sample_index = chunk_offset / run_index_sample_distance;
+    if (sample_index >= _run_index.size()) {
+      // No run index was built (or chunk_offset is not part of the segment, e.g., for end iterators)
+      return std::distance(_end_positions->cbegin(),
+                           std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset));
+    }
+
+    const auto search_begin = _end_positions->cbegin() + _run_index[sample_index];
+    const auto search_end = sample_index + 1u < _run_index.size()
+                                ? _end_positions->cbegin() + _run_index[sample_index + 1u] + 1u
+                                : _end_positions->cend();
+
+    return std::distance(_end_positions->cbegin(), std::lower_bound(search_begin, search_end, chunk_offset));
+  }
 
   /**
    * @defgroup BaseSegment interface
@@ -59,8 +92,7 @@ class RunLengthSegment : public BaseEncodedSegment {
 
   std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const {
     // performance critical - not in cpp to help with inlining
-    const auto end_position_it = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset);
-    const auto index = std::distance(_end_positions->cbegin(), end_position_it);
+    const auto index = run_for_chunk_offset(chunk_offset);
 
     const auto is_null = (*_null_values)[index];
     if (is_null) {
@@ -92,6 +124,7 @@ class RunLengthSegment : public BaseEncodedSegment {
   const std::shared_ptr<const pmr_vector<T>> _values;
   const std::shared_ptr<const pmr_vector<bool>> _null_values;
   const std::shared_ptr<const pmr_vector<ChunkOffset>> _end_positions;
+  pmr_vector<ChunkOffset> _run_index;
 };
 
 }  // namespace opossum
@@ -19,9 +19,9 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
     _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
-    auto begin = Iterator{_segment.values(), _segment.null_values(), _segment.end_positions(),
+    auto begin = Iterator{_segment, _segment.values(), _segment.null_values(), _segment.end_positions(),
                           _segment.end_positions()->cbegin(), ChunkOffset{0}};
-    auto end = Iterator{_segment.values(), _segment.null_values(), _segment.end_positions(),
+    auto end = Iterator{_segment, _segment.values(), _segment.null_values(), _segment.end_positions(),
                         _segment.end_positions()->cend(), static_cast<ChunkOffset>(_segment.size())};
 
     functor(begin, end);
@@ -32,20 +32,84 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
     _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
 
     using PosListIteratorType = decltype(position_filter->cbegin());
-    auto begin =
-        PointAccessIterator<PosListIteratorType>{_segment.values(), _segment.null_values(), _segment.end_positions(),
-                                                 position_filter->cbegin(), position_filter->cbegin()};
-    auto end =
-        PointAccessIterator<PosListIteratorType>{_segment.values(), _segment.null_values(), _segment.end_positions(),
-                                                 position_filter->cbegin(), position_filter->cend()};
+    auto begin = PointAccessIterator<PosListIteratorType>{_segment,
+                                                          _segment.values(),
+                                                          _segment.null_values(),
+                                                          _segment.end_positions(),
+                                                          position_filter->cbegin(),
+                                                          position_filter->cbegin()};
+    auto end = PointAccessIterator<PosListIteratorType>{_segment,
+                                                        _segment.values(),
+                                                        _segment.null_values(),
+                                                        _segment.end_positions(),
+                                                        position_filter->cbegin(),
+                                                        position_filter->cend()};
     functor(begin, end);
   }
 
   size_t _on_size() const { return _segment.size(); }
 
+  /**
+   * @defgroup Bulk materialization, see SegmentIterable
+   * Instead of decoding value by value, each run is written at once using std::fill, which the compiler vectorizes.
+   * @{
+   */
+
+  template <typename Container>
+  void materialize_values(Container& container) const {
+    auto index = container.size();
+    container.resize(container.size() + _segment.size());
+
+    const auto& values = *_segment.values();
+    _for_each_run([&](const size_t run, const ChunkOffset run_begin, const ChunkOffset run_end) {
+      std::fill(container.begin() + index + run_begin, container.begin() + index + run_end, values[run]);
+    });
+  }
+
+  template <typename Container>
+  void materialize_values_and_nulls(Container& container) const {
+    auto index = container.size();
+    container.resize(container.size() + _segment.size());
+
+    const auto& values = *_segment.values();
+    const auto& null_values = *_segment.null_values();
+    _for_each_run([&](const size_t run, const ChunkOffset run_begin, const ChunkOffset run_end) {
+      std::fill(container.begin() + index + run_begin, container.begin() + index + run_end,
+                std::make_pair(static_cast<bool>(null_values[run]), values[run]));
+    });
+  }
+
+  template <typename Container>
+  void materialize_nulls(Container& container) const {
+    auto index = container.size();
+    container.resize(container.size() + _segment.size());
+
+    const auto& null_values = *_segment.null_values();
+    _for_each_run([&](const size_t run, const ChunkOffset run_begin, const ChunkOffset run_end) {
+      std::fill(container.begin() + index + run_begin, container.begin() + index + run_end,
+                static_cast<bool>(null_values[run]));
+    });
+  }
+
+  /**@}*/
+
  private:
   const RunLengthSegment<T>& _segment;
 
+  // Calls functor(run, run_begin, run_end) for each run, where [run_begin, run_end) are the chunk offsets of the run
+  template <typename Functor>
+  void _for_each_run(const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+
+    const auto& end_positions = *_segment.end_positions();
+    auto run_begin = ChunkOffset{0u};
+    for (auto run = size_t{0u}; run < end_positions.size(); ++run) {
+      const auto run_end = static_cast<ChunkOffset>(end_positions[run] + 1u);
+      functor(run, run_begin, run_end);
+      run_begin = run_end;
+    }
+  }
+
   /**
    * Due to the nature of Run Length encoding, point-access is not in O(1).
    * Run length segments store the end positions of runs in a sorted vector. To access a particular position, this
@@ -84,8 +148,8 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
 
   using EndPositionIterator = typename pmr_vector<ChunkOffset>::const_iterator;
   static EndPositionIterator search_end_positions_for_chunk_offset(
-      const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions, const ChunkOffset old_chunk_offset,
-      const ChunkOffset new_chunk_offset, const size_t previous_end_position_index,
+      const RunLengthSegment<T>& segment, const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions,
+      const ChunkOffset old_chunk_offset, const ChunkOffset new_chunk_offset, const size_t previous_end_position_index,
       const size_t linear_search_threshold) {
     const int64_t step_size = static_cast<int64_t>(new_chunk_offset) - old_chunk_offset;
 
@@ -93,25 +157,21 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
      * Depending on the estimated threshold and the step size, a different search approach is used. The threshold
      * estimates how large the offset between the previously searched chunk offset and the currently searched chunk
      * offset needs to be before a binary search is faster than linearly searching. Three cases are handled:
-     *   - If the chunk offset is smaller than the previous offset (can happen, e.g., after joins), use a binary
-     *     search from the beginning up to the previous position. Whenever reverse iteration is frequently used, we
-     *     should consider using linear searching here as well (see below, currently blocked by #1531).
+     *   - If the chunk offset is smaller than the previous offset (can happen, e.g., after joins), use the run index
+     *     of the segment (see RunLengthSegment::run_for_chunk_offset). Whenever reverse iteration is frequently used,
+     *     we should consider using linear searching here as well (see below, currently blocked by #1531).
      *   - If the chunk offset is larger than the previous offset and the step size for the next offset is smaller
      *     than the estimated threshold, search linearly from the previous offset up to the end.
      *   - If the chunk offset is larger than the previous offset and the step size for the next offset is larger
-     *     than the estimated threshold, use a binary search from the previous offset up to the end.
+     *     than the estimated threshold, use the run index of the segment.
      */
-    if (step_size < 0) {
-      return std::lower_bound(end_positions->cbegin(), end_positions->cbegin() + previous_end_position_index,
-                              new_chunk_offset);
-    } else if (step_size < static_cast<int64_t>(linear_search_threshold)) {
+    if (step_size >= 0 && step_size < static_cast<int64_t>(linear_search_threshold)) {
       const auto less_than_current = [&](const ChunkOffset offset) { return offset < new_chunk_offset; };
       return std::find_if_not(end_positions->cbegin() + previous_end_position_index, end_positions->cend(),
                               less_than_current);
-    } else {
-      return std::lower_bound(end_positions->cbegin() + previous_end_position_index, end_positions->cend(),
-                              new_chunk_offset);
     }
+
+    return end_positions->cbegin() + segment.run_for_chunk_offset(new_chunk_offset);
   }
 
  private:
@@ -122,11 +182,12 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
     using EndPositionIterator = typename pmr_vector<ChunkOffset>::const_iterator;
 
    public:
-    explicit Iterator(const std::shared_ptr<const pmr_vector<T>>& values,
+    explicit Iterator(const RunLengthSegment<T>& segment, const std::shared_ptr<const pmr_vector<T>>& values,
                       const std::shared_ptr<const pmr_vector<bool>>& null_values,
                       const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions,
                       EndPositionIterator end_positions_it, ChunkOffset chunk_offset)
-        : _values{values},
+        : _segment{&segment},
+          _values{values},
           _null_values{null_values},
           _end_positions{end_positions},
           _end_positions_it{std::move(end_positions_it)},
@@ -161,7 +222,7 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
       const auto previous_chunk_offset = _chunk_offset;
       _chunk_offset += n;
       _end_positions_it = search_end_positions_for_chunk_offset(
-          _end_positions, previous_chunk_offset, _chunk_offset,
+          *_segment, _end_positions, previous_chunk_offset, _chunk_offset,
           std::distance(_end_positions->cbegin(), _end_positions_it), _linear_search_threshold);
     }
 
@@ -178,6 +239,7 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
     }
 
    private:
+    const RunLengthSegment<T>* _segment;
     std::shared_ptr<const pmr_vector<T>> _values;
     std::shared_ptr<const pmr_vector<bool>> _null_values;
     std::shared_ptr<const pmr_vector<ChunkOffset>> _end_positions;
@@ -202,7 +264,8 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
    * - if it’s the first access, it performs a binary search
    * - for all subsequent accesses it performs
    *   - a linear search in the range [previous_end_position, n] if new_pos >= previous_pos
-   *   - a binary search in the range [0, previous_end_position] else
+   *   - a binary search else
+   * Binary searches use the segment's run index and thus only cover the runs near the requested position.
    */
   template <typename PosListIteratorType>
   class PointAccessIterator : public BasePointAccessSegmentIterator<PointAccessIterator<PosListIteratorType>,
@@ -211,7 +274,8 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
     using ValueType = T;
     using IterableType = RunLengthSegmentIterable<T>;
 
-    explicit PointAccessIterator(const std::shared_ptr<const pmr_vector<T>>& values,
+    explicit PointAccessIterator(const RunLengthSegment<T>& segment,
+                                 const std::shared_ptr<const pmr_vector<T>>& values,
                                  const std::shared_ptr<const pmr_vector<bool>>& null_values,
                                  const std::shared_ptr<const pmr_vector<ChunkOffset>>& end_positions,
                                  const PosListIteratorType position_filter_begin,
@@ -219,6 +283,7 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
         : BasePointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>,
                                          PosListIteratorType>{std::move(position_filter_begin),
                                                               std::move(position_filter_it)},
+          _segment{&segment},
           _values{values},
           _null_values{null_values},
           _end_positions{end_positions},
@@ -233,8 +298,9 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
       const auto& chunk_offsets = this->chunk_offsets();
       const auto current_chunk_offset = chunk_offsets.offset_in_referenced_chunk;
 
-      const auto end_positions_it = search_end_positions_for_chunk_offset(
-          _end_positions, _prev_chunk_offset, current_chunk_offset, _prev_index, _linear_search_threshold);
+      const auto end_positions_it =
+          search_end_positions_for_chunk_offset(*_segment, _end_positions, _prev_chunk_offset, current_chunk_offset,
+                                                _prev_index, _linear_search_threshold);
       const auto target_distance_from_begin = std::distance(_end_positions->cbegin(), end_positions_it);
 
       _prev_chunk_offset = current_chunk_offset;
@@ -245,6 +311,7 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
     }
 
    private:
+    const RunLengthSegment<T>* _segment;
     std::shared_ptr<const pmr_vector<T>> _values;
     std::shared_ptr<const pmr_vector<bool>> _null_values;
     std::shared_ptr<const pmr_vector<ChunkOffset>> _end_positions;
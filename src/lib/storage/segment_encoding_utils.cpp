@@ -3,10 +3,13 @@
 #include <map>
 #include <memory>
 
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/dictionary_segment/dictionary_encoder.hpp"
 #include "storage/frame_of_reference_segment/frame_of_reference_encoder.hpp"
 #include "storage/lz4_segment/lz4_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/run_length_segment/run_length_encoder.hpp"
+#include "storage/table.hpp"
 
 #include "utils/assert.hpp"
 #include "utils/enum_constant.hpp"
@@ -70,4 +73,49 @@ VectorCompressionType parent_vector_compression_type(const CompressedVectorType
   Fail("Invalid enum value");
 }
 
+std::shared_ptr<const BaseDictionarySegment> find_shared_dictionary_segment(const Table& table,
+                                                                            const ColumnID column_id) {
+  const auto chunk_count = table.chunk_count();
+
+  if (table.type() == TableType::References) {
+    auto referenced_table = std::shared_ptr<const Table>{};
+    auto referenced_column_id = INVALID_COLUMN_ID;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+      if (!referenced_table) {
+        referenced_table = reference_segment.referenced_table();
+        referenced_column_id = reference_segment.referenced_column_id();
+      } else if (reference_segment.referenced_table() != referenced_table ||
+                 reference_segment.referenced_column_id() != referenced_column_id) {
+        return nullptr;
+      }
+    }
+
+    if (!referenced_table) return nullptr;
+    return find_shared_dictionary_segment(*referenced_table, referenced_column_id);
+  }
+
+  auto shared_dictionary_segment = std::shared_ptr<const BaseDictionarySegment>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto segment = chunk->get_segment(column_id);
+    const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+    if (!dictionary_segment) return nullptr;
+
+    if (!shared_dictionary_segment) {
+      shared_dictionary_segment = dictionary_segment;
+    } else if (!dictionary_segment->shares_dictionary_with(*shared_dictionary_segment)) {
+      return nullptr;
+    }
+  }
+
+  return shared_dictionary_segment;
+}
+
 }  // namespace opossum
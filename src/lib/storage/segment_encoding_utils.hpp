@@ -10,9 +10,11 @@
 
 namespace opossum {
 
+class BaseDictionarySegment;
 class BaseEncodedSegment;
 class BaseSegmentEncoder;
 class BaseValueSegment;
+class Table;
 
 /**
  * @brief Creates an encoder by encoding type
@@ -31,4 +33,14 @@ SegmentEncodingSpec get_segment_encoding_spec(const std::shared_ptr<const BaseSe
  */
 VectorCompressionType parent_vector_compression_type(const CompressedVectorType compressed_vector_type);
 
+/**
+ * @brief Returns one of the column's dictionary segments if all of them share a single dictionary
+ *
+ * See ChunkEncoder::encode_column_with_shared_dictionary. For reference tables, all segments have to reference the
+ * same column, which is then checked instead. Returns nullptr if the column is not (or not completely) encoded with a
+ * shared dictionary or if the table is empty.
+ */
+std::shared_ptr<const BaseDictionarySegment> find_shared_dictionary_segment(const Table& table,
+                                                                            const ColumnID column_id);
+
 }  // namespace opossum
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "storage/dictionary_segment.hpp"
 #include "storage/dictionary_segment/attribute_vector_iterable.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 
@@ -25,4 +30,46 @@ inline auto create_iterable_from_attribute_vector(const BaseDictionarySegment& s
 
 /**@}*/
 
+/**
+ * Calls functor(chunk_offset, value_id) for each position of a dictionary segment or of a reference segment that only
+ * references dictionary segments. NULL positions get INVALID_VALUE_ID. The value IDs of different segments are only
+ * comparable if their dictionaries are shared (see find_shared_dictionary_segment).
+ */
+template <typename Functor>
+void iterate_value_ids(const BaseSegment& segment, const Functor& functor) {
+  if (const auto* const reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    const auto& referenced_table = *reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+
+    // The decompressors are created lazily per referenced chunk
+    const auto referenced_chunk_count = referenced_table.chunk_count();
+    auto decompressors = std::vector<std::unique_ptr<BaseVectorDecompressor>>(referenced_chunk_count);
+    auto null_value_ids = std::vector<ValueID>(referenced_chunk_count);
+
+    auto chunk_offset = ChunkOffset{0};
+    for (const auto& row_id : *reference_segment->pos_list()) {
+      if (row_id.is_null()) {
+        functor(chunk_offset, INVALID_VALUE_ID);
+      } else {
+        auto& decompressor = decompressors[row_id.chunk_id];
+        if (!decompressor) {
+          const auto& referenced_segment = static_cast<const BaseDictionarySegment&>(
+              *referenced_table.get_chunk(row_id.chunk_id)->get_segment(referenced_column_id));
+          decompressor = referenced_segment.attribute_vector()->create_base_decompressor();
+          null_value_ids[row_id.chunk_id] = referenced_segment.null_value_id();
+        }
+        const auto value_id = ValueID{decompressor->get(row_id.chunk_offset)};
+        functor(chunk_offset, value_id == null_value_ids[row_id.chunk_id] ? INVALID_VALUE_ID : value_id);
+      }
+      ++chunk_offset;
+    }
+    return;
+  }
+
+  const auto& dictionary_segment = static_cast<const BaseDictionarySegment&>(segment);
+  create_iterable_from_attribute_vector(dictionary_segment).for_each([&](const auto& position) {
+    functor(position.chunk_offset(), position.is_null() ? INVALID_VALUE_ID : position.value());
+  });
+}
+
 }  // namespace opossum
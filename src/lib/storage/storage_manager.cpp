@@ -18,7 +18,8 @@
 
 namespace opossum {
 
-void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
+void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table,
+                               std::shared_ptr<TableStatistics> table_statistics) {
   Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
   Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
 
@@ -30,7 +31,8 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
   }
 
   // Create table statistics and chunk pruning statistics for added table.
-  table->set_table_statistics(TableStatistics::from_table(*table));
+  if (!table_statistics) table_statistics = TableStatistics::from_table(*table);
+  table->set_table_statistics(table_statistics);
   generate_chunk_pruning_statistics(table);
 
   _tables.emplace(name, std::move(table));
@@ -14,6 +14,7 @@
 namespace opossum {
 
 class Table;
+class TableStatistics;
 class AbstractLQPNode;
 
 // The StorageManager is a class that maintains all tables
@@ -24,7 +25,9 @@ class StorageManager : public Noncopyable {
    * @defgroup Manage Tables, not thread-safe
    * @{
    */
-  void add_table(const std::string& name, std::shared_ptr<Table> table);
+  // Builds the table statistics unless they are given, e.g., because they were persisted by a checkpoint
+  void add_table(const std::string& name, std::shared_ptr<Table> table,
+                 std::shared_ptr<TableStatistics> table_statistics = nullptr);
   void drop_table(const std::string& name);
   std::shared_ptr<Table> get_table(const std::string& name) const;
   bool has_table(const std::string& name) const;
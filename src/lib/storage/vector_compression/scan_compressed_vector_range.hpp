@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace detail {
+
+// Drops the bits of a mask that refer to positions at or beyond `size`
+inline uint64_t trim_range_scan_mask(const uint64_t mask, const size_t first_index, const size_t size) {
+  const auto remaining = size - first_index;
+  return remaining >= 64u ? mask : mask & ((uint64_t{1u} << remaining) - 1u);
+}
+
+template <typename MaskConsumer>
+void scan_simd_bp128_vector_range(const SimdBp128Vector& vector, const uint32_t lower, const uint32_t upper,
+                                  const MaskConsumer& mask_consumer) {
+  using Packing = SimdBp128Packing;
+
+  const auto* data = vector.data().data();
+  const auto size = vector.size();
+
+  alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  auto block_masks = std::array<uint64_t, 2>{};
+
+  auto meta_info_offset = size_t{0u};
+  for (auto meta_block_first_index = size_t{0u}; meta_block_first_index < size;
+       meta_block_first_index += Packing::meta_block_size) {
+    Packing::read_meta_info(data + meta_info_offset, meta_info.data());
+
+    // The data of the first block directly follows the 128-bit meta info
+    auto block_offset = meta_info_offset + 1u;
+    for (auto block_index = 0u; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_first_index = meta_block_first_index + block_index * Packing::block_size;
+      if (block_first_index >= size) break;
+
+      Packing::scan_block(data + block_offset, block_masks.data(), meta_info[block_index], lower, upper);
+      block_offset += meta_info[block_index];
+
+      // The last block is padded with zeros, which might have matched
+      for (auto mask_index = size_t{0u}; mask_index < block_masks.size(); ++mask_index) {
+        const auto mask_first_index = block_first_index + mask_index * 64u;
+        if (mask_first_index >= size) break;
+
+        const auto mask = trim_range_scan_mask(block_masks[mask_index], mask_first_index, size);
+        if (mask) mask_consumer(mask_first_index, mask);
+      }
+    }
+
+    meta_info_offset = block_offset;
+  }
+}
+
+template <typename UnsignedIntType, typename MaskConsumer>
+void scan_fixed_size_byte_aligned_vector_range(const FixedSizeByteAlignedVector<UnsignedIntType>& vector,
+                                               const uint32_t lower, const uint32_t upper,
+                                               const MaskConsumer& mask_consumer) {
+  const auto& data = vector.data();
+  const auto size = data.size();
+
+  constexpr auto MAX_VALUE = uint64_t{std::numeric_limits<UnsignedIntType>::max()};
+  if (lower >= upper || lower > MAX_VALUE) return;
+
+  // All values of the vector are representable in UnsignedIntType, so we can clamp the range to it. This way, the
+  // comparison below works on 1, 2, or 4-byte wide lanes (i.e., 32, 16, or 8 values per 256-bit register).
+  const auto clamped_upper = std::min(uint64_t{upper}, MAX_VALUE + 1u);
+  if (lower == 0u && clamped_upper == MAX_VALUE + 1u) {
+    for (auto first_index = size_t{0u}; first_index < size; first_index += 64u) {
+      mask_consumer(first_index, trim_range_scan_mask(~uint64_t{0u}, first_index, size));
+    }
+    return;
+  }
+
+  const auto typed_lower = static_cast<UnsignedIntType>(lower);
+  const auto typed_range_size = static_cast<UnsignedIntType>(clamped_upper - lower);
+
+  for (auto first_index = size_t{0u}; first_index < size; first_index += 64u) {
+    const auto* values = data.data() + first_index;
+    const auto count = std::min(size_t{64u}, size - first_index);
+
+    auto mask = uint64_t{0u};
+
+    // This empty block is used to convince clang-format to keep the pragma indented
+    // NOLINTNEXTLINE
+    {}  // clang-format off
+    #pragma omp simd reduction(|:mask)
+    // clang-format on
+    for (auto index = size_t{0u}; index < count; ++index) {
+      // (x >= a && x < b) === ((x - a) < (b - a)), computed in the width of the vector's values
+      const auto in_range = static_cast<UnsignedIntType>(values[index] - typed_lower) < typed_range_size;
+      mask |= static_cast<uint64_t>(in_range) << index;
+    }
+
+    if (mask) mask_consumer(first_index, mask);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Finds all positions of a compressed vector whose value lies within [lower, upper)
+ *
+ * Used by the table scans to evaluate predicates on the value IDs of dictionary segments without decompressing the
+ * attribute vector. The vector is processed in groups of 64 positions: mask_consumer(first_index, mask) is called with
+ * bit i of `mask` set iff the value at `first_index + i` lies within the range. Groups are passed in ascending order;
+ * groups without any match may be skipped.
+ *
+ * SimdBp128Vectors are scanned block-wise on their packed representation (see SimdBp128Packing::scan_block),
+ * FixedSizeByteAlignedVectors are compared in the width of their values.
+ */
+template <typename MaskConsumer>
+void scan_compressed_vector_range(const BaseCompressedVector& vector, const uint32_t lower, const uint32_t upper,
+                                  const MaskConsumer& mask_consumer) {
+  DebugAssert(lower <= upper, "Lower bound of the range must not be greater than the upper bound");
+
+  resolve_compressed_vector_type(vector, [&](const auto& typed_vector) {
+    using VectorType = std::decay_t<decltype(typed_vector)>;
+
+    if constexpr (std::is_same_v<VectorType, SimdBp128Vector>) {
+      opossum::detail::scan_simd_bp128_vector_range(typed_vector, lower, upper, mask_consumer);
+    } else {
+      opossum::detail::scan_fixed_size_byte_aligned_vector_range(typed_vector, lower, upper, mask_consumer);
+    }
+  });
+}
+
+}  // namespace opossum
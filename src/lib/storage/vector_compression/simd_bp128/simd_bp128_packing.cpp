@@ -1,6 +1,8 @@
 #include "simd_bp128_packing.hpp"
 
 #include <algorithm>
+#include <array>
+#include <utility>
 
 #include "utils/assert.hpp"
 
@@ -123,6 +125,96 @@ struct Unpack128Bit<bit_size, carry_over, 0u> {
                   const simd_type& mask) const {}
 };
 
+/**
+ * @brief Evaluates a value range on 128 packed unsigned integers with the specified bit size
+ *
+ * Walks through the packed block exactly like Unpack128Bit, but instead of writing the extracted integers to memory,
+ * each register of four integers is compared against the range [lower, lower + range_size) right away. Only the
+ * resulting match bits are kept: bit i of out (two 64-bit words) is set iff the i-th integer of the block matches.
+ * Because the integers are interleaved, the k-th extracted register holds the integers 4k to 4k + 3.
+ */
+template <uint8_t bit_size, uint8_t carry_over = 0u, uint8_t remaining_recursions = bit_size>
+struct ScanRange128Bit {
+  void operator()(const simd_type* in, simd_type& in_reg, const simd_type& mask, const simd_type& lower,
+                  const simd_type& range_size, uint64_t* out, uint32_t& out_index) const {
+    constexpr auto BITS_IN_WORD = 32u;
+
+    // Number of integers that fit completely into the 32-bit sub-blocks
+    constexpr auto I_MAX = (BITS_IN_WORD - carry_over) / bit_size;
+
+    for (auto i = 0u; i < I_MAX; ++i) {
+      const auto offset = carry_over + i * bit_size;
+      _append_match_bits((in_reg >> offset) & mask, lower, range_size, out, out_index);
+    }
+
+    constexpr auto NEXT_OFFSET = carry_over + I_MAX * bit_size;
+    constexpr auto NUM_FIRST_BITS = BITS_IN_WORD - NEXT_OFFSET;
+
+    // Check if integers have been split across the 128-bit block boundary
+    if (NEXT_OFFSET < BITS_IN_WORD) {
+      const simd_type first_bits = in_reg >> NEXT_OFFSET;
+      in_reg = *in++;
+
+      _append_match_bits(first_bits | ((in_reg << NUM_FIRST_BITS) & mask), lower, range_size, out, out_index);
+    } else {
+      constexpr auto LAST_RECURSION = 1u;
+
+      // Only load another 128-bit block if it’s not the last recursion
+      if (remaining_recursions > LAST_RECURSION) {
+        in_reg = *in++;
+      }
+    }
+
+    // Calculate the new carry over
+    constexpr auto NEW_CARRY_OVER = NEXT_OFFSET < BITS_IN_WORD ? bit_size - NUM_FIRST_BITS : 0u;
+    ScanRange128Bit<bit_size, NEW_CARRY_OVER, remaining_recursions - 1u>{}(in, in_reg, mask, lower, range_size, out,
+                                                                           out_index);
+  }
+
+ private:
+  static void _append_match_bits(const simd_type& values, const simd_type& lower, const simd_type& range_size,
+                                 uint64_t* out, uint32_t& out_index) {
+    // (x >= a && x < b) === ((x - a) < (b - a)), see ColumnBetweenTableScanImpl. The comparison yields -1 (i.e., all
+    // bits set) in matching lanes and 0 otherwise.
+    const auto lane_matches = (values - lower) < range_size;
+    const auto match_bits =
+        static_cast<uint64_t>((lane_matches[0] & 1) | (lane_matches[1] & 2) | (lane_matches[2] & 4) |
+                              (lane_matches[3] & 8));
+
+    out[out_index / 64u] |= match_bits << (out_index % 64u);
+    out_index += 4u;
+  }
+};
+
+template <uint8_t bit_size, uint8_t carry_over>
+struct ScanRange128Bit<bit_size, carry_over, 0u> {
+  void operator()(const simd_type* in, simd_type& in_reg, const simd_type& mask, const simd_type& lower,
+                  const simd_type& range_size, uint64_t* out, uint32_t& out_index) const {}
+};
+
+template <uint8_t bit_size>
+void scan_block_with_bit_size(const simd_type* in, const simd_type& lower, const simd_type& range_size,
+                              uint64_t* out) {
+  simd_type in_reg = *in++;
+  const auto one_mask = static_cast<unsigned int>((1ul << bit_size) - 1);
+  const simd_type mask = {one_mask, one_mask, one_mask, one_mask};
+
+  auto out_index = uint32_t{0u};
+  ScanRange128Bit<bit_size>{}(in, in_reg, mask, lower, range_size, out, out_index);
+}
+
+using ScanBlockFunction = void (*)(const simd_type*, const simd_type&, const simd_type&, uint64_t*);
+
+// Instead of switching over all 32 bit sizes (as in pack_block and unpack_block), the instantiations for the bit sizes
+// 1 to 32 are looked up in a table.
+template <uint8_t... bit_size_offsets>
+constexpr std::array<ScanBlockFunction, sizeof...(bit_size_offsets)> make_scan_block_functions(
+    std::integer_sequence<uint8_t, bit_size_offsets...>) {
+  return {&scan_block_with_bit_size<static_cast<uint8_t>(bit_size_offsets + 1u)>...};
+}
+
+constexpr auto SCAN_BLOCK_FUNCTIONS = make_scan_block_functions(std::make_integer_sequence<uint8_t, 32u>{});
+
 void unpack_128_zeros(uint32_t* out) {
   static constexpr auto NUM_ZEROES = 128u;
   std::fill(out, out + NUM_ZEROES, 0u);
@@ -439,4 +531,34 @@ void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const ui
   }
 }
 
+void SimdBp128Packing::scan_block(const uint128_t* in, uint64_t* out, const uint8_t bit_size, const uint32_t lower,
+                                  const uint32_t upper) {
+  DebugAssert(bit_size <= 32u, "Bit size must be in range [0, 32]");
+  DebugAssert(lower <= upper, "Lower bound of the range must not be greater than the upper bound");
+
+  out[0] = uint64_t{0u};
+  out[1] = uint64_t{0u};
+
+  // The bit size bounds all values in the block. This allows us to skip blocks without unpacking them if their values
+  // are either all outside of the range (this also includes blocks with a bit size of zero, which have no data) or
+  // all inside of it.
+  const auto max_value = static_cast<uint32_t>((uint64_t{1u} << bit_size) - 1u);
+  if (lower == upper || lower > max_value) {
+    return;
+  }
+
+  if (lower == 0u && upper > max_value) {
+    out[0] = ~uint64_t{0u};
+    out[1] = ~uint64_t{0u};
+    return;
+  }
+
+  const auto simd_in = reinterpret_cast<const simd_type*>(in);
+  const auto range_size = upper - lower;
+  const simd_type lower_reg = {lower, lower, lower, lower};
+  const simd_type range_size_reg = {range_size, range_size, range_size, range_size};
+
+  SCAN_BLOCK_FUNCTIONS[bit_size - 1u](simd_in, lower_reg, range_size_reg, out);
+}
+
 }  // namespace opossum
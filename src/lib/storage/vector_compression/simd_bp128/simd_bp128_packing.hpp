@@ -26,6 +26,16 @@ class SimdBp128Packing {
 
   static void pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size);
   static void unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size);
+
+  /**
+   * @brief Finds the values of a packed block that lie within [lower, upper)
+   *
+   * Sets bit i of out[0] (i < 64) or out[1] (i >= 64) iff the i-th value of the block lies within the range. The
+   * values are compared in the SIMD registers they are extracted to and are never written back as 32-bit integers.
+   * Blocks whose bit size excludes all or no values from the range are not touched at all.
+   */
+  static void scan_block(const uint128_t* in, uint64_t* out, const uint8_t bit_size, const uint32_t lower,
+                         const uint32_t upper);
 };
 
 }  // namespace opossum
@@ -32,14 +32,14 @@ void ChunkCompressionTask::_on_execute() {
     // TODO(anyone): It is unclear if this restriction is really necessary. If it becomes a problem and we decide to
     // get rid of it, we should make sure that a new mutable chunk is created first so that inserts do not end up in
     // the chunk being compressed.
-    DebugAssert(_chunk_is_completed(chunk, table->target_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->target_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    ChunkEncoder::encode_appended_chunk(table, chunk_id);
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
   if (chunk->size() != target_chunk_size) return false;
 
   const auto& mvcc_data = chunk->mvcc_data();
@@ -156,6 +156,16 @@ enum class SchedulePriority {
   High = 0      // Schedule task at the beginning of the queue
 };
 
+// Tasks of concurrently executed queries compete for the same workers. The scheduling class of a query determines the
+// share of the workers its tasks receive (see TaskQueue for the weights). Independent of their class, tasks of
+// different task groups (usually one group per SQL statement) are executed round-robin.
+enum class SchedulingClass : uint8_t { Interactive = 0, Default = 1, Background = 2 };
+
+using TaskGroupID = uint32_t;
+
+// Tasks that are not part of a query (e.g., in tests or background jobs) use this group.
+constexpr TaskGroupID DEFAULT_TASK_GROUP_ID{0};
+
 enum class PredicateCondition {
   Equals,
   NotEquals,
@@ -216,6 +226,8 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 
+enum class UseMorselPipelines : bool { Yes = true, No = false };
+
 enum class MemoryUsageCalculationMode { Sampled, Full };
 
 enum class EraseReferencedSegmentType : bool { Yes = true, No = false };
@@ -8,6 +8,7 @@
 #include "operators/limit.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_n.hpp"
 #include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "visualization/abstract_visualizer.hpp"
@@ -111,6 +112,11 @@ void PQPVisualizer::_build_subtree(const std::shared_ptr<const AbstractOperator>
       _visualize_subqueries(op, limit->row_count_expression(), visualized_ops);
     } break;
 
+    case OperatorType::TopN: {
+      const auto top_n = std::dynamic_pointer_cast<const TopN>(op);
+      _visualize_subqueries(op, top_n->row_count_expression(), visualized_ops);
+    } break;
+
     default: {
     }  // OperatorType has no expressions
   }
@@ -0,0 +1,103 @@
+#include "chunk_maintenance_plugin.hpp"
+
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void create_index(Chunk& chunk, const IndexStatistics& index_statistics) {
+  switch (index_statistics.type) {
+    case SegmentIndexType::GroupKey:
+      chunk.create_index<GroupKeyIndex>(index_statistics.column_ids);
+      return;
+    case SegmentIndexType::CompositeGroupKey:
+      chunk.create_index<CompositeGroupKeyIndex>(index_statistics.column_ids);
+      return;
+    case SegmentIndexType::AdaptiveRadixTree:
+      chunk.create_index<AdaptiveRadixTreeIndex>(index_statistics.column_ids);
+      return;
+    case SegmentIndexType::BTree:
+      chunk.create_index<BTreeIndex>(index_statistics.column_ids);
+      return;
+    case SegmentIndexType::Invalid:
+      break;
+  }
+  Fail("Invalid index type");
+}
+
+}  // namespace
+
+namespace opossum {
+
+const std::string ChunkMaintenancePlugin::description() const { return "Chunk maintenance plugin"; }
+
+void ChunkMaintenancePlugin::start() {
+  _loop_thread_maintenance =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_MAINTENANCE, [&](size_t) { _maintain_chunks(); });
+}
+
+void ChunkMaintenancePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread_maintenance.reset();
+}
+
+size_t ChunkMaintenancePlugin::_maintain_chunks() {
+  auto maintained_chunk_count = size_t{0};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    // Only the Insert operator leaves full chunks behind, and it requires MVCC
+    if (table->uses_mvcc() != UseMvcc::Yes) continue;
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      if (!chunk || !chunk->is_mutable()) continue;
+      if (!ChunkCompressionTask::chunk_is_completed(chunk, table->target_chunk_size())) continue;
+
+      if (!_maintain_chunk(table, chunk_id)) continue;
+
+      ++maintained_chunk_count;
+      if (maintained_chunk_count == MAX_CHUNKS_PER_ITERATION) return maintained_chunk_count;
+    }
+  }
+
+  return maintained_chunk_count;
+}
+
+bool ChunkMaintenancePlugin::_maintain_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
+  const auto chunk = table->get_chunk(chunk_id);
+
+  {
+    // The Insert operator checks whether the last chunk is mutable while holding the append mutex. The check in
+    // _maintain_chunks() was done without it, so that the chunk might have been finalized in the meantime.
+    const auto append_lock = table->acquire_append_mutex();
+    if (!chunk->is_mutable()) return false;
+    chunk->finalize();
+  }
+
+  // Encoded directly (as the ChunkCompressionTask would) so that the plugin does not occupy the scheduler's workers
+  ChunkEncoder::encode_appended_chunk(table, chunk_id);
+  DebugAssert(chunk->pruning_statistics(), "ChunkEncoder should have generated the pruning statistics");
+
+  for (const auto& index_statistics : table->indexes_statistics()) {
+    if (chunk->get_index(index_statistics.type, index_statistics.column_ids)) continue;
+    create_index(*chunk, index_statistics);
+  }
+
+  return true;
+}
+
+EXPORT_PLUGIN(ChunkMaintenancePlugin)
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+/*
+ * Inserts append to the unencoded ValueSegments of the last chunk of a table. Once this chunk is full, the Insert
+ * operator appends a new one, but nobody takes care of the full chunk: It stays mutable, unencoded, without pruning
+ * statistics, and without the table's indexes, so that the table scans of long-running insert workloads (e.g.,
+ * TPC-C) get slower and slower. This plugin periodically looks for such chunks and, once all inserts into them have
+ * committed or rolled back (see ChunkCompressionTask::chunk_is_completed), finalizes them (which also determines
+ * MvccData::max_begin_cid), compresses them like the ChunkCompressionTask does (which also generates the pruning
+ * statistics), and creates the indexes that have been created for the entire table (see Table::create_index).
+ *
+ * Only chunks that are still mutable are maintained, so that the encodings of chunks that were loaded and finalized
+ * otherwise are left untouched. The work is done on the plugin's own thread instead of the scheduler's workers and
+ * limited to MAX_CHUNKS_PER_ITERATION per iteration so that queries are not slowed down.
+ */
+class ChunkMaintenancePlugin : public AbstractPlugin {
+  friend class ChunkMaintenancePluginTest;
+
+ public:
+  const std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * MAX_CHUNKS_PER_ITERATION: the number of chunks that are maintained before the plugin goes to sleep again
+   * IDLE_DELAY_MAINTENANCE: sleep after each iteration
+   */
+  constexpr static size_t MAX_CHUNKS_PER_ITERATION = 1;
+  constexpr static std::chrono::milliseconds IDLE_DELAY_MAINTENANCE = std::chrono::milliseconds(100);
+
+ private:
+  // Returns the number of maintained chunks
+  static size_t _maintain_chunks();
+
+  // Returns false if the chunk was finalized by someone else in the meantime and thus left untouched
+  static bool _maintain_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_maintenance;
+};
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#include "encoding_advisor_plugin.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+EncodingAdvisorPlugin::MemoryBudgetSetting::MemoryBudgetSetting()
+    : AbstractSetting("EncodingAdvisorPlugin.memory_budget"), _value("auto") {}
+
+const std::string& EncodingAdvisorPlugin::MemoryBudgetSetting::description() const {
+  static const auto description = std::string{
+      "Memory budget in bytes for the segments of all immutable chunks, or 'auto' to keep their current memory usage"};
+  return description;
+}
+
+const std::string& EncodingAdvisorPlugin::MemoryBudgetSetting::get() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _value;
+}
+
+void EncodingAdvisorPlugin::MemoryBudgetSetting::set(const std::string& value) {
+  auto memory_budget = std::optional<size_t>{};
+  if (value != "auto") {
+    Assert(!value.empty() && std::all_of(value.cbegin(), value.cend(), [](const auto character) {
+             return std::isdigit(static_cast<unsigned char>(character));
+           }),
+           "Memory budget must be a number of bytes or 'auto'");
+    memory_budget = std::stoull(value);
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _value = value;
+  _memory_budget = memory_budget;
+}
+
+std::optional<size_t> EncodingAdvisorPlugin::MemoryBudgetSetting::memory_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_budget;
+}
+
+const std::string EncodingAdvisorPlugin::description() const { return "Encoding advisor plugin"; }
+
+void EncodingAdvisorPlugin::start() {
+  _memory_budget_setting = std::make_shared<MemoryBudgetSetting>();
+  _memory_budget_setting->register_at_settings_manager();
+
+  _loop_thread_reencoding =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_REENCODING, [&](size_t) { _reencode_tables(); });
+}
+
+void EncodingAdvisorPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread_reencoding.reset();
+
+  _memory_budget_setting->unregister_at_settings_manager();
+  _memory_budget_setting.reset();
+}
+
+size_t EncodingAdvisorPlugin::_reencode_tables() {
+  auto tables = std::vector<std::shared_ptr<Table>>{};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    tables.emplace_back(table);
+  }
+
+  const auto configured_memory_budget = _memory_budget_setting->memory_budget();
+  const auto memory_budget =
+      configured_memory_budget ? *configured_memory_budget : EncodingAdvisor::memory_usage(tables);
+  const auto recommendations = _advisor.recommend(tables, memory_budget);
+  return EncodingAdvisor::apply(recommendations);
+}
+
+EXPORT_PLUGIN(EncodingAdvisorPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "storage/encoding_advisor.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace opossum {
+
+/*
+ * Periodically re-encodes the segments of all immutable chunks according to the EncodingAdvisor, so that encodings
+ * do not have to be hand-tuned per column. Frequently accessed segments get encodings that are cheap to access while
+ * rarely accessed ones are compressed as far as possible. The memory budget for the segments of all immutable chunks
+ * is configured via the setting "EncodingAdvisorPlugin.memory_budget": either a number of bytes or "auto", which
+ * keeps the current memory usage of these segments.
+ */
+class EncodingAdvisorPlugin : public AbstractPlugin {
+  friend class EncodingAdvisorPluginTest;
+
+ public:
+  class MemoryBudgetSetting : public AbstractSetting {
+   public:
+    MemoryBudgetSetting();
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+    // Returns std::nullopt if the budget is "auto"
+    std::optional<size_t> memory_budget() const;
+
+   private:
+    mutable std::mutex _mutex;
+    std::string _value;
+    std::optional<size_t> _memory_budget;
+  };
+
+  const std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  // IDLE_DELAY_REENCODING: sleep after each pass over all tables
+  constexpr static std::chrono::milliseconds IDLE_DELAY_REENCODING = std::chrono::milliseconds(10'000);
+
+ private:
+  // Returns the number of re-encoded segments
+  size_t _reencode_tables();
+
+  const EncodingAdvisor _advisor;
+  std::shared_ptr<MemoryBudgetSetting> _memory_budget_setting;
+  std::unique_ptr<PausableLoopThread> _loop_thread_reencoding;
+};
+
+}  // namespace opossum
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -371,6 +374,24 @@ TEST_F(BinaryParserTest, InvalidAttributeVectorWidth) {
 
 TEST_F(BinaryParserTest, FileDoesNotExist) { EXPECT_THROW(BinaryParser::parse("not_existing_file"), std::exception); }
 
+TEST_F(BinaryParserTest, TruncatedFile) {
+  const auto filename = test_data_path + "truncated_file.bin";
+  std::filesystem::copy_file(_reference_filepath + "FixedStringDictionarySingleChunk.bin", filename,
+                             std::filesystem::copy_options::overwrite_existing);
+  std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 1);
+
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+  std::remove(filename.c_str());
+}
+
+TEST_F(BinaryParserTest, EmptyFile) {
+  const auto filename = test_data_path + "empty_file.bin";
+  std::ofstream{filename}.close();
+
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+  std::remove(filename.c_str());
+}
+
 TEST_F(BinaryParserTest, TwoColumnsNoValues) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("FirstColumn", DataType::Int, false);
@@ -7,6 +7,7 @@
 
 #include "base_test.hpp"
 
+#include "import_export/binary/binary_parser.hpp"
 #include "import_export/binary/binary_writer.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -214,6 +215,28 @@ TEST_F(BinaryWriterTest, AllNullFrameOfReferenceSegment) {
   EXPECT_TRUE(compare_files(reference_filename, filename));
 }
 
+TEST_F(BinaryWriterTest, FrameOfReferenceSegmentsOfAllNumericTypes) {
+  // The long column requires high offset values (see FrameOfReferenceSegment), which are written and parsed as well
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Long, true);
+  column_definitions.emplace_back("c", DataType::Float, false);
+  column_definitions.emplace_back("d", DataType::Double, true);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  table->append({1, std::numeric_limits<int64_t>::min(), -1.5f, 2.25});
+  table->append({2, opossum::NULL_VALUE, 0.0f, opossum::NULL_VALUE});
+  table->append({3, std::numeric_limits<int64_t>::max(), 4.75f, -1e100});
+  table->append({4, int64_t{17}, -3.0f, 42.0});
+
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, EncodingType::FrameOfReference);
+  BinaryWriter::write(*table, filename);
+
+  EXPECT_TRUE(file_exists(filename));
+  EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(filename), table);
+}
+
 TEST_F(BinaryWriterTest, LZ4MultipleBlocks) {
   // Export more rows than minimum block size of 16384
   TableColumnDefinitions column_definitions;
@@ -0,0 +1,199 @@
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "logging_test_utils.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "logging/checkpoint.hpp"
+#include "logging/log_records.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CheckpointTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+    const auto table = std::make_shared<Table>(_column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    table->append({1, "one"});
+    table->append({2, NULL_VALUE});
+    table->append({3, "three"});
+    table->append({4, "four"});
+    ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table("table_a", table);
+
+    std::filesystem::remove_all(_checkpoint_directory);
+    std::remove(_log_file_path.c_str());
+  }
+
+  void TearDown() override {
+    if (Hyrise::get().log_manager.is_enabled()) Hyrise::get().log_manager.disable();
+    std::filesystem::remove_all(_checkpoint_directory);
+    std::remove(_log_file_path.c_str());
+  }
+
+  void _delete_where_a_equals(const int32_t value) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::Equals, value);
+    const auto delete_op = std::make_shared<Delete>(table_scan);
+    get_table->execute();
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    table_scan->execute();
+    delete_op->set_transaction_context(transaction_context);
+    delete_op->execute();
+    transaction_context->commit();
+  }
+
+  std::shared_ptr<const Table> _visible_rows() {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    const auto validate = std::make_shared<Validate>(get_table);
+    get_table->execute();
+    validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context());
+    validate->execute();
+    return validate->get_output();
+  }
+
+  TableColumnDefinitions _column_definitions;
+  const std::string _checkpoint_directory = test_data_path + "checkpoint_test";
+  const std::string _log_file_path = test_data_path + "checkpoint_test.wal";
+};
+
+TEST_F(CheckpointTest, RecoverCheckpointAndLogTail) {
+  Hyrise::get().log_manager.enable(_log_file_path);
+  _delete_where_a_equals(2);
+
+  const auto snapshot_commit_id = Checkpoint::write(_checkpoint_directory);
+  EXPECT_EQ(snapshot_commit_id, Hyrise::get().transaction_manager.last_commit_id());
+
+  // Modifications after the checkpoint are recovered from the log tail
+  insert_rows("table_a", {{5, "five"}, {6, NULL_VALUE}, {7, "seven"}})->commit();
+  _delete_where_a_equals(3);
+  _delete_where_a_equals(5);
+
+  const auto expected_table = _visible_rows();
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+
+  Hyrise::get().log_manager.disable();
+  Hyrise::reset();
+
+  Checkpoint::recover(_checkpoint_directory, _log_file_path);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), last_commit_id);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_table);
+
+  // RowIDs are preserved and the encoded chunk is recovered without being re-encoded
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  ASSERT_EQ(table->chunk_count(), 3);
+  const auto encoded_chunk = table->get_chunk(ChunkID{0});
+  EXPECT_FALSE(encoded_chunk->is_mutable());
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(encoded_chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(encoded_chunk->pruning_statistics());
+  EXPECT_EQ(encoded_chunk->invalid_row_count(), 2);
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->is_mutable());
+
+  // The log tail modified the table, so that its statistics are rebuilt instead of using those of the checkpoint
+  ASSERT_TRUE(table->table_statistics());
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 7.0f);
+
+  // The recovered table accepts further modifications
+  insert_rows("table_a", {{8, "eight"}})->commit();
+  EXPECT_GT(Hyrise::get().transaction_manager.last_commit_id(), last_commit_id);
+  EXPECT_EQ(_visible_rows()->row_count(), expected_table->row_count() + 1);
+}
+
+TEST_F(CheckpointTest, TransactionsActiveDuringCheckpoint) {
+  Hyrise::get().log_manager.enable(_log_file_path);
+
+  // Rows of transactions that are active during the checkpoint are not part of it. They are only recovered if their
+  // transaction commits and is thus logged.
+  const auto committed_transaction_context = insert_rows("table_a", {{5, "five"}});
+  const auto rolled_back_transaction_context = insert_rows("table_a", {{6, "six"}});
+  Checkpoint::write(_checkpoint_directory);
+  committed_transaction_context->commit();
+  rolled_back_transaction_context->rollback();
+
+  const auto expected_table = _visible_rows();
+  EXPECT_EQ(expected_table->row_count(), 5);
+
+  Hyrise::get().log_manager.disable();
+  Hyrise::reset();
+
+  Checkpoint::recover(_checkpoint_directory, _log_file_path);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_table);
+}
+
+TEST_F(CheckpointTest, RecoverWithoutLog) {
+  insert_rows("table_a", {{5, "five"}})->commit();
+
+  // Make the persisted statistics distinguishable from rebuilt ones
+  Hyrise::get().storage_manager.get_table("table_a")->table_statistics()->row_count = 42.0f;
+
+  Checkpoint::write(_checkpoint_directory);
+  const auto expected_table = _visible_rows();
+
+  Hyrise::reset();
+
+  Checkpoint::recover(_checkpoint_directory);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_table);
+
+  // Without a log tail, the table statistics are those of the checkpoint instead of being rebuilt
+  const auto table_statistics = Hyrise::get().storage_manager.get_table("table_a")->table_statistics();
+  ASSERT_TRUE(table_statistics);
+  EXPECT_FLOAT_EQ(table_statistics->row_count, 42.0f);
+}
+
+TEST_F(CheckpointTest, LogIsTruncatedByCheckpoint) {
+  Hyrise::get().log_manager.enable(_log_file_path);
+  insert_rows("table_a", {{5, "five"}})->commit();
+  _delete_where_a_equals(1);
+  EXPECT_EQ(read_log_file(_log_file_path).size(), 2);
+
+  const auto snapshot_commit_id = Checkpoint::write(_checkpoint_directory);
+  EXPECT_TRUE(read_log_file(_log_file_path).empty());
+
+  // Entries of later commits are appended to the truncated log
+  insert_rows("table_a", {{6, "six"}})->commit();
+  const auto log = read_log_file(_log_file_path);
+  ASSERT_EQ(log.size(), 1);
+  EXPECT_GT(log[0].commit_id, snapshot_commit_id);
+
+  const auto expected_table = _visible_rows();
+  Hyrise::get().log_manager.disable();
+  Hyrise::reset();
+
+  Checkpoint::recover(_checkpoint_directory, _log_file_path);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), expected_table);
+}
+
+TEST_F(CheckpointTest, LogRecordsForTableCreatedAfterCheckpoint) {
+  Hyrise::get().log_manager.enable(_log_file_path);
+  Checkpoint::write(_checkpoint_directory);
+
+  // The creation of table_b is not logged, so that its rows cannot be recovered. Recovery fails instead of dropping
+  // them silently.
+  const auto table_b = std::make_shared<Table>(_column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("table_b", table_b);
+
+  insert_rows("table_b", {{1, "one"}})->commit();
+
+  Hyrise::get().log_manager.disable();
+  Hyrise::reset();
+
+  EXPECT_THROW(Checkpoint::recover(_checkpoint_directory, _log_file_path), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,200 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "logging_test_utils.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "logging/log_manager.hpp"
+#include "logging/log_records.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class LogManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+
+    std::remove(_log_file_path.c_str());
+  }
+
+  void TearDown() override {
+    if (Hyrise::get().log_manager.is_enabled()) Hyrise::get().log_manager.disable();
+    std::remove(_log_file_path.c_str());
+  }
+
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _table;
+  const std::string _log_file_path = test_data_path + "log_manager_test.wal";
+};
+
+TEST_F(LogManagerTest, DisabledByDefault) {
+  EXPECT_FALSE(Hyrise::get().log_manager.is_enabled());
+
+  insert_rows("table_a", {{1, "one"}})->commit();
+  EXPECT_FALSE(std::ifstream{_log_file_path}.is_open());
+}
+
+TEST_F(LogManagerTest, LogInsertAndDelete) {
+  Hyrise::get().log_manager.enable(_log_file_path);
+
+  insert_rows("table_a", {{1, "one"}, {2, NULL_VALUE}, {3, "three"}})->commit();
+
+  // Delete all rows in a second transaction
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto delete_op = std::make_shared<Delete>(validate);
+  get_table->execute();
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+  transaction_context->commit();
+
+  // Read-only transactions are not logged
+  Hyrise::get().transaction_manager.new_transaction_context()->commit();
+
+  Hyrise::get().log_manager.disable();
+
+  const auto entries = read_log_file(_log_file_path);
+  ASSERT_EQ(entries.size(), 2u);
+
+  // The insert spans two chunks
+  const auto& insert_entry = entries[0];
+  EXPECT_EQ(insert_entry.commit_id, transaction_context->commit_id() - 1);
+  EXPECT_TRUE(insert_entry.delete_records.empty());
+  ASSERT_EQ(insert_entry.insert_records.size(), 2u);
+  EXPECT_EQ(insert_entry.insert_records[0].table_name, "table_a");
+  EXPECT_EQ(insert_entry.insert_records[0].chunk_id, ChunkID{0});
+  EXPECT_EQ(insert_entry.insert_records[0].begin_chunk_offset, ChunkOffset{0});
+  EXPECT_EQ(insert_entry.insert_records[0].rows,
+            (std::vector<std::vector<AllTypeVariant>>{{1, pmr_string{"one"}}, {2, NULL_VALUE}}));
+  EXPECT_EQ(insert_entry.insert_records[1].chunk_id, ChunkID{1});
+  EXPECT_EQ(insert_entry.insert_records[1].rows, (std::vector<std::vector<AllTypeVariant>>{{3, pmr_string{"three"}}}));
+
+  const auto& delete_entry = entries[1];
+  EXPECT_EQ(delete_entry.commit_id, transaction_context->commit_id());
+  EXPECT_TRUE(delete_entry.insert_records.empty());
+  auto deleted_row_ids = std::vector<RowID>{};
+  for (const auto& record : delete_entry.delete_records) {
+    EXPECT_EQ(record.table_name, "table_a");
+    deleted_row_ids.insert(deleted_row_ids.end(), record.row_ids.begin(), record.row_ids.end());
+  }
+  EXPECT_EQ(deleted_row_ids, (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}},
+                                                 RowID{ChunkID{1}, ChunkOffset{0}}}));
+}
+
+TEST_F(LogManagerTest, DeleteFromTemporaryTableIsNotLogged) {
+  Hyrise::get().log_manager.enable(_log_file_path);
+
+  // Rows of tables that are not in the StorageManager cannot be recovered and are not logged
+  const auto temporary_table =
+      std::make_shared<Table>(_column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  temporary_table->append({1, "one"});
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto table_wrapper = std::make_shared<TableWrapper>(temporary_table);
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  const auto delete_op = std::make_shared<Delete>(validate);
+  table_wrapper->execute();
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+  transaction_context->commit();
+
+  Hyrise::get().log_manager.disable();
+
+  for (const auto& entry : read_log_file(_log_file_path)) {
+    EXPECT_TRUE(entry.delete_records.empty());
+  }
+}
+
+TEST_F(LogManagerTest, GroupCommit) {
+  // The logger waits for further transactions before writing the first one, so that all transactions that commit in
+  // the meantime share a single sync
+  Hyrise::get().log_manager.enable(_log_file_path, std::chrono::milliseconds{200});
+
+  constexpr auto TRANSACTION_COUNT = size_t{10};
+  auto committed_count = std::atomic<size_t>{0};
+  auto transaction_contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+
+  for (auto transaction_index = size_t{0}; transaction_index < TRANSACTION_COUNT; ++transaction_index) {
+    const auto transaction_context = insert_rows("table_a", {{static_cast<int32_t>(transaction_index), NULL_VALUE}});
+    transaction_context->commit_async([&](TransactionID) { ++committed_count; });
+    transaction_contexts.emplace_back(transaction_context);
+  }
+
+  while (committed_count < TRANSACTION_COUNT) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  }
+
+  auto& log_manager = Hyrise::get().log_manager;
+  EXPECT_EQ(log_manager.logged_transaction_count(), TRANSACTION_COUNT);
+  EXPECT_LT(log_manager.flush_count(), TRANSACTION_COUNT);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), transaction_contexts.back()->commit_id());
+
+  log_manager.disable();
+  EXPECT_EQ(read_log_file(_log_file_path).size(), TRANSACTION_COUNT);
+}
+
+TEST_F(LogManagerTest, FlushStatistics) {
+  Hyrise::get().log_manager.enable(_log_file_path);
+  for (auto transaction_index = 0; transaction_index < 3; ++transaction_index) {
+    insert_rows("table_a", {{transaction_index, NULL_VALUE}})->commit();
+  }
+
+  // Each commit waits for its entry to be synced, so that every transaction is written on its own
+  EXPECT_EQ(Hyrise::get().log_manager.logged_transaction_count(), 3u);
+  EXPECT_EQ(Hyrise::get().log_manager.flush_count(), 3u);
+}
+
+TEST_F(LogManagerTest, IncompleteEntryIsIgnored) {
+  auto log_writer = TransactionLogWriter{};
+  _table->append({1, "one"});
+  log_writer.add_insert("table_a", *_table, ChunkID{0}, ChunkOffset{0}, ChunkOffset{1});
+  const auto first_entry = log_writer.finish(CommitID{1});
+
+  log_writer.add_delete("table_a", RowIDPosList{RowID{ChunkID{0}, ChunkOffset{0}}});
+  const auto second_entry = log_writer.finish(CommitID{2});
+
+  // Simulate a crash while the second entry was written
+  {
+    auto file = std::ofstream{_log_file_path, std::ios::binary};
+    file.write(first_entry.data(), first_entry.size());
+    file.write(second_entry.data(), second_entry.size() - 1);
+  }
+
+  const auto entries = read_log_file(_log_file_path);
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_EQ(entries[0].commit_id, CommitID{1});
+  ASSERT_EQ(entries[0].insert_records.size(), 1u);
+  EXPECT_EQ(entries[0].insert_records[0].rows, (std::vector<std::vector<AllTypeVariant>>{{1, pmr_string{"one"}}}));
+
+  // An entry with a mismatching checksum is ignored as well
+  auto corrupted_entry = second_entry;
+  corrupted_entry.back() ^= 1;
+  {
+    auto file = std::ofstream{_log_file_path, std::ios::binary};
+    file.write(first_entry.data(), first_entry.size());
+    file.write(corrupted_entry.data(), corrupted_entry.size());
+  }
+  EXPECT_EQ(read_log_file(_log_file_path).size(), 1u);
+}
+
+}  // namespace opossum
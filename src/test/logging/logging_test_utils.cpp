@@ -0,0 +1,27 @@
+#include "logging_test_utils.hpp"
+
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::shared_ptr<TransactionContext> insert_rows(const std::string& table_name,
+                                                const std::vector<std::vector<AllTypeVariant>>& rows) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto values = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  for (const auto& row : rows) {
+    values->append(row);
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  return transaction_context;
+}
+
+}  // namespace opossum
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
+
+namespace opossum {
+
+// Inserts the rows into the stored table using an Insert operator and returns the (uncommitted) transaction context
+std::shared_ptr<TransactionContext> insert_rows(const std::string& table_name,
+                                                const std::vector<std::vector<AllTypeVariant>>& rows);
+
+}  // namespace opossum
@@ -30,6 +30,7 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/static_table_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "operators/aggregate_hash.hpp"
@@ -45,11 +46,13 @@
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
 #include "operators/maintenance/drop_table.hpp"
+#include "operators/morsel_pipeline.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -347,6 +350,35 @@ TEST_F(LQPTranslatorTest, Sort) {
   ASSERT_TRUE(get_table);
 }
 
+TEST_F(LQPTranslatorTest, TopN) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 10
+   */
+  const auto order_by_modes = std::vector<OrderByMode>({OrderByMode::Descending, OrderByMode::Ascending});
+  const auto lqp = TopNNode::make(expression_vector(int_float_b, int_float_a), order_by_modes,
+                                  value_(static_cast<int64_t>(10)), int_float_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto top_n = std::dynamic_pointer_cast<const TopN>(pqp);
+  ASSERT_TRUE(top_n);
+
+  ASSERT_EQ(top_n->sort_definitions().size(), 2u);
+  EXPECT_EQ(top_n->sort_definitions().at(0).column, ColumnID{1});
+  EXPECT_EQ(top_n->sort_definitions().at(0).order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(top_n->sort_definitions().at(1).column, ColumnID{0});
+  EXPECT_EQ(top_n->sort_definitions().at(1).order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(*top_n->row_count_expression(), *value_(static_cast<int64_t>(10)));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_n->input_left());
+  ASSERT_TRUE(get_table);
+}
+
 TEST_F(LQPTranslatorTest, LimitLiteral) {
   /**
    * Build LQP and translate to PQP
@@ -404,6 +436,88 @@ TEST_F(LQPTranslatorTest, PredicateNodeBetweenScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *between_inclusive_(a, 42, 1337));
 }
 
+TEST_F(LQPTranslatorTest, PredicateChainIsFusedIntoTableScan) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(less_than_(int_float_b, 500),
+    PredicateNode::make(between_inclusive_(int_float_a, 42, 1337),
+      PredicateNode::make(greater_than_(int_float_a, 5),
+        int_float_node)));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  // The conjuncts are ordered as the predicates are executed, i.e., from the bottom to the top of the chain
+  const auto table_scan = std::dynamic_pointer_cast<const TableScan>(pqp);
+  ASSERT_TRUE(table_scan);
+  EXPECT_EQ(table_scan->lqp_node, lqp);
+  EXPECT_EQ(table_scan->input_left()->type(), OperatorType::GetTable);
+
+  const auto a = PQPColumnExpression::from_table(*table_int_float, "a");
+  const auto b = PQPColumnExpression::from_table(*table_int_float, "b");
+  EXPECT_EQ(*table_scan->predicate(), *and_(and_(greater_than_(a, 5), between_inclusive_(a, 42, 1337)),
+                                            less_than_(b, 500)));
+}
+
+TEST_F(LQPTranslatorTest, PredicateChainIsNotFusedAcrossSharedPredicates) {
+  // The scan on a is consumed by two operators and has to be executed on its own, so that both can reuse its result
+  const auto shared_predicate_node = PredicateNode::make(greater_than_(int_float_a, 5), int_float_node);
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(UnionMode::All,
+    PredicateNode::make(less_than_(int_float_b, 500),
+      PredicateNode::make(equals_(int_float_a, 42),
+        shared_predicate_node)),
+    PredicateNode::make(equals_(int_float_b, 458.7f),
+      shared_predicate_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto a = PQPColumnExpression::from_table(*table_int_float, "a");
+  const auto b = PQPColumnExpression::from_table(*table_int_float, "b");
+
+  const auto left_scan = std::dynamic_pointer_cast<const TableScan>(pqp->input_left());
+  const auto right_scan = std::dynamic_pointer_cast<const TableScan>(pqp->input_right());
+  ASSERT_TRUE(left_scan);
+  ASSERT_TRUE(right_scan);
+  EXPECT_EQ(*left_scan->predicate(), *and_(equals_(a, 42), less_than_(b, 500)));
+  EXPECT_EQ(*right_scan->predicate(), *equals_(b, 458.7f));
+
+  const auto shared_scan = std::dynamic_pointer_cast<const TableScan>(left_scan->input_left());
+  ASSERT_TRUE(shared_scan);
+  EXPECT_EQ(right_scan->input_left(), shared_scan);
+  EXPECT_EQ(*shared_scan->predicate(), *greater_than_(a, 5));
+}
+
+TEST_F(LQPTranslatorTest, PredicateChainIsNotFusedWithSubqueries) {
+  // Predicates with subqueries are evaluated for all rows of a chunk and thus stay on top of the other predicates
+  // clang-format off
+  const auto subquery =
+  ProjectionNode::make(expression_vector(add_(1, 2)),
+    DummyTableNode::make());
+
+  const auto lqp =
+  PredicateNode::make(greater_than_(int_float_a, lqp_subquery_(subquery)),
+    PredicateNode::make(less_than_(int_float_b, 500),
+      PredicateNode::make(greater_than_(int_float_a, 5),
+        int_float_node)));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto subquery_scan = std::dynamic_pointer_cast<const TableScan>(pqp);
+  ASSERT_TRUE(subquery_scan);
+
+  const auto fused_scan = std::dynamic_pointer_cast<const TableScan>(pqp->input_left());
+  ASSERT_TRUE(fused_scan);
+  const auto a = PQPColumnExpression::from_table(*table_int_float, "a");
+  const auto b = PQPColumnExpression::from_table(*table_int_float, "b");
+  EXPECT_EQ(*fused_scan->predicate(), *and_(greater_than_(a, 5), less_than_(b, 500)));
+  EXPECT_EQ(fused_scan->input_left()->type(), OperatorType::GetTable);
+}
+
 // Tests accessing the original LQP node after translation.
 TEST_F(LQPTranslatorTest, LqpNodeAccess) {
   auto predicate_node = PredicateNode::make(between_inclusive_(int_float_a, 42, 1337), int_float_node);
@@ -1010,4 +1124,68 @@ TEST_F(LQPTranslatorTest, ChangeMetaTable) {
   EXPECT_EQ(change_meta_table->input_right()->type(), OperatorType::TableWrapper);
 }
 
+TEST_F(LQPTranslatorTest, MorselPipelines) {
+  /**
+   * LQP resembles:
+   *   SELECT a + b FROM (SELECT * FROM int_float WHERE a > 5 AND b < 500) ORDER BY a + b;
+   */
+  const auto a_plus_b = add_(int_float_a, int_float_b);
+
+  // clang-format off
+  const auto lqp =
+  SortNode::make(expression_vector(a_plus_b), std::vector<OrderByMode>{OrderByMode::Ascending},
+    ProjectionNode::make(expression_vector(a_plus_b),
+      PredicateNode::make(less_than_(int_float_b, 500),
+        PredicateNode::make(greater_than_(int_float_a, 5),
+          int_float_node))));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{UseMorselPipelines::Yes}.translate_node(lqp);
+
+  // The TableScan (into which both predicates are fused) and the Projection form a single pipeline below the Sort,
+  // which is a pipeline breaker
+  ASSERT_EQ(pqp->type(), OperatorType::Sort);
+  const auto pipeline = std::dynamic_pointer_cast<const MorselPipeline>(pqp->input_left());
+  ASSERT_TRUE(pipeline);
+  EXPECT_EQ(pipeline->lqp_node, lqp->left_input());
+  ASSERT_EQ(pipeline->input_left()->type(), OperatorType::GetTable);
+
+  ASSERT_EQ(pipeline->stages.size(), 2u);
+  EXPECT_EQ(pipeline->stages[0]->type(), OperatorType::TableScan);
+  EXPECT_EQ(pipeline->stages[1]->type(), OperatorType::Projection);
+  EXPECT_EQ(pipeline->stages[0]->input_left(), pipeline->input_left());
+  EXPECT_EQ(pipeline->stages[1]->input_left(), pipeline->stages[0]);
+
+  // Without UseMorselPipelines::Yes, no pipelines are created
+  EXPECT_EQ(LQPTranslator{}.translate_node(lqp)->input_left()->type(), OperatorType::Projection);
+}
+
+TEST_F(LQPTranslatorTest, MorselPipelinesDoNotFuseSharedInputs) {
+  /**
+   * The scan on a is consumed by two operators and thus needs to be materialized. Only the operators above it can be
+   * fused with each other.
+   */
+  const auto shared_predicate_node = PredicateNode::make(greater_than_(int_float_a, 5), int_float_node);
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(UnionMode::All,
+    ProjectionNode::make(expression_vector(int_float_a, int_float_b),
+      PredicateNode::make(less_than_(int_float_b, 500),
+        shared_predicate_node)),
+    PredicateNode::make(equals_(int_float_b, 458.7f),
+      shared_predicate_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{UseMorselPipelines::Yes}.translate_node(lqp);
+
+  const auto left_pipeline = std::dynamic_pointer_cast<const MorselPipeline>(pqp->input_left());
+  ASSERT_TRUE(left_pipeline);
+  ASSERT_EQ(left_pipeline->stages.size(), 2u);
+  EXPECT_EQ(left_pipeline->input_left()->type(), OperatorType::TableScan);
+
+  EXPECT_EQ(pqp->input_right()->type(), OperatorType::TableScan);
+  EXPECT_EQ(pqp->input_right()->input_left(), left_pipeline->input_left());
+}
+
 }  // namespace opossum
@@ -0,0 +1,70 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TopNNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Float, "b"}});
+    _a = _mock_node->get_column("a");
+    _b = _mock_node->get_column("b");
+
+    _top_n_node = TopNNode::make(expression_vector(_a, _b),
+                                 std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::DescendingNullsLast},
+                                 value_(10), _mock_node);
+  }
+
+  std::shared_ptr<MockNode> _mock_node;
+  std::shared_ptr<TopNNode> _top_n_node;
+  LQPColumnReference _a, _b;
+};
+
+TEST_F(TopNNodeTest, Description) {
+  EXPECT_EQ(_top_n_node->description(), "[TopN] 10 rows by a (AscendingNullsFirst), b (DescendingNullsLast)");
+}
+
+TEST_F(TopNNodeTest, HashingAndEqualityCheck) {
+  const auto same_top_n_node = TopNNode::make(
+      expression_vector(_a, _b), std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::DescendingNullsLast},
+      value_(10), _mock_node);
+  const auto top_n_node_other_row_count = TopNNode::make(
+      expression_vector(_a, _b), std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::DescendingNullsLast},
+      value_(11), _mock_node);
+  const auto top_n_node_other_order_by_mode = TopNNode::make(
+      expression_vector(_a, _b), std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::Descending},
+      value_(10), _mock_node);
+  const auto top_n_node_other_expressions = TopNNode::make(
+      expression_vector(_b, _a), std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::DescendingNullsLast},
+      value_(10), _mock_node);
+
+  EXPECT_EQ(*_top_n_node, *_top_n_node);
+  EXPECT_EQ(*_top_n_node, *same_top_n_node);
+  EXPECT_NE(*_top_n_node, *top_n_node_other_row_count);
+  EXPECT_NE(*_top_n_node, *top_n_node_other_order_by_mode);
+  EXPECT_NE(*_top_n_node, *top_n_node_other_expressions);
+
+  EXPECT_EQ(_top_n_node->hash(), same_top_n_node->hash());
+  EXPECT_NE(_top_n_node->hash(), top_n_node_other_order_by_mode->hash());
+}
+
+TEST_F(TopNNodeTest, Copy) { EXPECT_EQ(*_top_n_node->deep_copy(), *_top_n_node); }
+
+TEST_F(TopNNodeTest, NodeExpressions) {
+  ASSERT_EQ(_top_n_node->node_expressions.size(), 3u);
+  EXPECT_EQ(*_top_n_node->node_expressions.at(0u), *lqp_column_(_a));
+  EXPECT_EQ(*_top_n_node->node_expressions.at(1u), *lqp_column_(_b));
+  EXPECT_EQ(*_top_n_node->num_rows_expression(), *value_(10));
+  EXPECT_EQ(_top_n_node->sort_expressions().size(), 2u);
+}
+
+}  // namespace opossum
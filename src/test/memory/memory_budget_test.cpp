@@ -0,0 +1,95 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "memory/memory_budget.hpp"
+
+namespace opossum {
+
+class MemoryBudgetTest : public BaseTest {};
+
+TEST_F(MemoryBudgetTest, ReserveAndRelease) {
+  auto budget = MemoryBudget{100};
+  EXPECT_EQ(budget.available_bytes(), 100);
+
+  EXPECT_TRUE(budget.try_reserve(60));
+  EXPECT_EQ(budget.reserved_bytes(), 60);
+  EXPECT_EQ(budget.available_bytes(), 40);
+
+  // A failed reservation does not reserve anything
+  EXPECT_FALSE(budget.try_reserve(41));
+  EXPECT_EQ(budget.reserved_bytes(), 60);
+
+  EXPECT_TRUE(budget.try_reserve(40));
+  EXPECT_EQ(budget.available_bytes(), 0);
+
+  budget.release(100);
+  EXPECT_EQ(budget.reserved_bytes(), 0);
+}
+
+TEST_F(MemoryBudgetTest, Unlimited) {
+  auto budget = MemoryBudget{};
+  EXPECT_EQ(budget.limit(), MemoryBudget::UNLIMITED);
+  EXPECT_TRUE(budget.try_reserve(size_t{1} << 50));
+  EXPECT_TRUE(budget.try_reserve(size_t{1} << 50));
+}
+
+TEST_F(MemoryBudgetTest, Hierarchy) {
+  const auto parent = std::make_shared<MemoryBudget>(100);
+  auto first_child = MemoryBudget{80, parent};
+  auto second_child = MemoryBudget{80, parent};
+
+  EXPECT_TRUE(first_child.try_reserve(60));
+  EXPECT_EQ(parent->reserved_bytes(), 60);
+
+  // The second child's own limit would allow the reservation, but the parent's does not
+  EXPECT_EQ(second_child.available_bytes(), 40);
+  EXPECT_FALSE(second_child.try_reserve(50));
+  EXPECT_EQ(second_child.reserved_bytes(), 0);
+  EXPECT_EQ(parent->reserved_bytes(), 60);
+
+  EXPECT_TRUE(second_child.try_reserve(40));
+  EXPECT_EQ(parent->reserved_bytes(), 100);
+
+  first_child.release(60);
+  EXPECT_EQ(parent->reserved_bytes(), 40);
+
+  // The child's own limit still applies
+  EXPECT_FALSE(second_child.try_reserve(41));
+}
+
+TEST_F(MemoryBudgetTest, SetLimit) {
+  auto budget = MemoryBudget{100};
+  EXPECT_TRUE(budget.try_reserve(80));
+
+  budget.set_limit(50);
+  EXPECT_EQ(budget.available_bytes(), 0);
+  EXPECT_FALSE(budget.try_reserve(1));
+
+  budget.release(80);
+  EXPECT_TRUE(budget.try_reserve(50));
+}
+
+TEST_F(MemoryBudgetTest, Reservation) {
+  const auto budget = std::make_shared<MemoryBudget>(100);
+
+  {
+    const auto reservation = MemoryReservation::try_reserve(budget, 70);
+    EXPECT_TRUE(reservation.is_granted());
+    EXPECT_EQ(reservation.bytes(), 70);
+    EXPECT_EQ(budget->reserved_bytes(), 70);
+
+    const auto failed_reservation = MemoryReservation::try_reserve(budget, 70);
+    EXPECT_FALSE(failed_reservation.is_granted());
+    EXPECT_EQ(failed_reservation.bytes(), 0);
+
+    auto moved_reservation = MemoryReservation{};
+    moved_reservation = MemoryReservation::try_reserve(budget, 30);
+    EXPECT_EQ(budget->reserved_bytes(), 100);
+  }
+
+  // Reservations are released when they go out of scope
+  EXPECT_EQ(budget->reserved_bytes(), 0);
+}
+
+}  // namespace opossum
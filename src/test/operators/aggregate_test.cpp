@@ -10,6 +10,7 @@
 #include "base_test.hpp"
 
 #include "expression/aggregate_expression.hpp"
+#include "memory/memory_budget.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
@@ -19,6 +20,7 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -607,6 +609,28 @@ TYPED_TEST(OperatorsAggregateTest, CanCountStringColumnsWithNull) {
                     "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/count_str_null.tbl", 1, false);
 }
 
+TYPED_TEST(OperatorsAggregateTest, GroupByStringColumnWithSharedDictionary) {
+  // AggregateHash uses the value IDs of the shared dictionary as group keys, both on the stored and on the referenced
+  // data (see test_output)
+  const auto table = load_table("resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/input.tbl", 2);
+  ChunkEncoder::encode_column_with_shared_dictionary(table, ColumnID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  this->test_output(table_wrapper, {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{0}},
+                    "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/count_str.tbl", 1);
+
+  const auto table_null =
+      load_table("resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/input_null.tbl", 2);
+  ChunkEncoder::encode_column_with_shared_dictionary(table_null, ColumnID{0},
+                                                     SegmentEncodingSpec{EncodingType::FixedStringDictionary});
+  const auto table_wrapper_null = std::make_shared<TableWrapper>(table_null);
+  table_wrapper_null->execute();
+
+  this->test_output(table_wrapper_null, {{ColumnID{1}, AggregateFunction::Count}}, {ColumnID{0}},
+                    "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/count_str_null.tbl", 1, false);
+}
+
 TYPED_TEST(OperatorsAggregateTest, SingleAggregateMaxWithNull) {
   this->test_output(this->_table_wrapper_1_1_null, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/max_null.tbl", 1, false);
@@ -887,4 +911,108 @@ TYPED_TEST(OperatorsAggregateTest, StringVariations) {
   EXPECT_EQ(values_sorted, result_values_sorted);
 }
 
+class OperatorsAggregateHashParallelTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 20 chunks of 1'000 rows, so that the input is large enough to be aggregated in parallel by AggregateHash. The
+    // column a has 997 distinct values (plus NULL), the column b has two.
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false},
+                               {"c", DataType::Int, true}, {"d", DataType::Double, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+    for (auto row_id = int32_t{0}; row_id < 20'000; ++row_id) {
+      const auto a = row_id % 101 == 0 ? NULL_VALUE : AllTypeVariant{row_id * 7 % 997};
+      const auto b = AllTypeVariant{pmr_string{row_id % 3 == 0 ? "short" : "a longer string"}};
+      const auto c = row_id % 13 == 0 ? NULL_VALUE : AllTypeVariant{row_id % 89};
+      const auto d = AllTypeVariant{(row_id % 113) * 0.5};
+      table->append({a, b, c, d});
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+
+    for (const auto function : {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Sum,
+                                AggregateFunction::Avg, AggregateFunction::Count, AggregateFunction::CountDistinct,
+                                AggregateFunction::StandardDeviationSample}) {
+      for (const auto column_id : {ColumnID{2}, ColumnID{3}}) {
+        _aggregates.emplace_back(std::make_shared<AggregateExpression>(
+            function, pqp_column_(column_id, table->column_data_type(column_id), table->column_is_nullable(column_id),
+                                  table->column_name(column_id))));
+      }
+    }
+    _aggregates.emplace_back(std::make_shared<AggregateExpression>(
+        AggregateFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")));
+  }
+
+  // Compares the result of the serial aggregation (as the ImmediateExecutionScheduler is used by default) to the
+  // result of the parallel aggregation using a multi-threaded scheduler.
+  void test_parallel_aggregation(const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                                 const std::vector<ColumnID>& groupby_column_ids) {
+    const auto serial_aggregate = std::make_shared<AggregateHash>(_table_wrapper, aggregates, groupby_column_ids);
+    serial_aggregate->execute();
+
+    Hyrise::get().topology.use_fake_numa_topology(8, 4);
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+    const auto parallel_aggregate = std::make_shared<AggregateHash>(_table_wrapper, aggregates, groupby_column_ids);
+    parallel_aggregate->execute();
+
+    Hyrise::get().scheduler()->finish();
+
+    EXPECT_TABLE_EQ_UNORDERED(parallel_aggregate->get_output(), serial_aggregate->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::vector<std::shared_ptr<AggregateExpression>> _aggregates;
+};
+
+TEST_F(OperatorsAggregateHashParallelTest, NoGroupBy) { test_parallel_aggregation(_aggregates, {}); }
+
+TEST_F(OperatorsAggregateHashParallelTest, SingleGroupByColumn) {
+  test_parallel_aggregation(_aggregates, {ColumnID{0}});
+}
+
+TEST_F(OperatorsAggregateHashParallelTest, TwoGroupByColumns) {
+  test_parallel_aggregation(_aggregates, {ColumnID{0}, ColumnID{1}});
+}
+
+TEST_F(OperatorsAggregateHashParallelTest, ThreeGroupByColumns) {
+  test_parallel_aggregation(_aggregates, {ColumnID{1}, ColumnID{0}, ColumnID{2}});
+}
+
+TEST_F(OperatorsAggregateHashParallelTest, Distinct) { test_parallel_aggregation({}, {ColumnID{0}, ColumnID{1}}); }
+
+TEST_F(OperatorsAggregateHashParallelTest, SpillingAggregation) {
+  // A scan that retains most rows, so that the spilled rows of the reference table have to be resolved
+  const auto scan = create_table_scan(_table_wrapper, ColumnID{3}, PredicateCondition::GreaterThan, 1.0);
+  scan->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{_table_wrapper, scan}) {
+    for (const auto& groupby_column_ids :
+         std::vector<std::vector<ColumnID>>{{ColumnID{0}}, {ColumnID{1}, ColumnID{0}}}) {
+      const auto in_memory_aggregate = std::make_shared<AggregateHash>(input, _aggregates, groupby_column_ids);
+      in_memory_aggregate->execute();
+
+      // The budget is far too small for the aggregation of all groups, so that the input rows are spilled
+      const auto spilling_aggregate = std::make_shared<AggregateHash>(input, _aggregates, groupby_column_ids);
+      const auto operator_budget = std::make_shared<MemoryBudget>(100'000, Hyrise::get().memory_budget);
+      spilling_aggregate->set_memory_budget(operator_budget);
+      spilling_aggregate->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(spilling_aggregate->get_output(), in_memory_aggregate->get_output());
+      EXPECT_EQ(operator_budget->reserved_bytes(), 0);
+    }
+  }
+
+  // DISTINCT is spilled as well
+  const auto no_aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  const auto in_memory_distinct = std::make_shared<AggregateHash>(_table_wrapper, no_aggregates, groupby_column_ids);
+  in_memory_distinct->execute();
+  const auto spilling_distinct = std::make_shared<AggregateHash>(_table_wrapper, no_aggregates, groupby_column_ids);
+  spilling_distinct->set_memory_budget(std::make_shared<MemoryBudget>(10'000));
+  spilling_distinct->execute();
+  EXPECT_TABLE_EQ_UNORDERED(spilling_distinct->get_output(), in_memory_distinct->get_output());
+}
+
 }  // namespace opossum
@@ -1,8 +1,12 @@
+#include <limits>
+#include <numeric>
+
 #include "../base_test.hpp"
 
 #include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 
 namespace opossum {
@@ -95,6 +99,51 @@ TEST_F(JoinHashStepsTest, LargeHashTableSinglePositions) {
   }
 }
 
+TEST_F(JoinHashStepsTest, TrackMatches) {
+  auto table = PosHashTable<int>{JoinHashBuildMode::AllPositions, 100};
+  for (auto i = 0; i < 100; ++i) {
+    table.emplace(i, RowID{ChunkID{0}, ChunkOffset{2} * i});
+    table.emplace(i, RowID{ChunkID{0}, ChunkOffset{2} * i + 1});
+  }
+  table.shrink_to_fit();
+  table.enable_match_tracking();
+
+  // Mark both rows of 5 and the second row of 70 as matched
+  table.mark_as_matched(table.find(5), 0);
+  table.mark_as_matched(table.find(5), 1);
+  table.mark_as_matched(table.find(70), 1);
+
+  auto unmatched_rows = std::vector<RowID>{};
+  table.for_each_unmatched_row([&](const RowID& row_id) { unmatched_rows.emplace_back(row_id); });
+  EXPECT_EQ(unmatched_rows.size(), 197);
+  EXPECT_EQ(std::count(unmatched_rows.begin(), unmatched_rows.end(), (RowID{ChunkID{0}, ChunkOffset{10}})), 0);
+  EXPECT_EQ(std::count(unmatched_rows.begin(), unmatched_rows.end(), (RowID{ChunkID{0}, ChunkOffset{140}})), 1);
+  EXPECT_EQ(std::count(unmatched_rows.begin(), unmatched_rows.end(), (RowID{ChunkID{0}, ChunkOffset{141}})), 0);
+}
+
+TEST_F(JoinHashStepsTest, WriteUnmatchedBuildRows) {
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized = materialize_input<int, int, true>(_table_int_with_nulls->get_output(), ColumnID{0},
+                                                              histograms, 0);
+  const auto hash_tables = build<int, int>(materialized, JoinHashBuildMode::AllPositions, 0, true);
+
+  // Without any matches, all rows (including those with NULL values) are written
+  auto pos_lists_build_side = std::vector<RowIDPosList>{};
+  auto pos_lists_probe_side = std::vector<RowIDPosList>{};
+  write_unmatched_build_rows(materialized, hash_tables, pos_lists_build_side, pos_lists_probe_side);
+
+  ASSERT_EQ(pos_lists_build_side.size(), materialized.size());
+  auto row_count = size_t{0};
+  for (auto partition_idx = size_t{0}; partition_idx < pos_lists_build_side.size(); ++partition_idx) {
+    ASSERT_EQ(pos_lists_build_side[partition_idx].size(), pos_lists_probe_side[partition_idx].size());
+    for (const auto& row_id : pos_lists_probe_side[partition_idx]) {
+      EXPECT_EQ(row_id, NULL_ROW_ID);
+    }
+    row_count += pos_lists_build_side[partition_idx].size();
+  }
+  EXPECT_EQ(row_count, _table_int_with_nulls->get_output()->row_count());
+}
+
 TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
   const size_t radix_bit_count = 0;
   std::vector<std::vector<size_t>> histograms;
@@ -205,6 +254,211 @@ TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
   EXPECT_EQ(empty_cluster_count, 2 * this->_table_size_zero_one / this->_chunk_size_zero_one);
 }
 
+TEST_F(JoinHashStepsTest, MaterializeCompositeKey) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Long, false}}, TableType::Data, 3);
+  table->append({1, int64_t{10}});
+  table->append({1, int64_t{20}});
+  table->append({NULL_VALUE, int64_t{10}});
+  table->append({2, int64_t{10}});
+
+  // Each key column is materialized as its hashed data type, i.e., the common type of both join columns
+  const auto key_columns = std::vector<JoinKeyColumn>{{ColumnID{0}, DataType::Int, DataType::Int},
+                                                      {ColumnID{1}, DataType::Long, DataType::Long}};
+  std::vector<std::vector<size_t>> histograms;
+
+  // Rows with a NULL in any key column are discarded
+  const auto materialized =
+      materialize_composite_key_input<CompositeJoinKey<2>, false>(table, key_columns, histograms, 1);
+  ASSERT_EQ(materialized.size(), 2);
+  ASSERT_EQ(materialized[0].elements.size(), 2);
+  ASSERT_EQ(materialized[1].elements.size(), 1);
+  EXPECT_EQ(materialized[1].elements[0].row_id, (RowID{ChunkID{1}, ChunkOffset{0}}));
+
+  const auto expected_key = CompositeJoinKey<2>{{normalize_composite_join_key_value(int32_t{1}),
+                                                 normalize_composite_join_key_value(int64_t{20})}};
+  EXPECT_EQ(materialized[0].elements[1].value, expected_key);
+  EXPECT_FALSE(materialized[0].elements[0].value == materialized[0].elements[1].value);
+
+  auto histogram_sum = size_t{0};
+  for (const auto& histogram : histograms) {
+    histogram_sum += std::accumulate(histogram.begin(), histogram.end(), size_t{0});
+  }
+  EXPECT_EQ(histogram_sum, 3);
+
+  // Otherwise, they are flagged as NULL
+  const auto materialized_with_nulls =
+      materialize_composite_key_input<CompositeJoinKey<2>, true>(table, key_columns, histograms, 0);
+  ASSERT_EQ(materialized_with_nulls[0].elements.size(), 3);
+  EXPECT_EQ(materialized_with_nulls[0].null_values, std::vector<bool>({false, false, true}));
+}
+
+TEST_F(JoinHashStepsTest, MaterializeCompositeKeyWithNaN) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Double, false}}, TableType::Data, 3);
+  table->append({1, 1.5});
+  table->append({1, std::numeric_limits<double>::quiet_NaN()});
+  table->append({2, -std::numeric_limits<double>::quiet_NaN()});
+
+  const auto key_columns = std::vector<JoinKeyColumn>{{ColumnID{0}, DataType::Int, DataType::Int},
+                                                      {ColumnID{1}, DataType::Double, DataType::Double}};
+  std::vector<std::vector<size_t>> histograms;
+
+  // NaN never equals another value, so that keys with a NaN are discarded like keys with a NULL. Otherwise, NaNs with
+  // the same bits would match.
+  const auto materialized =
+      materialize_composite_key_input<CompositeJoinKey<2>, false>(table, key_columns, histograms, 0);
+  ASSERT_EQ(materialized[0].elements.size(), 1);
+  EXPECT_EQ(materialized[0].elements[0].row_id, (RowID{ChunkID{0}, ChunkOffset{0}}));
+
+  const auto materialized_with_nulls =
+      materialize_composite_key_input<CompositeJoinKey<2>, true>(table, key_columns, histograms, 0);
+  ASSERT_EQ(materialized_with_nulls[0].elements.size(), 3);
+  EXPECT_EQ(materialized_with_nulls[0].null_values, std::vector<bool>({false, true, true}));
+}
+
+TEST_F(JoinHashStepsTest, NormalizeCompositeKeyValues) {
+  // Values that compare as equal have the same normalized value
+  EXPECT_EQ(normalize_composite_join_key_value(0.0), normalize_composite_join_key_value(-0.0));
+  EXPECT_EQ(normalize_composite_join_key_value(static_cast<int64_t>(int32_t{-7})),
+            normalize_composite_join_key_value(int64_t{-7}));
+  EXPECT_NE(normalize_composite_join_key_value(1.5f), normalize_composite_join_key_value(2.5f));
+}
+
+TEST_F(JoinHashStepsTest, RuntimeFilter) {
+  const std::hash<int64_t> hash_function;
+  auto runtime_filter = JoinHashRuntimeFilter<int64_t>{100};
+
+  // Nothing was inserted, so there is no join partner
+  EXPECT_FALSE(runtime_filter.may_contain(5, hash_function(5)));
+
+  for (auto value = int64_t{100}; value < 300; value += 2) {
+    runtime_filter.insert(hash_function(value));
+  }
+  runtime_filter.extend_range(100, 200);
+  runtime_filter.extend_range(150, 298);
+
+  // There are no false negatives
+  for (auto value = int64_t{100}; value < 300; value += 2) {
+    EXPECT_TRUE(runtime_filter.may_contain(value, hash_function(value)));
+  }
+
+  // Values outside of the range are always discarded, most others are discarded by the Bloom filter
+  EXPECT_FALSE(runtime_filter.may_contain(99, hash_function(99)));
+  EXPECT_FALSE(runtime_filter.may_contain(300, hash_function(300)));
+  auto false_positive_count = 0;
+  for (auto value = int64_t{101}; value < 300; value += 2) {
+    false_positive_count += runtime_filter.may_contain(value, hash_function(value));
+  }
+  EXPECT_LT(false_positive_count, 20);
+}
+
+TEST_F(JoinHashStepsTest, MaterializeWithRuntimeFilter) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 3);
+  for (const auto value : {1, 2, 3, 10, 11, 12, 4, 5, 6}) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  const auto build_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Long, false}}, TableType::Data, 2);
+  build_table->append({int64_t{2}});
+  build_table->append({int64_t{5}});
+
+  std::vector<std::vector<size_t>> histograms;
+  auto runtime_filter = JoinHashRuntimeFilter<int64_t>{build_table->row_count()};
+  materialize_input<int64_t, int64_t, false>(build_table, ColumnID{0}, histograms, 1, &runtime_filter);
+
+  // Until the filter is complete, the probe side is materialized without it
+  EXPECT_FALSE(runtime_filter.is_active());
+  const auto materialized_without_filter =
+      materialize_input<int32_t, int64_t, false>(table, ColumnID{0}, histograms, 1, nullptr, &runtime_filter);
+  EXPECT_EQ(materialized_without_filter[1].elements.size(), 3);
+  runtime_filter.mark_complete();
+  ASSERT_TRUE(runtime_filter.is_active());
+
+  // The chunk with the values 10 to 12 is pruned based on its statistics, the other chunks only keep their matching
+  // values (unless the Bloom filter reports a false positive)
+  EXPECT_FALSE(runtime_filter.may_contain_chunk<int32_t>(*table->get_chunk(ChunkID{1}), ColumnID{0}));
+  const auto materialized =
+      materialize_input<int32_t, int64_t, false>(table, ColumnID{0}, histograms, 1, nullptr, &runtime_filter);
+  ASSERT_EQ(materialized.size(), 3);
+  EXPECT_GE(materialized[0].elements.size(), 1);
+  EXPECT_LE(materialized[0].elements.size(), 2);
+  EXPECT_EQ(materialized[1].elements.size(), 0);
+  EXPECT_GE(materialized[2].elements.size(), 1);
+  EXPECT_LE(materialized[2].elements.size(), 2);
+  EXPECT_EQ(materialized[0].elements[0].value, 2);
+  EXPECT_EQ(materialized[2].elements[materialized[2].elements.size() - 1].value, 5);
+
+  // Histograms are written for pruned chunks as well
+  ASSERT_EQ(histograms.size(), 3);
+  EXPECT_EQ(histograms[1], std::vector<size_t>(2));
+}
+
+TEST_F(JoinHashStepsTest, RuntimeFilterSwitchesOffIfNotSelective) {
+  auto runtime_filter = JoinHashRuntimeFilter<int32_t>{100};
+  runtime_filter.mark_complete();
+
+  // A few probed rows are not enough to judge the filter
+  runtime_filter.record_probed_rows(1'000, 1'000);
+  EXPECT_TRUE(runtime_filter.is_active());
+
+  // The filter stays active as long as it discards enough rows...
+  runtime_filter.record_probed_rows(20'000, 1'000);
+  EXPECT_TRUE(runtime_filter.is_active());
+
+  // ...and is switched off once most of the probed rows pass it
+  runtime_filter.record_probed_rows(100'000, 99'000);
+  EXPECT_FALSE(runtime_filter.is_active());
+}
+
+TEST_F(JoinHashStepsTest, SpilledPartitionsRoundTrip) {
+  const auto radix_bits = size_t{2};
+  auto spilled_partitions = SpilledPartitions<pmr_string>{size_t{1} << radix_bits};
+
+  auto first_chunk = Partition<pmr_string>();
+  first_chunk.elements = {{RowID{ChunkID{0}, ChunkOffset{0}}, "apple"},
+                          {RowID{ChunkID{0}, ChunkOffset{1}}, ""},
+                          {RowID{ChunkID{0}, ChunkOffset{2}}, "a rather long string that does not fit into SSO"}};
+  first_chunk.null_values = {false, true, false};
+  spilled_partitions.append_by_radix<pmr_string>(first_chunk, radix_bits);
+
+  auto second_chunk = Partition<pmr_string>();
+  second_chunk.elements = {{RowID{ChunkID{1}, ChunkOffset{0}}, "apple"}, {RowID{ChunkID{1}, ChunkOffset{1}}, "pear"}};
+  spilled_partitions.append_by_radix<pmr_string>(second_chunk, radix_bits);
+
+  EXPECT_TRUE(spilled_partitions.has_null_values());
+
+  // Every element is read back from the partition that its radix belongs to, with its NULL flag
+  const auto hash_function = std::hash<pmr_string>{};
+  auto element_count = size_t{0};
+  auto found_null = false;
+  for (auto partition_idx = size_t{0}; partition_idx < spilled_partitions.partition_count(); ++partition_idx) {
+    const auto partition = spilled_partitions.read<true>(partition_idx);
+    EXPECT_EQ(partition.elements.size(), spilled_partitions.element_count(partition_idx));
+    ASSERT_EQ(partition.null_values.size(), partition.elements.size());
+
+    for (auto element_idx = size_t{0}; element_idx < partition.elements.size(); ++element_idx) {
+      const auto& element = partition.elements[element_idx];
+      EXPECT_EQ(hash_function(element.value) & ((size_t{1} << radix_bits) - 1), partition_idx);
+
+      const auto& input_chunk = element.row_id.chunk_id == ChunkID{0} ? first_chunk : second_chunk;
+      EXPECT_EQ(element.value, input_chunk.elements[element.row_id.chunk_offset].value);
+      const auto expected_null =
+          !input_chunk.null_values.empty() && input_chunk.null_values[element.row_id.chunk_offset];
+      EXPECT_EQ(partition.null_values[element_idx], expected_null);
+      found_null |= partition.null_values[element_idx];
+    }
+    element_count += partition.elements.size();
+
+    // Without keep_null_values, NULL flags are dropped
+    EXPECT_TRUE(spilled_partitions.read<false>(partition_idx).null_values.empty());
+  }
+  EXPECT_EQ(element_count, 5);
+  EXPECT_TRUE(found_null);
+}
+
 TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   const size_t radix_bit_count = 1;
   std::vector<std::vector<size_t>> histograms;
@@ -1,7 +1,10 @@
 #include "../base_test.hpp"
 
+#include "hyrise.hpp"
+#include "memory/memory_budget.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -108,6 +111,162 @@ TEST_F(OperatorsJoinHashTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->input_right(), nullptr);
 }
 
+TEST_F(OperatorsJoinHashTest, CompositeKey) {
+  // The equality predicates on a/c and b/d are resolved with a composite key, the one on e is evaluated after probing
+  const auto left_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}, {"e", DataType::String, false}},
+      TableType::Data, 2);
+  left_table->append({1, 1, "x"});
+  left_table->append({1, 2, "x"});
+  left_table->append({1, NULL_VALUE, "x"});
+  left_table->append({2, 1, "y"});
+  left_table->append({2, 2, "x"});
+
+  const auto right_table = std::make_shared<Table>(
+      TableColumnDefinitions{
+          {"c", DataType::Long, false}, {"d", DataType::Float, false}, {"f", DataType::String, false}},
+      TableType::Data, 2);
+  right_table->append({int64_t{1}, 2.0f, "x"});
+  right_table->append({int64_t{2}, 1.0f, "x"});
+  right_table->append({int64_t{2}, 2.0f, "x"});
+  right_table->append({int64_t{3}, 1.0f, "x"});
+
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  left_input->execute();
+  right_input->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals},
+                                         {{ColumnID{2}, ColumnID{2}}, PredicateCondition::Equals}};
+
+  const auto inner_join =
+      std::make_shared<JoinHash>(left_input, right_input, JoinMode::Inner, primary_predicate, secondary_predicates, 1);
+  inner_join->execute();
+
+  const auto output_column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false},  {"b", DataType::Int, true},    {"e", DataType::String, false},
+      {"c", DataType::Long, false}, {"d", DataType::Float, false}, {"f", DataType::String, false}};
+  const auto expected_inner = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  expected_inner->append({1, 2, "x", int64_t{1}, 2.0f, "x"});
+  expected_inner->append({2, 2, "x", int64_t{2}, 2.0f, "x"});
+  EXPECT_TABLE_EQ_UNORDERED(inner_join->get_output(), expected_inner);
+
+  // Rows with NULLs in a key column do not match, but are emitted by outer joins
+  const auto left_join =
+      std::make_shared<JoinHash>(left_input, right_input, JoinMode::Left, primary_predicate, secondary_predicates);
+  left_join->execute();
+
+  auto nullable_column_definitions = output_column_definitions;
+  for (auto column_id = size_t{3}; column_id < nullable_column_definitions.size(); ++column_id) {
+    nullable_column_definitions[column_id].nullable = true;
+  }
+  const auto expected_left = std::make_shared<Table>(nullable_column_definitions, TableType::Data);
+  expected_left->append({1, 1, "x", NULL_VALUE, NULL_VALUE, NULL_VALUE});
+  expected_left->append({1, 2, "x", int64_t{1}, 2.0f, "x"});
+  expected_left->append({1, NULL_VALUE, "x", NULL_VALUE, NULL_VALUE, NULL_VALUE});
+  expected_left->append({2, 1, "y", NULL_VALUE, NULL_VALUE, NULL_VALUE});
+  expected_left->append({2, 2, "x", int64_t{2}, 2.0f, "x"});
+  EXPECT_TABLE_EQ_UNORDERED(left_join->get_output(), expected_left);
+
+  const auto semi_join =
+      std::make_shared<JoinHash>(left_input, right_input, JoinMode::Semi, primary_predicate, secondary_predicates);
+  semi_join->execute();
+  EXPECT_EQ(semi_join->get_output()->row_count(), 2);
+}
+
+TEST_F(OperatorsJoinHashTest, SharedDictionaryKey) {
+  // If both string columns share a dictionary, the join compares their value IDs (see JoinKeyColumn::uses_value_ids).
+  // The results must not differ from those of a join on the strings.
+  const auto shared_table = load_table("resources/test_data/tbl/int_string_like.tbl", 2);
+  ChunkEncoder::encode_column_with_shared_dictionary(shared_table, ColumnID{1});
+  const auto shared_table_wrapper = std::make_shared<TableWrapper>(shared_table);
+  shared_table_wrapper->execute();
+  const auto shared_table_scan =
+      create_table_scan(shared_table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 1'000'000);
+  shared_table_scan->execute();
+
+  const auto table_wrapper =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_string_like.tbl", 2));
+  table_wrapper->execute();
+  const auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 1'000'000);
+  table_scan->execute();
+
+  const auto join_modes = {JoinMode::Inner, JoinMode::Left,           JoinMode::Right,          JoinMode::FullOuter,
+                           JoinMode::Semi,  JoinMode::AntiNullAsTrue, JoinMode::AntiNullAsFalse};
+
+  // The string predicate is the primary one or a secondary one next to an integer predicate
+  const auto string_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals};
+  const auto int_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto predicates = std::vector<std::pair<OperatorJoinPredicate, std::vector<OperatorJoinPredicate>>>{
+      {string_predicate, {}}, {int_predicate, {string_predicate}}};
+
+  for (const auto join_mode : join_modes) {
+    for (const auto& [primary_predicate, secondary_predicates] : predicates) {
+      if (join_mode == JoinMode::AntiNullAsTrue && !secondary_predicates.empty()) continue;
+      SCOPED_TRACE(join_mode_to_string.left.at(join_mode));
+
+      const auto shared_join = std::make_shared<JoinHash>(shared_table_scan, shared_table_wrapper, join_mode,
+                                                          primary_predicate, secondary_predicates);
+      shared_join->execute();
+
+      const auto join =
+          std::make_shared<JoinHash>(table_scan, table_wrapper, join_mode, primary_predicate, secondary_predicates);
+      join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(shared_join->get_output(), join->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, GraceHashJoin) {
+  // If the memory budget cannot hold the join's data structures, the inputs are spilled to disk in radix partitions
+  // that are joined one after another. The result must not differ from the in-memory join.
+  const auto join_modes = {JoinMode::Inner, JoinMode::Left,           JoinMode::Right,          JoinMode::FullOuter,
+                           JoinMode::Semi,  JoinMode::AntiNullAsTrue, JoinMode::AntiNullAsFalse};
+
+  // Each pair of inputs comes with a memory limit that is too small for its in-memory join
+  const auto inputs =
+      std::vector<std::tuple<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>, size_t>>{
+          {_table_tpch_orders, _table_tpch_lineitems, 16'000}, {_table_with_nulls, _table_wrapper_small, 100}};
+
+  for (const auto& [left_input, right_input, memory_limit] : inputs) {
+    for (const auto join_mode : join_modes) {
+      SCOPED_TRACE(join_mode_to_string.left.at(join_mode));
+      const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+      Hyrise::get().memory_budget->set_limit(MemoryBudget::UNLIMITED);
+      const auto in_memory_join = std::make_shared<JoinHash>(left_input, right_input, join_mode, primary_predicate);
+      in_memory_join->execute();
+
+      Hyrise::get().memory_budget->set_limit(memory_limit);
+      const auto grace_join = std::make_shared<JoinHash>(left_input, right_input, join_mode, primary_predicate);
+      grace_join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(grace_join->get_output(), in_memory_join->get_output());
+      EXPECT_EQ(Hyrise::get().memory_budget->reserved_bytes(), 0);
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, GraceHashJoinWithOperatorBudget) {
+  // An operator's own budget limits the join even if the global budget is unlimited
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto in_memory_join =
+      std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, JoinMode::Inner, primary_predicate);
+  in_memory_join->execute();
+
+  const auto grace_join =
+      std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, JoinMode::Inner, primary_predicate);
+  const auto operator_budget = std::make_shared<MemoryBudget>(16'000, Hyrise::get().memory_budget);
+  grace_join->set_memory_budget(operator_budget);
+  grace_join->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(grace_join->get_output(), in_memory_join->get_output());
+  EXPECT_EQ(operator_budget->reserved_bytes(), 0);
+}
+
 TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   // Simple cases: handle minimal inputs and very large inputs
   EXPECT_EQ(JoinHash::calculate_radix_bits<int>(1, 1), 0ul);
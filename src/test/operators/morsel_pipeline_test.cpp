@@ -0,0 +1,142 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/morsel_pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsMorselPipelineTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+    _table_wrapper->execute();
+
+    _a = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "a");
+    _b = PQPColumnExpression::from_table(*_table_wrapper->get_output(), "b");
+  }
+
+  // Builds TableScan(a > 200) -> Projection(b, a + 1) on top of the given input, as done by the LQPTranslator
+  std::vector<std::shared_ptr<AbstractOperator>> create_stages(const std::shared_ptr<AbstractOperator>& input) const {
+    const auto table_scan = std::make_shared<TableScan>(input, greater_than_(_a, 200));
+    const auto projection = std::make_shared<Projection>(table_scan, expression_vector(_b, add_(_a, 1)));
+    return {table_scan, projection};
+  }
+
+  std::shared_ptr<const Table> execute_unfused() const {
+    const auto stages = create_stages(_table_wrapper);
+    for (const auto& stage : stages) {
+      stage->execute();
+    }
+    return stages.back()->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _a, _b;
+};
+
+TEST_F(OperatorsMorselPipelineTest, OperatorName) {
+  const auto pipeline = std::make_shared<MorselPipeline>(_table_wrapper, create_stages(_table_wrapper));
+  EXPECT_EQ(pipeline->name(), "MorselPipeline");
+}
+
+TEST_F(OperatorsMorselPipelineTest, IsPipelineable) {
+  const auto stages = create_stages(_table_wrapper);
+  EXPECT_TRUE(MorselPipeline::is_pipelineable(*stages[0]));
+  EXPECT_TRUE(MorselPipeline::is_pipelineable(*stages[1]));
+
+  EXPECT_FALSE(MorselPipeline::is_pipelineable(*_table_wrapper));
+  const auto sort =
+      std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}});
+  EXPECT_FALSE(MorselPipeline::is_pipelineable(*sort));
+
+  const auto table_scan_with_excluded_chunks = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 200));
+  table_scan_with_excluded_chunks->excluded_chunk_ids = {ChunkID{0}};
+  EXPECT_FALSE(MorselPipeline::is_pipelineable(*table_scan_with_excluded_chunks));
+}
+
+TEST_F(OperatorsMorselPipelineTest, StagesMustBeChained) {
+  const auto stages = create_stages(_table_wrapper);
+  EXPECT_THROW(std::make_shared<MorselPipeline>(_table_wrapper, std::vector<std::shared_ptr<AbstractOperator>>{}),
+               std::logic_error);
+  EXPECT_THROW(std::make_shared<MorselPipeline>(_table_wrapper, std::vector{stages[1], stages[0]}), std::logic_error);
+}
+
+TEST_F(OperatorsMorselPipelineTest, SameResultAsUnfusedOperators) {
+  const auto pipeline = std::make_shared<MorselPipeline>(_table_wrapper, create_stages(_table_wrapper));
+  pipeline->execute();
+
+  const auto expected_output = execute_unfused();
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), expected_output);
+
+  // The output does not contain empty chunks, e.g., of morsels in which no row qualified
+  for (auto chunk_id = ChunkID{0}; chunk_id < pipeline->get_output()->chunk_count(); ++chunk_id) {
+    EXPECT_GT(pipeline->get_output()->get_chunk(chunk_id)->size(), 0u);
+  }
+}
+
+TEST_F(OperatorsMorselPipelineTest, ReferenceInput) {
+  const auto input_scan = std::make_shared<TableScan>(_table_wrapper, less_than_(_b, 800.0f));
+  input_scan->execute();
+
+  const auto pipeline = std::make_shared<MorselPipeline>(input_scan, create_stages(input_scan));
+  pipeline->execute();
+
+  const auto unfused_stages = create_stages(input_scan);
+  for (const auto& stage : unfused_stages) {
+    stage->execute();
+  }
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), unfused_stages.back()->get_output());
+}
+
+TEST_F(OperatorsMorselPipelineTest, EmptyInput) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(
+      std::make_shared<Table>(_table_wrapper->get_output()->column_definitions(), TableType::Data));
+  table_wrapper->execute();
+
+  const auto pipeline = std::make_shared<MorselPipeline>(table_wrapper, create_stages(table_wrapper));
+  pipeline->execute();
+
+  EXPECT_EQ(pipeline->get_output()->row_count(), 0u);
+  EXPECT_EQ(pipeline->get_output()->column_count(), 2u);
+  EXPECT_EQ(pipeline->get_output()->column_data_type(ColumnID{0}), DataType::Float);
+}
+
+TEST_F(OperatorsMorselPipelineTest, Multithreaded) {
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto pipeline = std::make_shared<MorselPipeline>(_table_wrapper, create_stages(_table_wrapper));
+  pipeline->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), execute_unfused());
+}
+
+TEST_F(OperatorsMorselPipelineTest, DeepCopy) {
+  const auto pipeline = std::make_shared<MorselPipeline>(_table_wrapper, create_stages(_table_wrapper));
+  const auto copy = std::dynamic_pointer_cast<MorselPipeline>(pipeline->deep_copy());
+  ASSERT_TRUE(copy);
+  ASSERT_EQ(copy->stages.size(), 2u);
+
+  // The copied stages are chained onto the copied input and do not share anything with the original stages
+  EXPECT_NE(copy->input_left(), pipeline->input_left());
+  EXPECT_EQ(copy->stages[0]->input_left(), copy->input_left());
+  EXPECT_EQ(copy->stages[1]->input_left(), copy->stages[0]);
+  EXPECT_NE(copy->stages[0], pipeline->stages[0]);
+
+  copy->mutable_input_left()->execute();
+  copy->execute();
+  EXPECT_TABLE_EQ_ORDERED(copy->get_output(), execute_unfused());
+}
+
+}  // namespace opossum
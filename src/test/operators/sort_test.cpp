@@ -11,6 +11,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -256,4 +257,87 @@ TEST_P(OperatorsSortTest, SortAfterOuterJoin) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, NormalizedKeysOfSpecialValues) {
+  // Negative numbers, zeros of both signs, and strings with embedded zero bytes, which are escaped in the sort key
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::String, true}, {"b", DataType::Double, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3});
+  table->append({pmr_string{"a\0b", 3}, 1.0});
+  table->append({pmr_string{"a"}, -0.0});
+  table->append({NULL_VALUE, -2.5});
+  table->append({pmr_string{"a\0", 2}, 0.0});
+  table->append({pmr_string{""}, -1e100});
+  table->append({pmr_string{"a"}, -1.0});
+  table->append({pmr_string{"a\x01"}, 2.0});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result->append({pmr_string{"a\x01"}, 2.0});
+  expected_result->append({pmr_string{"a\0b", 3}, 1.0});
+  expected_result->append({pmr_string{"a\0", 2}, 0.0});
+  expected_result->append({pmr_string{"a"}, -0.0});
+  expected_result->append({pmr_string{"a"}, -1.0});
+  expected_result->append({pmr_string{""}, -1e100});
+  expected_result->append({NULL_VALUE, -2.5});
+
+  // -0.0 and 0.0 are equal, so the first sort keeps their order and the second one is decisive
+  auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}};
+  auto sort_b = std::make_shared<Sort>(table_wrapper, sort_definitions);
+  sort_b->execute();
+
+  sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::DescendingNullsLast}};
+  auto sort_a = std::make_shared<Sort>(sort_b, sort_definitions);
+  sort_a->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort_a->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortMultithreaded) {
+  // Large enough to be sorted in multiple runs that are merged afterwards
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true}, {"b", DataType::String, false}, {"c", DataType::Long, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+
+  auto rows = std::vector<std::tuple<std::optional<int32_t>, pmr_string, int64_t>>{};
+  for (auto row_index = int64_t{0}; row_index < 50'000; ++row_index) {
+    const auto a =
+        row_index % 17 == 0 ? std::nullopt : std::optional<int32_t>{static_cast<int32_t>(row_index % 23) - 11};
+    const auto b = pmr_string(static_cast<size_t>(row_index % 3), 'x');
+    rows.emplace_back(a, b, row_index);
+    table->append({a ? AllTypeVariant{*a} : NULL_VALUE, b, row_index});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // ORDER BY a DESC NULLS LAST, b ASC - c keeps the input order of rows that are equal in a and b
+  std::stable_sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) {
+    const auto& [lhs_a, lhs_b, lhs_c] = lhs;
+    const auto& [rhs_a, rhs_b, rhs_c] = rhs;
+    if (lhs_a != rhs_a) {
+      if (!lhs_a || !rhs_a) return static_cast<bool>(lhs_a);
+      return *lhs_a > *rhs_a;
+    }
+    return lhs_b < rhs_b;
+  });
+
+  const auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto& [a, b, c] : rows) {
+    expected_result->append({a ? AllTypeVariant{*a} : NULL_VALUE, b, c});
+  }
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::DescendingNullsLast},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}};
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions);
+  sort->execute();
+
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
 }  // namespace opossum
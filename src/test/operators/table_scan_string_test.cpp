@@ -156,6 +156,56 @@ TEST_P(OperatorsTableScanStringTest, ScanLikeStartingOnReferencedDictSegment) {
   EXPECT_TABLE_EQ_UNORDERED(scan2->get_output(), expected_result);
 }
 
+TEST_F(OperatorsTableScanStringTest, ScanLikeOnSharedDictionary) {
+  // The segments of all chunks share one dictionary, so that its entries are matched only once for all chunks
+  const auto table = load_table("resources/test_data/tbl/int_string_like.tbl", 2);
+  ChunkEncoder::encode_column_with_shared_dictionary(table, ColumnID{1});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto scan_starting = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::Like, "Dampf%");
+  scan_starting->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_starting->get_output(),
+                            load_table("resources/test_data/tbl/int_string_like_starting.tbl", 1));
+
+  const auto scan_ending = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::Like, "%gesellschaft");
+  scan_ending->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_ending->get_output(),
+                            load_table("resources/test_data/tbl/int_string_like_ending.tbl", 1));
+
+  // Also on referenced segments, where only some of the rows are passed to the scan
+  const auto scan_filter = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+  scan_filter->execute();
+  const auto scan_ending_referenced =
+      create_table_scan(scan_filter, ColumnID{1}, PredicateCondition::Like, "%gesellschaft");
+  scan_ending_referenced->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_ending_referenced->get_output(),
+                            load_table("resources/test_data/tbl/int_string_like_ending.tbl", 1));
+}
+
+TEST_F(OperatorsTableScanStringTest, ScanLikeStartingWithMaximumCharacters) {
+  // The value ID range of 'a\xFF%' ends before "b", as the trailing '\xFF' cannot be incremented
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::String, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  for (const auto& value : {"a", "a\xFF", "b", "a\xFF\xFF", "a\xFF" "b", "\xFF\xFF"}) {
+    table->append({pmr_string{value}});
+  }
+  table->append({NULL_VALUE});
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_matches = std::vector<std::pair<pmr_string, size_t>>{
+      {"a%", 4u}, {"a\xFF%", 3u}, {"a\xFF\xFF%", 1u}, {"\xFF%", 1u}, {"\xFF\xFF\xFF%", 0u}, {"c%", 0u}};
+  for (const auto& [pattern, match_count] : expected_matches) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::Like, pattern);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), match_count) << pattern;
+  }
+}
+
 // PredicateCondition::Like - Ending
 TEST_F(OperatorsTableScanStringTest, ScanLikeEnding) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_string_like_ending.tbl", 1);
@@ -10,6 +10,8 @@
 #include "base_test.hpp"
 
 #include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/limit.hpp"
 #include "operators/print.hpp"
@@ -20,6 +22,7 @@
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
+#include "operators/table_scan/conjunction_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -919,7 +922,7 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ConjunctionTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, 5.5f)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_b, 1e40)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, int64_t{3'000'000'000})}.create_impl().get()));  // NOLINT
@@ -929,6 +932,18 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(TableScan{get_int_float_with_null_op(), is_null_(column_an)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(TableScan{get_int_float_with_null_op(), is_not_null_(column_an)}.create_impl().get()));  // NOLINT
 
+  // Conjunctions get one Impl per conjunct, in the order in which they are written
+  {
+    const auto abstract_impl = TableScan{get_int_float_op(), and_(and_(greater_than_(column_a, 5), less_than_(column_b, 6)), or_(equals_(column_a, 1), equals_(column_a, 2)))}.create_impl();  // NOLINT
+    const auto impl = dynamic_cast<ConjunctionTableScanImpl*>(abstract_impl.get());
+    ASSERT_TRUE(impl);
+    ASSERT_EQ(impl->conjunct_impls.size(), 3u);
+    EXPECT_TRUE(dynamic_cast<ColumnVsValueTableScanImpl*>(impl->conjunct_impls[0].get()));
+    EXPECT_TRUE(dynamic_cast<ColumnVsValueTableScanImpl*>(impl->conjunct_impls[1].get()));
+    EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(impl->conjunct_impls[2].get()));
+    EXPECT_EQ(impl->description(), "Conjunction(ColumnVsValue, ColumnVsValue, ExpressionEvaluator)");
+  }
+
   // Cases where the lossless_predicate_cast is used and the predicate condition gets adjusted:
   {
     const auto abstract_impl = TableScan{get_int_float_op(), greater_than_(column_b, 3.1)}.create_impl();
@@ -1072,4 +1087,82 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ConjunctionScan) {
+  // A conjunction is evaluated by a single scan in which every conjunct only looks at the rows that passed the previous
+  // ones. Its result has to equal that of a chain of scans, no matter which Impls the conjuncts use.
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, 13);
+  for (auto i = 0; i < 1'000; ++i) {
+    if (i % 7 == 3) {
+      data_table->append({NullValue{}, i});
+    } else {
+      data_table->append({100'000 + i, i});
+    }
+  }
+  // The last chunk is not full and thus not encoded
+  const auto last_chunk_id = ChunkID{data_table->chunk_count() - 1};
+  for (auto chunk_id = ChunkID{0}; chunk_id < last_chunk_id; ++chunk_id) {
+    ChunkEncoder::encode_chunk(data_table->get_chunk(chunk_id), {DataType::Int, DataType::Int},
+                               {_encoding_type, _encoding_type});
+  }
+
+  const auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+
+  // Retains most rows, so that the conjunctions are also scanned on ReferenceSegments
+  const auto reference_table_scan = std::make_shared<TableScan>(data_table_wrapper, greater_than_(column_b, 10));
+  reference_table_scan->execute();
+
+  // The IsNull, ColumnVsColumn, and ExpressionEvaluator Impls scan the entire chunk and intersect their matches with
+  // the rows that passed the previous conjuncts
+  const auto conjuncts = std::vector<std::shared_ptr<AbstractExpression>>{
+      greater_than_equals_(column_a, 100'100), between_inclusive_(column_b, 50, 800), is_not_null_(column_a),
+      less_than_(column_b, column_a), equals_(mod_(column_b, 3), 0), less_than_(column_a, 100'500)};
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{data_table_wrapper, reference_table_scan}) {
+    auto chained_scan = std::shared_ptr<AbstractOperator>{input};
+    for (auto conjunct_count = size_t{1}; conjunct_count <= conjuncts.size(); ++conjunct_count) {
+      chained_scan = std::make_shared<TableScan>(chained_scan, conjuncts[conjunct_count - 1]);
+      chained_scan->execute();
+      if (conjunct_count == 1) continue;
+
+      const auto conjunction = inflate_logical_expressions(
+          std::vector<std::shared_ptr<AbstractExpression>>(conjuncts.cbegin(), conjuncts.cbegin() + conjunct_count),
+          LogicalOperator::And);
+      const auto fused_scan = std::make_shared<TableScan>(input, conjunction);
+      fused_scan->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(fused_scan->get_output(), chained_scan->get_output());
+    }
+    EXPECT_GT(chained_scan->get_output()->row_count(), 0);
+  }
+
+  // Conjunctions that no row satisfies stop once a chunk has no matches left
+  const auto empty_scan = std::make_shared<TableScan>(
+      data_table_wrapper, and_(less_than_(column_a, 0), equals_(mod_(column_b, 3), 0)));
+  empty_scan->execute();
+  EXPECT_EQ(empty_scan->get_output()->row_count(), 0);
+}
+
+TEST_P(OperatorsTableScanTest, ConjunctionScanOnWeirdPosList) {
+  // The input references multiple chunks per ReferenceSegment
+  const auto table_wrapper = get_table_op_filtered();
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+
+  const auto first_scan = std::make_shared<TableScan>(table_wrapper, less_than_equals_(column_a, 10));
+  first_scan->execute();
+  const auto second_scan = std::make_shared<TableScan>(first_scan, greater_than_(column_b, 102));
+  second_scan->execute();
+
+  const auto fused_scan = std::make_shared<TableScan>(
+      table_wrapper, and_(less_than_equals_(column_a, 10), greater_than_(column_b, 102)));
+  fused_scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(fused_scan->get_output(), second_scan->get_output());
+}
+
 }  // namespace opossum
@@ -0,0 +1,160 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopNTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, true}, {"b", DataType::String, false}, {"c", DataType::Long, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+
+    for (auto row_index = int64_t{0}; row_index < 1'000; ++row_index) {
+      const auto a = row_index % 17 == 0 ? NULL_VALUE : AllTypeVariant{static_cast<int32_t>(row_index * 7 % 23) - 11};
+      _table->append({a, pmr_string(static_cast<size_t>(row_index % 3), 'x'), row_index});
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // The result of TopN has to equal the one of a Sort followed by a Limit
+  void _expect_equals_sort_limit(const std::shared_ptr<const AbstractOperator>& input,
+                                 const std::vector<SortColumnDefinition>& sort_definitions, const int64_t row_count) {
+    const auto top_n = std::make_shared<TopN>(input, sort_definitions, value_(row_count));
+    top_n->execute();
+
+    const auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    const auto limit = std::make_shared<Limit>(sort, value_(row_count));
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_n->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopNTest, OperatorName) {
+  const auto top_n = std::make_shared<TopN>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(10));
+  EXPECT_EQ(top_n->name(), "TopN");
+}
+
+TEST_F(OperatorsTopNTest, SingleColumn) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::DescendingNullsLast}) {
+    _expect_equals_sort_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}, order_by_mode}}, 10);
+  }
+}
+
+TEST_F(OperatorsTopNTest, MultipleColumns) {
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::AscendingNullsLast},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}};
+
+  for (const auto row_count : {int64_t{1}, int64_t{150}, int64_t{999}}) {
+    _expect_equals_sort_limit(_table_wrapper, sort_definitions, row_count);
+  }
+}
+
+TEST_F(OperatorsTopNTest, EncodedInput) {
+  ChunkEncoder::encode_all_chunks(_table, EncodingType::Dictionary);
+
+  _expect_equals_sort_limit(_table_wrapper, {SortColumnDefinition{ColumnID{1}}, SortColumnDefinition{ColumnID{0}}},
+                            25);
+}
+
+TEST_F(OperatorsTopNTest, RowCountExceedsInput) {
+  _expect_equals_sort_limit(_table_wrapper, {SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}}, 5'000);
+}
+
+TEST_F(OperatorsTopNTest, ZeroRows) {
+  const auto top_n = std::make_shared<TopN>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(0));
+  top_n->execute();
+
+  EXPECT_EQ(top_n->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_n->get_output()->column_definitions(), _table->column_definitions());
+}
+
+TEST_F(OperatorsTopNTest, OutputIsOrdered) {
+  const auto top_n = std::make_shared<TopN>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}},
+      value_(10));
+  top_n->execute();
+
+  const auto& output = top_n->get_output();
+  ASSERT_EQ(output->chunk_count(), 1u);
+  const auto& ordered_by = output->get_chunk(ChunkID{0})->ordered_by();
+  ASSERT_TRUE(ordered_by);
+  EXPECT_EQ(ordered_by->first, ColumnID{2});
+  EXPECT_EQ(ordered_by->second, OrderByMode::Descending);
+}
+
+TEST_F(OperatorsTopNTest, OrderedChunksWithTies) {
+  // Chunks that are ordered by the first sort column are only considered up to the last row that ties with the n-th
+  // row. The second sort column decides about the order of the ties.
+  const auto sorted_input = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, ChunkOffset{100});
+  sorted_input->execute();
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{0}}, SortColumnDefinition{ColumnID{2}, OrderByMode::Descending}};
+  for (const auto row_count : {int64_t{1}, int64_t{60}, int64_t{100}}) {
+    _expect_equals_sort_limit(sorted_input, sort_definitions, row_count);
+  }
+}
+
+TEST_F(OperatorsTopNTest, OrderedChunksAreNotAccessedBehindPrefix) {
+  // TopN relies on the ordered_by flag of a chunk and only considers the first rows of an ordered chunk. To verify
+  // this, the chunk is flagged as ordered although its last row holds the smallest value.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  for (const auto value : {1, 2, 3, 0}) {
+    table->append({value});
+  }
+  table->get_chunk(ChunkID{0})->finalize();
+  table->get_chunk(ChunkID{0})->set_ordered_by({ColumnID{0}, OrderByMode::Ascending});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto top_n = std::make_shared<TopN>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(2));
+  top_n->execute();
+
+  const auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                      TableType::Data);
+  expected_table->append({1});
+  expected_table->append({2});
+  EXPECT_TABLE_EQ_ORDERED(top_n->get_output(), expected_table);
+}
+
+TEST_F(OperatorsTopNTest, Multithreaded) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  _expect_equals_sort_limit(_table_wrapper,
+                            {SortColumnDefinition{ColumnID{1}, OrderByMode::Descending},
+                             SortColumnDefinition{ColumnID{0}, OrderByMode::AscendingNullsLast}},
+                            42);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+}  // namespace opossum
@@ -0,0 +1,106 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/top_n_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/sort_limit_fusion_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SortLimitFusionRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    _rule = std::make_shared<SortLimitFusionRule>();
+
+    _node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    _a = _node->get_column("a");
+    _b = _node->get_column("b");
+  }
+
+  std::shared_ptr<MockNode> _node;
+  LQPColumnReference _a, _b;
+  std::shared_ptr<SortLimitFusionRule> _rule;
+};
+
+TEST_F(SortLimitFusionRuleTest, FuseSortAndLimit) {
+  const auto order_by_modes = std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::Descending};
+
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    SortNode::make(expression_vector(_a, _b), order_by_modes,
+      _node));
+
+  const auto expected_lqp =
+  TopNNode::make(expression_vector(_a, _b), order_by_modes, value_(10),
+    _node);
+  // clang-format on
+
+  const auto result_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(result_lqp, expected_lqp);
+}
+
+TEST_F(SortLimitFusionRuleTest, FuseThroughProjection) {
+  // ORDER BY on a column that is not selected, as translated by the SQLTranslator
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    ProjectionNode::make(expression_vector(_a),
+      SortNode::make(expression_vector(_b), std::vector<OrderByMode>{OrderByMode::Ascending},
+        _node)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(_a),
+    TopNNode::make(expression_vector(_b), std::vector<OrderByMode>{OrderByMode::Ascending}, value_(10),
+      _node));
+  // clang-format on
+
+  const auto result_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(result_lqp, expected_lqp);
+}
+
+TEST_F(SortLimitFusionRuleTest, NoSortBelowLimit) {
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    ProjectionNode::make(expression_vector(_a),
+      _node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto result_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(result_lqp, expected_lqp);
+}
+
+TEST_F(SortLimitFusionRuleTest, SortWithMultipleOutputs) {
+  // The sorted input is also consumed without the Limit, so the SortNode must not be replaced
+  const auto sort_node = SortNode::make(expression_vector(_a), std::vector<OrderByMode>{OrderByMode::Ascending}, _node);
+
+  // clang-format off
+  const auto input_lqp =
+  UnionNode::make(UnionMode::All,
+    LimitNode::make(value_(10),
+      sort_node),
+    sort_node);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto result_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(result_lqp, expected_lqp);
+}
+
+}  // namespace opossum
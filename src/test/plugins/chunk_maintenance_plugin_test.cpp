@@ -0,0 +1,136 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "../../plugins/chunk_maintenance_plugin.hpp"
+#include "../utils/plugin_test_utils.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class ChunkMaintenancePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    _table->create_index<GroupKeyIndex>({ColumnID{0}});
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  std::shared_ptr<TransactionContext> _insert_rows(const size_t row_count) {
+    const auto values = std::make_shared<Table>(_column_definitions, TableType::Data);
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      values->append({static_cast<int32_t>(row_id), pmr_string{"value"}});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    return transaction_context;
+  }
+
+  void _expect_chunk_maintained(const ChunkID chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->mvcc_data()->max_begin_cid);
+    EXPECT_TRUE(chunk->pruning_statistics());
+    EXPECT_TRUE(std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+  }
+
+  static size_t _maintain_chunks() { return ChunkMaintenancePlugin::_maintain_chunks(); }
+
+  static bool _maintain_chunk(const std::shared_ptr<Table>& table, const ChunkID chunk_id) {
+    return ChunkMaintenancePlugin::_maintain_chunk(table, chunk_id);
+  }
+
+  const std::string _table_name{"table"};
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkMaintenancePluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libChunkMaintenancePlugin"));
+  pm.unload_plugin("ChunkMaintenancePlugin");
+}
+
+TEST_F(ChunkMaintenancePluginTest, MaintainCompletedChunks) {
+  _insert_rows(7)->commit();
+  ASSERT_EQ(_table->chunk_count(), 3u);
+
+  // One chunk per iteration
+  EXPECT_EQ(_maintain_chunks(), 1u);
+  _expect_chunk_maintained(ChunkID{0});
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+
+  EXPECT_EQ(_maintain_chunks(), 1u);
+  _expect_chunk_maintained(ChunkID{1});
+
+  // The last chunk is not full yet
+  EXPECT_EQ(_maintain_chunks(), 0u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->pruning_statistics());
+
+  // New rows go to the last chunk and, once it is full, to a new chunk
+  _insert_rows(3)->commit();
+  EXPECT_EQ(_maintain_chunks(), 1u);
+  _expect_chunk_maintained(ChunkID{2});
+  EXPECT_EQ(_table->row_count(), 10u);
+}
+
+TEST_F(ChunkMaintenancePluginTest, WaitForPendingInserts) {
+  const auto transaction_context = _insert_rows(3);
+  EXPECT_EQ(_maintain_chunks(), 0u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_mutable());
+
+  transaction_context->commit();
+  EXPECT_EQ(_maintain_chunks(), 1u);
+  _expect_chunk_maintained(ChunkID{0});
+}
+
+TEST_F(ChunkMaintenancePluginTest, RolledBackInserts) {
+  _insert_rows(3)->rollback();
+  EXPECT_EQ(_maintain_chunks(), 1u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_mutable());
+}
+
+TEST_F(ChunkMaintenancePluginTest, SkipChunksFinalizedInTheMeantime) {
+  // Someone else finalizes the chunk after _maintain_chunks() found it mutable, but before it is maintained
+  _insert_rows(3)->commit();
+  _table->get_chunk(ChunkID{0})->finalize();
+
+  EXPECT_FALSE(_maintain_chunk(_table, ChunkID{0}));
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(ColumnID{0})));
+  EXPECT_FALSE(chunk->pruning_statistics());
+}
+
+TEST_F(ChunkMaintenancePluginTest, IgnoreTablesWithoutMvcc) {
+  const auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 3);
+  table->append_mutable_chunk();
+  for (auto row_id = int32_t{0}; row_id < 3; ++row_id) {
+    table->get_chunk(ChunkID{0})->append({row_id, pmr_string{"value"}});
+  }
+  Hyrise::get().storage_manager.add_table("table_without_mvcc", table);
+
+  EXPECT_EQ(_maintain_chunks(), 0u);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->is_mutable());
+}
+
+}  // namespace opossum
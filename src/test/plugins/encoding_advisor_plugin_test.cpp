@@ -0,0 +1,76 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "../../plugins/encoding_advisor_plugin.hpp"
+#include "../utils/plugin_test_utils.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto& table = load_table("resources/test_data/tbl/int3.tbl", 2, FinalizeLastChunk::No);
+    Hyrise::get().storage_manager.add_table("int3", table);
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  static size_t _reencode_tables(EncodingAdvisorPlugin& plugin) { return plugin._reencode_tables(); }
+
+  static void _set_memory_budget_setting(EncodingAdvisorPlugin& plugin) {
+    plugin._memory_budget_setting = std::make_shared<EncodingAdvisorPlugin::MemoryBudgetSetting>();
+  }
+};
+
+TEST_F(EncodingAdvisorPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libEncodingAdvisorPlugin"));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("EncodingAdvisorPlugin.memory_budget"));
+
+  pm.unload_plugin("EncodingAdvisorPlugin");
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("EncodingAdvisorPlugin.memory_budget"));
+}
+
+TEST_F(EncodingAdvisorPluginTest, MemoryBudgetSetting) {
+  auto setting = EncodingAdvisorPlugin::MemoryBudgetSetting{};
+  EXPECT_EQ(setting.get(), "auto");
+  EXPECT_FALSE(setting.memory_budget());
+
+  setting.set("1024");
+  EXPECT_EQ(setting.get(), "1024");
+  EXPECT_EQ(setting.memory_budget(), 1024u);
+
+  setting.set("auto");
+  EXPECT_FALSE(setting.memory_budget());
+
+  EXPECT_THROW(setting.set("1 GB"), std::logic_error);
+  EXPECT_THROW(setting.set(""), std::logic_error);
+  EXPECT_EQ(setting.get(), "auto");
+}
+
+TEST_F(EncodingAdvisorPluginTest, ReencodeTables) {
+  auto plugin = EncodingAdvisorPlugin{};
+  _set_memory_budget_setting(plugin);
+
+  // int3.tbl has three rows, so the first chunk is immutable and the second one is mutable. The values are not
+  // accessed, so the immutable segment is compressed as far as possible.
+  EXPECT_EQ(_reencode_tables(plugin), 1u);
+  const auto table = Hyrise::get().storage_manager.get_table("int3");
+  EXPECT_NE(get_segment_encoding_spec(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::Unencoded);
+  EXPECT_EQ(get_segment_encoding_spec(table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::Unencoded);
+
+  // The second pass keeps the encodings
+  EXPECT_EQ(_reencode_tables(plugin), 0u);
+}
+
+}  // namespace opossum
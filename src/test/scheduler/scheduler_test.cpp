@@ -1,4 +1,5 @@
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -13,6 +14,8 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -257,4 +260,306 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, BasicTestWithWorkStealingScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  std::atomic_uint counter{0};
+
+  increment_counter_in_subtasks(counter);
+
+  Hyrise::get().scheduler()->finish();
+
+  ASSERT_EQ(counter, 30u);
+}
+
+TEST_F(SchedulerTest, DependenciesWithWorkStealingScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  std::atomic_uint linear_counter{0};
+  std::atomic_uint multiple_counter{0};
+  std::atomic_uint diamond_counter{0};
+
+  stress_linear_dependencies(linear_counter);
+  stress_multiple_dependencies(multiple_counter);
+  stress_diamond_dependencies(diamond_counter);
+
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(linear_counter, 3u);
+  EXPECT_EQ(multiple_counter, 4u);
+  EXPECT_EQ(diamond_counter, 7u);
+}
+
+TEST_F(SchedulerTest, MultipleOperatorsWithWorkStealingScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  auto test_table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  Hyrise::get().storage_manager.add_table("table", test_table);
+
+  auto gt = std::make_shared<GetTable>("table");
+  auto a = PQPColumnExpression::from_table(*test_table, ColumnID{0});
+  auto ts = std::make_shared<TableScan>(gt, greater_than_equals_(a, 1234));
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(ts);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  Hyrise::get().scheduler()->finish();
+
+  auto expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 1);
+  EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
+}
+
+TEST_F(SchedulerTest, WorkStealingSchedulerDistributesJobs) {
+  // All jobs are spawned by a single task and thus end up in the deque of a single worker. Other workers have to steal
+  // them in order to finish.
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  std::atomic_uint counter{0};
+  auto task = std::make_shared<JobTask>([&counter]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_id = 0; job_id < 1000; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&counter]() { ++counter; }));
+      jobs.back()->schedule();
+    }
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+    EXPECT_EQ(counter, 1000u);
+  });
+
+  task->schedule();
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(counter, 1000u);
+}
+
+TEST_F(SchedulerTest, WorkStealingSchedulerNonStealableTasks) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 1);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  std::atomic_uint wrong_node_count{0};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 100; ++task_id) {
+    const auto node_id = NodeID{static_cast<NodeID::base_type>(task_id % 4)};
+    tasks.emplace_back(std::make_shared<JobTask>(
+        [&wrong_node_count, node_id]() {
+          if (Worker::get_this_thread_worker()->queue()->node_id() != node_id) ++wrong_node_count;
+        },
+        SchedulePriority::Default, false));
+    tasks.back()->schedule(node_id);
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(tasks);
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(wrong_node_count, 0u);
+}
+
+TEST_F(SchedulerTest, SingleWorkerGuaranteeProgressWithWorkStealingScheduler) {
+  Hyrise::get().topology.use_default_topology(1);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  auto task_done = false;
+  auto task = std::make_shared<JobTask>([&task_done]() {
+    auto subtask = std::make_shared<JobTask>([&task_done]() { task_done = true; });
+
+    subtask->schedule();
+    Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{subtask});
+  });
+
+  task->schedule();
+  Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(task_done);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SchedulerTest, TaskQueueSkipsAssignedTasks) {
+  auto queue = TaskQueue{NodeID{0}};
+
+  const auto assigned_task = std::make_shared<JobTask>([]() {});
+  const auto unassigned_task = std::make_shared<JobTask>([]() {});
+  queue.push(assigned_task, static_cast<uint32_t>(SchedulePriority::Default));
+  queue.push(unassigned_task, static_cast<uint32_t>(SchedulePriority::Default));
+
+  // Simulates a worker that executed the task while waiting for it.
+  EXPECT_TRUE(assigned_task->try_mark_as_assigned_to_worker());
+  EXPECT_FALSE(assigned_task->try_mark_as_assigned_to_worker());
+
+  EXPECT_EQ(queue.pull(), unassigned_task);
+  EXPECT_FALSE(unassigned_task->try_mark_as_assigned_to_worker());
+  EXPECT_EQ(queue.pull(), nullptr);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SchedulerTest, TaskQueueSharesWorkersBetweenSchedulingClasses) {
+  auto queue = TaskQueue{NodeID{0}};
+
+  for (auto task_id = 0; task_id < 20; ++task_id) {
+    for (const auto scheduling_class : {SchedulingClass::Background, SchedulingClass::Interactive}) {
+      const auto task = std::make_shared<JobTask>([]() {});
+      task->set_scheduling_class(scheduling_class, TaskGroupID{1});
+      queue.push(task, static_cast<uint32_t>(SchedulePriority::Default));
+    }
+  }
+
+  // Within one round, Background tasks get their single turn, Interactive tasks get their own turns as well as those of
+  // the (empty) Default class.
+  auto num_pulled_background_tasks = 0;
+  for (auto round = uint32_t{0}; round < 8 + 4 + 1; ++round) {
+    const auto task = queue.pull();
+    ASSERT_TRUE(task);
+    if (task->scheduling_class() == SchedulingClass::Background) ++num_pulled_background_tasks;
+  }
+  EXPECT_EQ(num_pulled_background_tasks, 1);
+
+  // Without Interactive tasks, the Background tasks get all turns.
+  while (const auto task = queue.pull()) {
+    if (task->scheduling_class() == SchedulingClass::Background) ++num_pulled_background_tasks;
+  }
+  EXPECT_EQ(num_pulled_background_tasks, 20);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SchedulerTest, TaskQueueRoundRobinsBetweenTaskGroups) {
+  auto queue = TaskQueue{NodeID{0}};
+
+  // The first group enqueues all of its tasks before the second group does.
+  for (const auto task_group_id : {TaskGroupID{1}, TaskGroupID{2}}) {
+    for (auto task_id = 0; task_id < 10; ++task_id) {
+      const auto task = std::make_shared<JobTask>([]() {});
+      task->set_scheduling_class(SchedulingClass::Default, task_group_id);
+      queue.push(task, static_cast<uint32_t>(SchedulePriority::Default));
+    }
+  }
+
+  auto previous_task_group_id = std::optional<TaskGroupID>{};
+  for (auto task_id = 0; task_id < 20; ++task_id) {
+    const auto task = queue.pull();
+    ASSERT_TRUE(task);
+    EXPECT_NE(task->task_group_id(), previous_task_group_id);
+    previous_task_group_id = task->task_group_id();
+  }
+  EXPECT_EQ(queue.pull(), nullptr);
+}
+
+TEST_F(SchedulerTest, TaskQueueTakesHighPriorityTasksFirst) {
+  auto queue = TaskQueue{NodeID{0}};
+
+  for (auto task_id = 0; task_id < 5; ++task_id) {
+    const auto task = std::make_shared<JobTask>([]() {});
+    task->set_scheduling_class(SchedulingClass::Interactive, TaskGroupID{1});
+    queue.push(task, static_cast<uint32_t>(SchedulePriority::Default));
+  }
+
+  // Neither the lane of its group nor its class delays a high-priority task
+  const auto high_priority_task = std::make_shared<JobTask>([]() {});
+  high_priority_task->set_scheduling_class(SchedulingClass::Background, TaskGroupID{7});
+  queue.push(high_priority_task, static_cast<uint32_t>(SchedulePriority::High));
+
+  EXPECT_EQ(queue.pull(), high_priority_task);
+  for (auto task_id = 0; task_id < 5; ++task_id) {
+    const auto task = queue.pull();
+    ASSERT_TRUE(task);
+    EXPECT_EQ(task->task_group_id(), TaskGroupID{1});
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SchedulerTest, ScheduledTasksInheritSchedulingClass) {
+  auto inner_task = std::shared_ptr<AbstractTask>{};
+  const auto outer_task = std::make_shared<JobTask>([&]() {
+    inner_task = std::make_shared<JobTask>([]() {});
+    inner_task->schedule();
+  });
+  const auto task_group_id = AbstractTask::create_task_group_id();
+  outer_task->set_scheduling_class(SchedulingClass::Interactive, task_group_id);
+  outer_task->schedule();
+
+  ASSERT_TRUE(inner_task);
+  EXPECT_EQ(inner_task->scheduling_class(), SchedulingClass::Interactive);
+  EXPECT_EQ(inner_task->task_group_id(), task_group_id);
+
+  // Tasks scheduled outside of other tasks keep the defaults.
+  const auto unrelated_task = std::make_shared<JobTask>([]() {});
+  unrelated_task->schedule();
+  EXPECT_EQ(unrelated_task->scheduling_class(), SchedulingClass::Default);
+  EXPECT_EQ(unrelated_task->task_group_id(), DEFAULT_TASK_GROUP_ID);
+}
+
+TEST_F(SchedulerTest, InteractiveQueryWithNodeQueueScheduler) {
+  // A short Interactive query has to finish while Background tasks keep the single worker busy.
+  Hyrise::get().topology.use_non_numa_topology(1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto background_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 100; ++task_id) {
+    background_tasks.emplace_back(
+        std::make_shared<JobTask>([]() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }));
+    background_tasks.back()->set_scheduling_class(SchedulingClass::Background, TaskGroupID{1});
+    background_tasks.back()->schedule();
+  }
+
+  const auto interactive_task = std::make_shared<JobTask>([]() {});
+  interactive_task->set_scheduling_class(SchedulingClass::Interactive, TaskGroupID{2});
+  interactive_task->schedule();
+  Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{interactive_task});
+
+  auto num_finished_background_tasks = 0;
+  for (const auto& task : background_tasks) {
+    if (task->is_done()) ++num_finished_background_tasks;
+  }
+  EXPECT_LT(num_finished_background_tasks, 50);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SchedulerTest, WaitingWorkerExecutesAwaitedTasks) {
+  // With a single worker, the worker waiting for the jobs has to execute all of them itself, including those that only
+  // become ready while it is waiting.
+  Hyrise::get().topology.use_non_numa_topology(1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto jobs_executed_by_waiting_thread = std::atomic_uint{0};
+  auto task = std::make_shared<JobTask>([&]() {
+    const auto waiting_thread_id = std::this_thread::get_id();
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_id = 0; job_id < 10; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, waiting_thread_id]() {
+        if (std::this_thread::get_id() == waiting_thread_id) ++jobs_executed_by_waiting_thread;
+      }));
+      if (job_id > 0) jobs[job_id - 1]->set_as_predecessor_of(jobs[job_id]);
+    }
+
+    // Schedule in reverse order so that the jobs become ready one after another while the worker is waiting.
+    for (auto job_it = jobs.rbegin(); job_it != jobs.rend(); ++job_it) (*job_it)->schedule();
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+  });
+
+  task->schedule();
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(jobs_executed_by_waiting_thread, 10u);
+}
+
+TEST_F(SchedulerTest, NestedWaitingWithWorkStealingScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  std::atomic_uint counter{0};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 10; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() { increment_counter_in_subtasks(counter); }));
+    tasks.back()->schedule();
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(tasks);
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(counter, 300u);
+}
+
 }  // namespace opossum
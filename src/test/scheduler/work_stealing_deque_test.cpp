@@ -0,0 +1,99 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  std::shared_ptr<AbstractTask> make_task() { return std::make_shared<JobTask>([]() {}); }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoStealIsFifo) {
+  auto deque = WorkStealingDeque{};
+  const auto task_a = make_task();
+  const auto task_b = make_task();
+  const auto task_c = make_task();
+
+  EXPECT_TRUE(deque.empty());
+  deque.push(task_a);
+  deque.push(task_b);
+  deque.push(task_c);
+  EXPECT_EQ(deque.size_approx(), 3u);
+
+  EXPECT_EQ(deque.pop(), task_c);
+  EXPECT_EQ(deque.steal(), task_a);
+  EXPECT_EQ(deque.pop(), task_b);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{2};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 100; ++task_id) {
+    tasks.emplace_back(make_task());
+    deque.push(tasks.back());
+  }
+
+  EXPECT_EQ(deque.size_approx(), 100u);
+  for (auto task_id = 0; task_id < 100; ++task_id) {
+    EXPECT_EQ(deque.steal(), tasks[task_id]);
+  }
+}
+
+TEST_F(WorkStealingDequeTest, ReleasesRemainingTasks) {
+  auto task = make_task();
+  {
+    auto deque = WorkStealingDeque{};
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentPopAndSteal) {
+  // Every task must be retrieved exactly once, no matter whether it was popped by the owner or stolen by a thief.
+  constexpr auto NUM_TASKS = 10'000u;
+  constexpr auto NUM_THIEVES = 3;
+
+  auto deque = WorkStealingDeque{4};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>(NUM_TASKS);
+  for (auto& task : tasks) task = make_task();
+
+  std::atomic_uint retrieved_count{0};
+  std::atomic_bool owner_done{false};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = 0; thief_id < NUM_THIEVES; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || !deque.empty()) {
+        if (deque.steal()) ++retrieved_count;
+      }
+    });
+  }
+
+  for (auto task_id = 0u; task_id < NUM_TASKS; ++task_id) {
+    deque.push(tasks[task_id]);
+    if (task_id % 3 == 0 && deque.pop()) ++retrieved_count;
+  }
+  while (deque.pop()) ++retrieved_count;
+
+  owner_done = true;
+  for (auto& thief : thieves) thief.join();
+
+  EXPECT_EQ(retrieved_count, NUM_TASKS);
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task.use_count(), 1);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,206 @@
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "base_test.hpp"
+#include "mock_socket.hpp"
+
+#include "server/copy_handler.hpp"
+#include "storage/base_dictionary_segment.hpp"
+
+namespace opossum {
+
+class CopyHandlerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Double, true}};
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    _expected_table = std::make_shared<Table>(_column_definitions, TableType::Data);
+    _expected_table->append({1, pmr_string{"one"}, 1.5});
+    _expected_table->append({2, NULL_VALUE, -2.25});
+    _expected_table->append({3, pmr_string{"a\tb\\c\nd"}, NULL_VALUE});
+  }
+
+  // Loads the given pieces of COPY data in a single transaction and returns the number of copied rows
+  uint64_t _load(const CopyFormat copy_format, const std::vector<std::string>& copy_data) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    auto copy_data_loader = CopyDataLoader{_table_name, copy_format, transaction_context};
+    for (const auto& data : copy_data) {
+      copy_data_loader.append(data);
+    }
+    const auto row_count = copy_data_loader.finish();
+    transaction_context->commit();
+    return row_count;
+  }
+
+  static void _append_int16(std::string& data, const int16_t value) {
+    const auto network_value = htons(static_cast<uint16_t>(value));
+    data.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  }
+
+  static void _append_int32(std::string& data, const int32_t value) {
+    const auto network_value = htonl(static_cast<uint32_t>(value));
+    data.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  }
+
+  // Appends the length of the field followed by its value
+  static void _append_field(std::string& data, const std::string& value) {
+    _append_int32(data, static_cast<int32_t>(value.size()));
+    data.append(value);
+  }
+
+  static std::string _double_bytes(const double value) {
+    auto bits = uint64_t{0};
+    std::memcpy(&bits, &value, sizeof(value));
+    auto bytes = std::string{};
+    for (auto shift = 56; shift >= 0; shift -= 8) {
+      bytes.push_back(static_cast<char>((bits >> shift) & 0xFF));
+    }
+    return bytes;
+  }
+
+  const std::string _table_name{"table"};
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(CopyHandlerTest, ParseCopyStatement) {
+  const auto copy_from_stdin = CopyHandler::parse_copy_statement("COPY t FROM STDIN;");
+  ASSERT_TRUE(copy_from_stdin);
+  EXPECT_EQ(copy_from_stdin->direction, CopyDirection::FromStdin);
+  EXPECT_EQ(copy_from_stdin->table_name, "t");
+  EXPECT_EQ(copy_from_stdin->format, CopyFormat::Text);
+
+  const auto quoted_table = CopyHandler::parse_copy_statement("copy \"my table\" from stdin with (format csv)");
+  ASSERT_TRUE(quoted_table);
+  EXPECT_EQ(quoted_table->table_name, "my table");
+  EXPECT_EQ(quoted_table->format, CopyFormat::Csv);
+
+  const auto copy_table_to_stdout = CopyHandler::parse_copy_statement("COPY t TO STDOUT WITH CSV");
+  ASSERT_TRUE(copy_table_to_stdout);
+  EXPECT_EQ(copy_table_to_stdout->direction, CopyDirection::ToStdout);
+  EXPECT_EQ(copy_table_to_stdout->query, "SELECT * FROM \"t\"");
+  EXPECT_EQ(copy_table_to_stdout->format, CopyFormat::Csv);
+
+  const auto copy_query_to_stdout =
+      CopyHandler::parse_copy_statement("COPY (SELECT a FROM t WHERE a > 1) TO STDOUT BINARY");
+  ASSERT_TRUE(copy_query_to_stdout);
+  EXPECT_EQ(copy_query_to_stdout->query, "SELECT a FROM t WHERE a > 1");
+  EXPECT_EQ(copy_query_to_stdout->format, CopyFormat::Binary);
+
+  // COPY from and to files is handled by the SQL pipeline
+  EXPECT_FALSE(CopyHandler::parse_copy_statement("COPY t FROM 'file.csv';"));
+  EXPECT_FALSE(CopyHandler::parse_copy_statement("SELECT * FROM t;"));
+
+  EXPECT_THROW(CopyHandler::parse_copy_statement("COPY (SELECT 1) FROM STDIN"), InvalidInputException);
+  EXPECT_THROW(CopyHandler::parse_copy_statement("COPY t FROM STDIN WITH (FORMAT xml)"), InvalidInputException);
+}
+
+TEST_F(CopyHandlerTest, LoadTextData) {
+  // Rows are split across CopyData messages, and the last row is terminated by the end-of-data marker
+  const auto row_count =
+      _load(CopyFormat::Text, {"1\tone\t1.5\n2\t\\N\t-2", ".25\n3\ta\\tb\\\\c\\nd\t\\N\n", "\\.\n", "ignored\n"});
+  EXPECT_EQ(row_count, 3u);
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyHandlerTest, LoadCsvData) {
+  // Quoted fields may contain separators and line breaks, and the last row does not need to end with a line break
+  const auto row_count =
+      _load(CopyFormat::Csv, {"1,one,1.5\r\n2,,-2.25\n3,\"a\tb\\c", "\nd\",\n4,\"say \"\"hi\"\", ok\"", ",0"});
+  EXPECT_EQ(row_count, 4u);
+
+  _expected_table->append({4, pmr_string{"say \"hi\", ok"}, 0.0});
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyHandlerTest, LoadBinaryData) {
+  auto data = std::string{BINARY_COPY_SIGNATURE.data(), BINARY_COPY_SIGNATURE.size()} + std::string(8, '\0');
+
+  const auto values = std::vector<std::tuple<int32_t, std::optional<std::string>, std::optional<double>>>{
+      {1, "one", 1.5}, {2, std::nullopt, -2.25}, {3, "a\tb\\c\nd", std::nullopt}};
+  for (const auto& [a, b, c] : values) {
+    _append_int16(data, 3);
+    _append_int32(data, 4);
+    _append_int32(data, a);
+    // NULL values are represented by a length of -1
+    if (b) {
+      _append_field(data, *b);
+    } else {
+      _append_int32(data, -1);
+    }
+    if (c) {
+      _append_field(data, _double_bytes(*c));
+    } else {
+      _append_int32(data, -1);
+    }
+  }
+  _append_int16(data, -1);
+
+  // Send the data in small pieces so that the header, tuples, and fields are split
+  auto copy_data = std::vector<std::string>{};
+  for (auto position = size_t{0}; position < data.size(); position += 5) {
+    copy_data.emplace_back(data.substr(position, 5));
+  }
+
+  EXPECT_EQ(_load(CopyFormat::Binary, copy_data), 3u);
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyHandlerTest, InvalidData) {
+  EXPECT_THROW(_load(CopyFormat::Text, {"x\tone\t1.5\n"}), InvalidInputException);
+  EXPECT_THROW(_load(CopyFormat::Text, {"1\tone\n"}), InvalidInputException);
+  EXPECT_THROW(_load(CopyFormat::Text, {"1\tone\t1.5\t2\n"}), InvalidInputException);
+  EXPECT_THROW(_load(CopyFormat::Text, {"\\N\tone\t1.5\n"}), InvalidInputException);
+  EXPECT_THROW(_load(CopyFormat::Csv, {"1,\"one,1.5\n"}), InvalidInputException);
+  EXPECT_THROW(_load(CopyFormat::Binary, {"COPY\n"}), InvalidInputException);
+}
+
+TEST_F(CopyHandlerTest, CompressCompletedChunks) {
+  _load(CopyFormat::Text, {"1\tone\t1.5\n2\t\\N\t-2.25\n3\tthree\t\\N\n"});
+  ASSERT_EQ(_table->chunk_count(), 2u);
+
+  CopyDataLoader::compress_completed_chunks(_table_name, ChunkID{0});
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk->is_mutable());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(ColumnID{0})));
+
+  // The last chunk is not full yet
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_EQ(_table->row_count(), 3u);
+}
+
+TEST_F(CopyHandlerTest, CopyToStdout) {
+  const auto mocked_socket = std::make_shared<MockSocket>();
+  const auto protocol_handler =
+      std::make_shared<PostgresProtocolHandler<AsioStreamDescriptor>>(mocked_socket->get_socket());
+
+  CopyHandler::copy_to_stdout(_expected_table, CopyFormat::Text, protocol_handler);
+  protocol_handler->force_flush();
+  const auto file_content = mocked_socket->read();
+
+  auto message_types = std::string{};
+  auto copy_data = std::string{};
+  auto start = size_t{0};
+  while (start < file_content.size()) {
+    message_types.push_back(file_content[start]);
+    const auto message_end = start + 1 + NetworkConversionHelper::get_message_length(file_content.cbegin() + start + 1);
+    if (static_cast<PostgresMessageType>(file_content[start]) == PostgresMessageType::CopyData) {
+      copy_data.append(file_content, start + 5, message_end - start - 5);
+    }
+    start = message_end;
+  }
+
+  // CopyOutResponse, one CopyData message per row, and CopyDone
+  EXPECT_EQ(message_types, "Hdddc");
+  EXPECT_EQ(copy_data, "1\tone\t1.5\n2\t\\N\t-2.25\n3\ta\\tb\\\\c\\nd\t\\N\n");
+}
+
+}  // namespace opossum
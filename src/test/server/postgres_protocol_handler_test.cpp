@@ -43,6 +43,18 @@ TEST_F(PostgresProtocolHandlerTest, DiscardStartupPacketBody) {
   EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::SimpleQueryCommand);
 }
 
+TEST_F(PostgresProtocolHandlerTest, ReadStartupPacketParameters) {
+  // Key/value pairs followed by a null terminator, then the type of the next packet
+  const auto content = std::string{"user\0alice\0scheduling_class\0Interactive\0\0Q", 42};
+  _mocked_socket->write(content);
+  const auto parameters = _protocol_handler->read_startup_packet_body(static_cast<uint32_t>(content.size() - 1));
+
+  EXPECT_EQ(parameters.size(), 2u);
+  EXPECT_EQ(parameters.at("user"), "alice");
+  EXPECT_EQ(parameters.at("scheduling_class"), "Interactive");
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::SimpleQueryCommand);
+}
+
 TEST_F(PostgresProtocolHandlerTest, SendAuthenticationResponse) {
   _protocol_handler->send_authentication_response();
   _protocol_handler->force_flush();
@@ -251,6 +263,80 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
 }
 
+TEST_F(PostgresProtocolHandlerTest, ReadBindPacketWithBinaryParameters) {
+  // Parameter types are specified in the Parse message: int4, int8, float8, text, int4
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x26'});
+  _mocked_socket->write(std::string{"statement\0SELECT 1;\0", 20});
+  _mocked_socket->write(std::string{'\0', '\x05'});
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x17', '\0', '\0', '\0', '\x14', '\0', '\0', '\x02', '\xbd'});
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x19', '\0', '\0', '\0', '\x17'});
+  _protocol_handler->read_parse_packet();
+
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\0'});
+  _mocked_socket->write(std::string{"\0statement\0", 11});
+  // Format codes: binary, binary, binary, text, binary
+  _mocked_socket->write(std::string{'\0', '\x05', '\0', '\x01', '\0', '\x01', '\0', '\x01', '\0', '\0', '\0', '\x01'});
+  _mocked_socket->write(std::string{'\0', '\x05'});
+  // 42 as int4
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x04', '\0', '\0', '\0', '\x2a'});
+  // -2 as int8
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x08'});
+  _mocked_socket->write(std::string{'\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xfe'});
+  // 1.5 as float8
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x08', '\x3f', '\xf8', '\0', '\0', '\0', '\0', '\0', '\0'});
+  // "text" in text format
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x04'});
+  _mocked_socket->write("text");
+  // NULL
+  _mocked_socket->write(std::string{'\xff', '\xff', '\xff', '\xff'});
+  // A single result format code applies to all result columns
+  _mocked_socket->write(std::string{'\0', '\x01', '\0', '\x01'});
+
+  const auto& statement_information = _protocol_handler->read_bind_packet();
+  EXPECT_EQ(statement_information.statement_name, "statement");
+  ASSERT_EQ(statement_information.parameters.size(), 5u);
+  EXPECT_EQ(statement_information.parameters[0], AllTypeVariant{int32_t{42}});
+  EXPECT_EQ(statement_information.parameters[1], AllTypeVariant{int64_t{-2}});
+  EXPECT_EQ(statement_information.parameters[2], AllTypeVariant{1.5});
+  EXPECT_EQ(statement_information.parameters[3], AllTypeVariant{"text"});
+  EXPECT_TRUE(variant_is_null(statement_information.parameters[4]));
+  EXPECT_EQ(statement_information.result_format_codes, std::vector<FormatCode>{FormatCode::Binary});
+  EXPECT_EQ(format_code_at(statement_information.result_format_codes, 3), FormatCode::Binary);
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadBindPacketWithUntypedBinaryParameter) {
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\0'});
+  _mocked_socket->write(std::string{"\0statement\0", 11});
+  _mocked_socket->write(std::string{'\0', '\x01', '\0', '\x01'});
+  _mocked_socket->write(std::string{'\0', '\x01', '\0', '\0', '\0', '\x04', '\0', '\0', '\0', '\x2a'});
+  _mocked_socket->write(std::string{'\0', '\0'});
+
+  EXPECT_THROW(_protocol_handler->read_bind_packet(), InvalidInputException);
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadClosePacket) {
+  // The parameter types of a closed statement are forgotten
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x1e'});
+  _mocked_socket->write(std::string{"statement\0SELECT 1;\0", 20});
+  _mocked_socket->write(std::string{'\0', '\x01', '\0', '\0', '\0', '\x17'});
+  _protocol_handler->read_parse_packet();
+
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x0f', 'S'});
+  _mocked_socket->write(std::string{"statement\0", 10});
+  EXPECT_EQ(_protocol_handler->read_close_packet(), (std::pair<char, std::string>{'S', "statement"}));
+
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\0'});
+  _mocked_socket->write(std::string{"\0statement\0", 11});
+  _mocked_socket->write(std::string{'\0', '\x01', '\0', '\x01'});
+  _mocked_socket->write(std::string{'\0', '\x01', '\0', '\0', '\0', '\x04', '\0', '\0', '\0', '\x2a'});
+  _mocked_socket->write(std::string{'\0', '\0'});
+  EXPECT_THROW(_protocol_handler->read_bind_packet(), InvalidInputException);
+
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x0c', 'P'});
+  _mocked_socket->write(std::string{"portal\0", 7});
+  EXPECT_EQ(_protocol_handler->read_close_packet(), (std::pair<char, std::string>{'P', "portal"}));
+}
+
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
   // Write string including type of new packet, discard them, and see if packet type get correctly detected
   const std::string portal_name = "some_portal";
@@ -258,7 +344,20 @@ TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
   _mocked_socket->write(portal_name);
   _mocked_socket->write({'\0', '\0', '\0', '\0', '\0'});
 
-  EXPECT_EQ(_protocol_handler->read_execute_packet(), portal_name);
+  const auto [portal, row_limit] = _protocol_handler->read_execute_packet();
+  EXPECT_EQ(portal, portal_name);
+  EXPECT_EQ(row_limit, 0u);
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadExecutePacketWithRowLimit) {
+  const std::string portal_name = "some_portal";
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x14'});
+  _mocked_socket->write(portal_name);
+  _mocked_socket->write({'\0', '\0', '\0', '\0', '\x0a'});
+
+  const auto [portal, row_limit] = _protocol_handler->read_execute_packet();
+  EXPECT_EQ(portal, portal_name);
+  EXPECT_EQ(row_limit, 10u);
 }
 
 TEST_F(PostgresProtocolHandlerTest, SendErrorMessage) {
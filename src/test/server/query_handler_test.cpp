@@ -23,6 +23,14 @@ TEST_F(QueryHandlerTest, ExecutePipeline) {
   EXPECT_EQ(result.root_operator, OperatorType::Projection);
 }
 
+TEST_F(QueryHandlerTest, ExecutePipelineWithSchedulingClass) {
+  const auto& result =
+      QueryHandler::execute_pipeline("SELECT * FROM table_a;", SendExecutionInfo::No, SchedulingClass::Background);
+
+  EXPECT_TRUE(result.error_message.empty());
+  EXPECT_EQ(result.result_table->row_count(), 3u);
+}
+
 TEST_F(QueryHandlerTest, CreatePreparedPlan) {
   QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
 
@@ -31,15 +39,38 @@ TEST_F(QueryHandlerTest, CreatePreparedPlan) {
 
 TEST_F(QueryHandlerTest, BindParameters) {
   QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
-  const auto specification = PreparedStatementDetails{"test_statement", "", {123}};
+  const auto specification = PreparedStatementDetails{"test_statement", "", {123}, {}};
 
   const auto result = QueryHandler::bind_prepared_plan(specification);
   EXPECT_EQ(result->type(), OperatorType::TableScan);
 }
 
+TEST_F(QueryHandlerTest, BindResultFormatCodes) {
+  QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
+
+  // Either no format code, a single one for all result columns, or one per result column
+  const auto binary = FormatCode::Binary;
+  EXPECT_NO_THROW(QueryHandler::bind_prepared_plan({"test_statement", "", {123}, {binary}}));
+  EXPECT_NO_THROW(QueryHandler::bind_prepared_plan({"test_statement", "", {123}, {binary, FormatCode::Text}}));
+  EXPECT_THROW(QueryHandler::bind_prepared_plan({"test_statement", "", {123}, {binary, binary, binary}}),
+               InvalidInputException);
+}
+
+TEST_F(QueryHandlerTest, ClosePreparedPlan) {
+  QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
+  QueryHandler::close_prepared_plan("test_statement");
+  EXPECT_FALSE(Hyrise::get().storage_manager.has_prepared_plan("test_statement"));
+
+  // Closing a statement that does not exist is not an error
+  EXPECT_NO_THROW(QueryHandler::close_prepared_plan("test_statement"));
+
+  // A closed statement can be redefined
+  EXPECT_NO_THROW(QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE b > ?"));
+}
+
 TEST_F(QueryHandlerTest, ExecutePreparedStatement) {
   QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
-  const auto specification = PreparedStatementDetails{"test_statement", "", {123}};
+  const auto specification = PreparedStatementDetails{"test_statement", "", {123}, {}};
   const auto pqp = QueryHandler::bind_prepared_plan(specification);
 
   auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
@@ -1,3 +1,7 @@
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 
@@ -43,6 +47,128 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, QueryResponseValues) {
+  ResultSerializer::send_query_response(_test_table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // Read the values of each DataRow message
+  auto rows = std::vector<std::vector<std::optional<std::string>>>{};
+  auto start = size_t{0};
+  while (start < file_content.size()) {
+    EXPECT_EQ(static_cast<PostgresMessageType>(file_content[start]), PostgresMessageType::DataRow);
+    const auto message_end = start + 1 + NetworkConversionHelper::get_message_length(file_content.cbegin() + start + 1);
+    const auto column_count = NetworkConversionHelper::get_small_int(file_content.cbegin() + start + 5);
+    EXPECT_EQ(column_count, _test_table->column_count());
+    start += 7;
+
+    auto& row = rows.emplace_back();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto value_length =
+          static_cast<int32_t>(NetworkConversionHelper::get_message_length(file_content.cbegin() + start));
+      start += sizeof(uint32_t);
+      if (value_length == -1) {
+        row.emplace_back(std::nullopt);
+      } else {
+        row.emplace_back(file_content.substr(start, value_length));
+        start += value_length;
+      }
+    }
+    EXPECT_EQ(start, message_end);
+  }
+
+  ASSERT_EQ(rows.size(), _test_table->row_count());
+  for (const auto& value : rows[0]) {
+    EXPECT_EQ(value, "100");
+  }
+  for (auto column_id = ColumnID{0}; column_id < _test_table->column_count(); ++column_id) {
+    if (column_id % 2 == 0) {
+      EXPECT_EQ(rows[4][column_id], "104");
+    } else {
+      EXPECT_EQ(rows[4][column_id], std::nullopt);
+    }
+  }
+}
+
+TEST_F(ResultSerializerTest, BinaryQueryResponse) {
+  const auto result_format_codes = std::vector<FormatCode>{FormatCode::Binary};
+  ResultSerializer::send_table_description(_test_table, _protocol_handler, result_format_codes);
+  _protocol_handler->force_flush();
+  const auto row_description = _mocked_socket->read();
+  // The format code is the last field of each column's description
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(row_description.cend() - sizeof(uint16_t)), 1);
+
+  ResultSerializer::send_query_response(_test_table, _protocol_handler, result_format_codes);
+  _protocol_handler->force_flush();
+  const auto file_content = _mocked_socket->read().substr(row_description.size());
+
+  // The first row contains the value 100 in each column
+  auto start = sizeof(PostgresMessageType) + sizeof(uint32_t) + sizeof(uint16_t);
+  const auto expect_value = [&](const std::string& bytes) {
+    EXPECT_EQ(NetworkConversionHelper::get_message_length(file_content.cbegin() + start), bytes.size());
+    start += sizeof(uint32_t);
+    EXPECT_EQ(file_content.substr(start, bytes.size()), bytes);
+    start += bytes.size();
+  };
+  const auto int_bytes = std::string{'\0', '\0', '\0', '\x64'};
+  const auto long_bytes = std::string{'\0', '\0', '\0', '\0', '\0', '\0', '\0', '\x64'};
+  const auto float_bytes = std::string{'\x42', '\xc8', '\0', '\0'};
+  const auto double_bytes = std::string{'\x40', '\x59', '\0', '\0', '\0', '\0', '\0', '\0'};
+  for (const auto& bytes : {int_bytes, int_bytes, long_bytes, long_bytes, float_bytes, float_bytes, double_bytes,
+                            double_bytes, std::string{"100"}, std::string{"100"}}) {
+    expect_value(bytes);
+  }
+}
+
+TEST_F(ResultSerializerTest, LargeQueryResponse) {
+  // The result does not fit into the WriteBuffer and is written to the socket directly
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Double, true}}, TableType::Data, 1'000);
+  for (auto row_id = int32_t{0}; row_id < 5'000; ++row_id) {
+    table->append({row_id, row_id % 7 == 0 ? NULL_VALUE : AllTypeVariant{row_id / 4.0}});
+  }
+
+  ResultSerializer::send_query_response(table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  auto row_count = size_t{0};
+  auto start = size_t{0};
+  while (start < file_content.size()) {
+    EXPECT_EQ(static_cast<PostgresMessageType>(file_content[start]), PostgresMessageType::DataRow);
+    start += 1 + NetworkConversionHelper::get_message_length(file_content.cbegin() + start + 1);
+    ++row_count;
+  }
+  EXPECT_EQ(start, file_content.size());
+  EXPECT_EQ(row_count, 5'000u);
+
+  // The last row is 4999 and 1249.75
+  const auto last_row = std::string{"\0\0\0\x04" "4999" "\0\0\0\x07" "1249.75", 19};
+  EXPECT_EQ(file_content.substr(file_content.size() - last_row.size()), last_row);
+}
+
+TEST_F(ResultSerializerTest, QueryResponseStream) {
+  ResultSerializer::send_query_response(_test_table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const std::string complete_response = _mocked_socket->read();
+
+  // Send the same rows in portions that do not match the chunks (which contain two rows each)
+  const auto result_stream = ResultSerializer::create_query_response_stream(_test_table);
+  auto row_count = uint64_t{0};
+  while (result_stream->has_unsent_rows()) {
+    const auto sent_row_count = result_stream->send_rows(*_protocol_handler, 3);
+    EXPECT_GT(sent_row_count, 0u);
+    EXPECT_LE(sent_row_count, 3u);
+    row_count += sent_row_count;
+  }
+  EXPECT_EQ(result_stream->send_rows(*_protocol_handler), 0u);
+  _protocol_handler->force_flush();
+
+  // The MockSocket's file now contains both responses
+  EXPECT_EQ(row_count, _test_table->row_count());
+  EXPECT_EQ(_mocked_socket->read(), complete_response + complete_response);
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
@@ -1,5 +1,7 @@
 #include <pqxx/pqxx>
 
+#include <array>
+#include <cstring>
 #include <fstream>
 #include <future>
 #include <thread>
@@ -10,6 +12,7 @@
 #include "scheduler/node_queue_scheduler.hpp"
 #include "sql/sql_plan_cache.hpp"
 
+#include "server/postgres_message_type.hpp"
 #include "server/server.hpp"
 
 namespace opossum {
@@ -328,6 +331,115 @@ TEST_F(ServerTestRunner, TestParallelConnections) {
   }
 }
 
+TEST_F(ServerTestRunner, TestAsynchronousSessions) {
+  // More connections than I/O threads and workers, which send simple queries and (pipelined) prepared statements
+  auto server = Server{boost::asio::ip::address(), 0, SendExecutionInfo::No, SessionMode::Asynchronous, 2};
+  auto server_thread = std::thread{[&]() { server.run(); }};
+  const auto connection_string = "hostaddr=127.0.0.1 port=" + std::to_string(server.server_port());
+  const auto expected_num_rows = _table_a->row_count();
+
+  const auto connection_run = [&]() {
+    pqxx::connection connection{connection_string};
+    pqxx::nontransaction transaction{connection};
+    connection.prepare("statement", "SELECT * FROM table_a WHERE a > ?");
+    for (auto iteration = 0; iteration < 5; ++iteration) {
+      EXPECT_EQ(transaction.exec("SELECT * FROM table_a;").size(), expected_num_rows);
+      EXPECT_EQ(transaction.exec_prepared("statement", 1234).size(), 1u);
+    }
+  };
+
+  const auto num_threads = 50u;
+  std::vector<std::future<void>> thread_futures;
+  thread_futures.reserve(num_threads);
+  for (auto thread_num = 0u; thread_num < num_threads; ++thread_num) {
+    thread_futures.emplace_back(std::async(std::launch::async, connection_run));
+  }
+
+  for (auto& thread_future : thread_futures) {
+    // See TestParallelConnections
+    if (thread_future.wait_for(std::chrono::seconds(150)) == std::future_status::timeout) {
+      ASSERT_TRUE(false) << "At least one session got stuck.";
+    }
+    thread_future.get();
+  }
+
+  server.shutdown();
+  server_thread.join();
+}
+
+TEST_F(ServerTestRunner, TestAsynchronousSessionsWithSlowClient) {
+  // With a single worker, a session that waits for a slow client on the worker would keep all other sessions from
+  // executing their queries
+  Hyrise::get().topology.use_non_numa_topology(1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto server = Server{boost::asio::ip::address(), 0, SendExecutionInfo::No, SessionMode::Asynchronous};
+  auto server_thread = std::thread{[&]() { server.run(); }};
+  const auto connection_string = "hostaddr=127.0.0.1 port=" + std::to_string(server.server_port());
+  const auto expected_num_rows = _table_a->row_count();
+
+  const auto expect_concurrent_query_to_complete = [&]() {
+    auto query_future = std::async(std::launch::async, [&]() {
+      pqxx::connection connection{connection_string};
+      pqxx::nontransaction transaction{connection};
+      return transaction.exec("SELECT * FROM table_a;").size();
+    });
+    ASSERT_EQ(query_future.wait_for(std::chrono::seconds(10)), std::future_status::ready)
+        << "The query got stuck behind the slow client.";
+    EXPECT_EQ(query_future.get(), expected_num_rows);
+  };
+
+  // The slow client speaks the protocol by hand so that it can send partial messages
+  auto io_service = boost::asio::io_service{};
+  auto socket = boost::asio::ip::tcp::socket{io_service};
+  socket.connect({boost::asio::ip::address_v4::loopback(), server.server_port()});
+
+  const auto message = [](const PostgresMessageType message_type, const std::string& body) {
+    const auto length = htonl(static_cast<uint32_t>(LENGTH_FIELD_SIZE + body.size()));
+    auto result = std::string{static_cast<char>(message_type)};
+    result.append(reinterpret_cast<const char*>(&length), LENGTH_FIELD_SIZE);
+    return result + body;
+  };
+
+  const auto receive_until = [&](const PostgresMessageType message_type) {
+    while (true) {
+      auto header = std::array<char, 1 + LENGTH_FIELD_SIZE>{};
+      boost::asio::read(socket, boost::asio::buffer(header));
+      auto length = uint32_t{};
+      std::memcpy(&length, &header[1], LENGTH_FIELD_SIZE);
+      auto body = std::string(ntohl(length) - LENGTH_FIELD_SIZE, '\0');
+      boost::asio::read(socket, boost::asio::buffer(body));
+      if (header[0] == static_cast<char>(message_type)) return;
+    }
+  };
+
+  // Protocol version 3.0, followed by the (empty) parameters. The startup packet has no message type.
+  const auto startup_packet = message(PostgresMessageType{}, std::string{"\x00\x03\x00\x00\x00", 5}).substr(1);
+  boost::asio::write(socket, boost::asio::buffer(startup_packet));
+  receive_until(PostgresMessageType::ReadyForQuery);
+
+  // The client sends only the first part of a query
+  const auto query = message(PostgresMessageType::SimpleQueryCommand, std::string{"SELECT * FROM table_a;\0", 23});
+  boost::asio::write(socket, boost::asio::buffer(query.substr(0, 10)));
+  expect_concurrent_query_to_complete();
+  boost::asio::write(socket, boost::asio::buffer(query.substr(10)));
+  receive_until(PostgresMessageType::ReadyForQuery);
+
+  // The client starts COPY FROM STDIN, but takes its time to send the data
+  const auto copy = message(PostgresMessageType::SimpleQueryCommand, std::string{"COPY table_a FROM STDIN;\0", 25});
+  boost::asio::write(socket, boost::asio::buffer(copy));
+  receive_until(PostgresMessageType::CopyInResponse);
+  expect_concurrent_query_to_complete();
+  boost::asio::write(socket, boost::asio::buffer(message(PostgresMessageType::CopyData, "1\t2.5\n")));
+  boost::asio::write(socket, boost::asio::buffer(message(PostgresMessageType::CopyDone, "")));
+  receive_until(PostgresMessageType::ReadyForQuery);
+  EXPECT_EQ(_table_a->row_count(), expected_num_rows + 1);
+
+  socket.close();
+  server.shutdown();
+  server_thread.join();
+}
+
 TEST_F(ServerTestRunner, TestTransactionConflicts) {
   // Similar to TestParallelConnections, but this time we modify the table, expecting some conflicts on the way
   // Also similar to StressTest.TestTransactionConflicts, only that we go through the server
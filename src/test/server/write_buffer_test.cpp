@@ -74,4 +74,20 @@ TEST_F(WriteBufferTest, WriteLargeString) {
   EXPECT_EQ(_mocked_socket->read(), original_content);
 }
 
+TEST_F(WriteBufferTest, WriteBuffers) {
+  const auto small_content = std::string{"small"};
+  const auto large_content = std::string(2 * SERVER_BUFFER_SIZE, 'a');
+
+  // Small buffers are copied into the WriteBuffer
+  _write_buffer->put_string("first", HasNullTerminator::No);
+  _write_buffer->put_buffers({boost::asio::buffer(small_content), boost::asio::buffer(small_content)});
+  EXPECT_EQ(_write_buffer->size(), 15u);
+  EXPECT_TRUE(_mocked_socket->empty());
+
+  // Large buffers are written together with the buffered data
+  _write_buffer->put_buffers({boost::asio::buffer(small_content), boost::asio::buffer(large_content)});
+  EXPECT_EQ(_write_buffer->size(), 0u);
+  EXPECT_EQ(_mocked_socket->read(), "firstsmallsmallsmall" + large_content);
+}
+
 }  // namespace opossum
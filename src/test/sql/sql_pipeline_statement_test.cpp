@@ -441,6 +441,27 @@ TEST_F(SQLPipelineStatementTest, GetTasksTwice) {
   EXPECT_TRUE(_contains_validate(tasks));
 }
 
+TEST_F(SQLPipelineStatementTest, GetTasksWithSchedulingClass) {
+  auto sql_pipeline = SQLPipelineBuilder{_select_query_a}
+                          .with_scheduling_class(SchedulingClass::Interactive)
+                          .create_pipeline_statement();
+  auto other_sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+
+  const auto& tasks = sql_pipeline.get_tasks();
+  const auto& other_tasks = other_sql_pipeline.get_tasks();
+
+  // All tasks of a statement form one task group, different statements use different groups.
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->scheduling_class(), SchedulingClass::Interactive);
+    EXPECT_EQ(task->task_group_id(), tasks.front()->task_group_id());
+    EXPECT_NE(task->task_group_id(), DEFAULT_TASK_GROUP_ID);
+  }
+  for (const auto& task : other_tasks) {
+    EXPECT_EQ(task->scheduling_class(), SchedulingClass::Default);
+    EXPECT_NE(task->task_group_id(), tasks.front()->task_group_id());
+  }
+}
+
 TEST_F(SQLPipelineStatementTest, GetTasksNotValidated) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.disable_mvcc().create_pipeline_statement();
 
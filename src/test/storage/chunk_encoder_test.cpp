@@ -1,6 +1,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "base_test.hpp"
@@ -12,6 +13,8 @@
 #include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
 
@@ -222,4 +225,126 @@ TEST_F(ChunkEncoderTest, ReencodingTable) {
   }
 }
 
+TEST_F(ChunkEncoderTest, EncodeColumnWithSharedDictionary) {
+  const auto table = load_table("resources/test_data/tbl/int_string_like.tbl", 2);
+  const auto expected_table = load_table("resources/test_data/tbl/int_string_like.tbl", 2);
+  const auto chunk_count = table->chunk_count();
+  ASSERT_GT(chunk_count, 1u);
+
+  ChunkEncoder::encode_column_with_shared_dictionary(table, ColumnID{1});
+
+  // The first column is left untouched, all segments of the second one share one dictionary
+  EXPECT_TRUE(std::dynamic_pointer_cast<BaseValueSegment>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_FALSE(find_shared_dictionary_segment(*table, ColumnID{0}));
+
+  const auto shared_dictionary_segment = find_shared_dictionary_segment(*table, ColumnID{1});
+  ASSERT_TRUE(shared_dictionary_segment);
+
+  const auto first_segment = std::dynamic_pointer_cast<const DictionarySegment<pmr_string>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(first_segment);
+
+  auto distinct_values = std::set<pmr_string>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<const DictionarySegment<pmr_string>>(
+        table->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->dictionary(), first_segment->dictionary());
+    EXPECT_TRUE(segment->shares_dictionary_with(*shared_dictionary_segment));
+
+    const auto segment_size = segment->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+      const auto value = segment->get_typed_value(chunk_offset);
+      if (value) distinct_values.emplace(*value);
+    }
+  }
+
+  // The shared dictionary holds the sorted distinct values of all chunks
+  const auto& dictionary = *first_segment->dictionary();
+  EXPECT_EQ(dictionary, pmr_vector<pmr_string>(distinct_values.cbegin(), distinct_values.cend()));
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Segments of different chunks do not share their dictionaries when encoded as usual
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_FALSE(find_shared_dictionary_segment(*table, ColumnID{1}));
+}
+
+TEST_F(ChunkEncoderTest, EncodeColumnWithSharedFixedStringDictionary) {
+  const auto table = load_table("resources/test_data/tbl/string_with_null.tbl", 2);
+  const auto expected_table = load_table("resources/test_data/tbl/string_with_null.tbl", 2);
+
+  const auto segment_encoding_spec =
+      SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::SimdBp128};
+  ChunkEncoder::encode_column_with_shared_dictionary(table, ColumnID{0}, segment_encoding_spec);
+
+  const auto shared_dictionary_segment = find_shared_dictionary_segment(*table, ColumnID{0});
+  ASSERT_TRUE(shared_dictionary_segment);
+  EXPECT_EQ(shared_dictionary_segment->encoding_type(), EncodingType::FixedStringDictionary);
+  EXPECT_EQ(get_segment_encoding_spec(shared_dictionary_segment), segment_encoding_spec);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Reference tables are resolved to the referenced column
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::IsNotNull, NULL_VALUE);
+  table_scan->execute();
+  EXPECT_EQ(find_shared_dictionary_segment(*table_scan->get_output(), ColumnID{0}), shared_dictionary_segment);
+}
+
+TEST_F(ChunkEncoderTest, EncodeWholeTableWithSharedDictionary) {
+  const auto table = load_table("resources/test_data/tbl/int_string_like.tbl", 2);
+  const auto expected_table = load_table("resources/test_data/tbl/int_string_like.tbl", 2);
+
+  const auto shared_encoding_spec = SegmentEncodingSpec{EncodingType::Dictionary, std::nullopt, true};
+  ChunkEncoder::encode_all_chunks(table, ChunkEncodingSpec{SegmentEncodingSpec{}, shared_encoding_spec});
+
+  EXPECT_FALSE(find_shared_dictionary_segment(*table, ColumnID{0}));
+  EXPECT_TRUE(find_shared_dictionary_segment(*table, ColumnID{1}));
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+TEST_F(ChunkEncoderTest, EncodeAppendedChunkWithSharedDictionary) {
+  const auto table = load_table("resources/test_data/tbl/int_string_like.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::RunLength},
+                                                           {EncodingType::FixedStringDictionary, std::nullopt, true}});
+  const auto shared_dictionary_segment = find_shared_dictionary_segment(*table, ColumnID{1});
+  ASSERT_TRUE(shared_dictionary_segment);
+
+  // The appended chunk only holds values of the shared dictionary and thus joins it
+  table->append({int32_t{1}, pmr_string{"Reeperbahn"}});
+  table->append({int32_t{2}, NULL_VALUE});
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_appended_chunk(table, ChunkID{table->chunk_count() - 1});
+
+  const auto appended_chunk = table->last_chunk();
+  EXPECT_EQ(appended_chunk->get_segment(ColumnID{0})->size(), 2u);
+  EXPECT_EQ(find_shared_dictionary_segment(*table, ColumnID{1}), shared_dictionary_segment);
+  EXPECT_EQ(get_segment_encoding_spec(appended_chunk->get_segment(ColumnID{1})),
+            get_segment_encoding_spec(shared_dictionary_segment));
+  EXPECT_EQ((*appended_chunk->get_segment(ColumnID{1}))[ChunkOffset{0}], AllTypeVariant{pmr_string{"Reeperbahn"}});
+  EXPECT_TRUE(variant_is_null((*appended_chunk->get_segment(ColumnID{1}))[ChunkOffset{1}]));
+
+  // A value that the shared dictionary lacks cannot be added without re-encoding the other chunks, which might be read
+  // concurrently. The appended chunk gets a dictionary of its own instead.
+  table->append({int32_t{3}, pmr_string{"Landungsbrücken"}});
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_appended_chunk(table, ChunkID{table->chunk_count() - 1});
+
+  EXPECT_FALSE(find_shared_dictionary_segment(*table, ColumnID{1}));
+  EXPECT_EQ(table->last_chunk()->get_segment(ColumnID{1})->size(), 1u);
+  EXPECT_EQ((*table->last_chunk()->get_segment(ColumnID{1}))[ChunkOffset{0}],
+            AllTypeVariant{pmr_string{"Landungsbrücken"}});
+  EXPECT_EQ(get_segment_encoding_spec(table->last_chunk()->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::Dictionary);
+}
+
+TEST_F(ChunkEncoderTest, EncodeColumnWithSharedDictionaryRejectsOtherEncodings) {
+  _table->last_chunk()->finalize();
+  EXPECT_THROW(ChunkEncoder::encode_column_with_shared_dictionary(_table, ColumnID{0}, {EncodingType::RunLength}),
+               std::logic_error);
+  EXPECT_THROW(
+      ChunkEncoder::encode_column_with_shared_dictionary(_table, ColumnID{0}, {EncodingType::FixedStringDictionary}),
+      std::logic_error);
+}
+
 }  // namespace opossum
@@ -6,6 +6,7 @@
 
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/scan_compressed_vector_range.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 
 #include "constant_mappings.hpp"
@@ -81,6 +82,23 @@ class CompressedVectorTest : public BaseTestWithParam<VectorCompressionType> {
     encoded_seq_it -= expected_values.size() / 2;
     EXPECT_EQ(*encoded_seq_it, *expected_it);
   }
+
+  void compare_range_scan(const BaseCompressedVector& encoded_sequence, const pmr_vector<uint32_t>& expected_values,
+                          const uint32_t lower, const uint32_t upper) {
+    auto expected_positions = std::vector<size_t>{};
+    for (auto index = size_t{0u}; index < expected_values.size(); ++index) {
+      if (expected_values[index] >= lower && expected_values[index] < upper) expected_positions.emplace_back(index);
+    }
+
+    auto positions = std::vector<size_t>{};
+    scan_compressed_vector_range(encoded_sequence, lower, upper, [&](const size_t first_index, const uint64_t mask) {
+      for (auto bit_index = size_t{0u}; bit_index < 64u; ++bit_index) {
+        if (mask & (uint64_t{1u} << bit_index)) positions.emplace_back(first_index + bit_index);
+      }
+    });
+
+    EXPECT_EQ(positions, expected_positions) << "Range [" << lower << ", " << upper << ")";
+  }
 };
 
 auto compressed_vector_test_formatter = [](const ::testing::TestParamInfo<VectorCompressionType> info) {
@@ -139,4 +157,44 @@ TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingDecompressor) {
   }
 }
 
+TEST_P(CompressedVectorTest, ScanRange) {
+  // 4'201 is not a multiple of the block sizes, so that the padding at the end of the vector is covered as well
+  const auto sequence = this->generate_sequence(4'201, 8u);
+  const auto encoded_sequence = this->encode(sequence);
+
+  compare_range_scan(*encoded_sequence, sequence, 0u, 0u);
+  compare_range_scan(*encoded_sequence, sequence, 0u, min());
+  compare_range_scan(*encoded_sequence, sequence, min(), min() + 1u);
+  compare_range_scan(*encoded_sequence, sequence, 2'000u, 2'001u);
+  compare_range_scan(*encoded_sequence, sequence, 2'000u, 20'000u);
+  compare_range_scan(*encoded_sequence, sequence, 0u, 20'000u);
+  compare_range_scan(*encoded_sequence, sequence, 20'000u, std::numeric_limits<uint32_t>::max());
+  compare_range_scan(*encoded_sequence, sequence, 0u, std::numeric_limits<uint32_t>::max());
+  compare_range_scan(*encoded_sequence, sequence, max() + 1u, std::numeric_limits<uint32_t>::max());
+}
+
+TEST_P(CompressedVectorTest, ScanRangeOnSmallValues) {
+  // Values fit into a single byte, but the range exceeds it
+  auto sequence = pmr_vector<uint32_t>(1'000);
+  for (auto index = size_t{0u}; index < sequence.size(); ++index) {
+    sequence[index] = static_cast<uint32_t>((index * 7u) % 200u);
+  }
+  const auto encoded_sequence = compress_vector(sequence, GetParam(), {}, {199u});
+
+  compare_range_scan(*encoded_sequence, sequence, 0u, 200u);
+  compare_range_scan(*encoded_sequence, sequence, 0u, 1'000u);
+  compare_range_scan(*encoded_sequence, sequence, 100u, 1'000u);
+  compare_range_scan(*encoded_sequence, sequence, 199u, 200u);
+  compare_range_scan(*encoded_sequence, sequence, 300u, 1'000u);
+  compare_range_scan(*encoded_sequence, sequence, 0u, 0u);
+}
+
+TEST_P(CompressedVectorTest, ScanRangeOnSequenceOfZeros) {
+  const auto sequence = pmr_vector<uint32_t>(2'200, 0u);
+  const auto encoded_sequence = this->encode(sequence);
+
+  compare_range_scan(*encoded_sequence, sequence, 0u, 1u);
+  compare_range_scan(*encoded_sequence, sequence, 1u, 2u);
+}
+
 }  // namespace opossum
@@ -1,4 +1,6 @@
 #include <cctype>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <random>
 #include <sstream>
@@ -604,6 +606,45 @@ TEST_F(EncodedSegmentTest, RunLengthEncodingNullValuesInRun) {
   EXPECT_EQ(run_length_segment->end_positions()->at(4), 10);
 }
 
+TEST_F(EncodedSegmentTest, RunLengthRunIndex) {
+  // Runs of length 3 (short runs) get a run index, a single run does not
+  constexpr auto row_count = int32_t{200};
+  auto values = pmr_vector<int32_t>(row_count);
+  auto null_values = pmr_vector<bool>(row_count);
+
+  for (auto row_id = int32_t{0u}; row_id < row_count; ++row_id) {
+    values[row_id] = row_id / 3;
+    null_values[row_id] = (row_id / 3) % 5 == 0;
+  }
+
+  auto values_copy = values;
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values));
+  const auto encoded_segment =
+      this->encode_segment(value_segment, DataType::Int, SegmentEncodingSpec{EncodingType::RunLength});
+
+  const auto run_length_segment = std::dynamic_pointer_cast<const RunLengthSegment<int32_t>>(encoded_segment);
+  ASSERT_TRUE(run_length_segment);
+
+  // One sample for each of the chunk offsets 0, 64, 128, and 192
+  EXPECT_EQ(run_length_segment->run_index(), (pmr_vector<ChunkOffset>{0u, 21u, 42u, 64u}));
+
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < static_cast<ChunkOffset>(row_count); ++chunk_offset) {
+    EXPECT_EQ(run_length_segment->run_for_chunk_offset(chunk_offset), chunk_offset / 3);
+    if ((chunk_offset / 3) % 5 == 0) {
+      EXPECT_FALSE(run_length_segment->get_typed_value(chunk_offset));
+    } else {
+      EXPECT_EQ(run_length_segment->get_typed_value(chunk_offset), values_copy[chunk_offset]);
+    }
+  }
+
+  const auto single_run_segment = std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>(row_count, 17));
+  const auto encoded_single_run_segment = std::dynamic_pointer_cast<const RunLengthSegment<int32_t>>(
+      this->encode_segment(single_run_segment, DataType::Int, SegmentEncodingSpec{EncodingType::RunLength}));
+  ASSERT_TRUE(encoded_single_run_segment);
+  EXPECT_TRUE(encoded_single_run_segment->run_index().empty());
+  EXPECT_EQ(encoded_single_run_segment->get_typed_value(ChunkOffset{150}), 17);
+}
+
 // Testing the internal data structures of Frame of Reference-encoded segments. In particular, the determination of the
 // reference value (i.e., the block minimum) as well as the difference to the reference value are checked. This test
 // does not test the creation of multiple frames as the required vectors are too large for unit testing.
@@ -651,4 +692,70 @@ TEST_F(EncodedSegmentTest, FrameOfReference) {
   });
 }
 
+TEST_F(EncodedSegmentTest, FrameOfReferenceLongWithLargeValueRange) {
+  // Offsets that do not fit into 32 bits are split into offset_values and high_offset_values
+  const auto values = pmr_vector<int64_t>{std::numeric_limits<int64_t>::min(), -1, 0, 1'600'000'000'000'000'000,
+                                          std::numeric_limits<int64_t>::max()};
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{values});
+
+  for (const auto vector_compression_type :
+       {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128}) {
+    const auto for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(this->encode_segment(
+        value_segment, DataType::Long, SegmentEncodingSpec{EncodingType::FrameOfReference, vector_compression_type}));
+    ASSERT_TRUE(for_segment);
+    ASSERT_TRUE(for_segment->high_offset_values());
+    EXPECT_EQ(for_segment->block_minima().front(), std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(for_segment->high_offset_values()->type(), for_segment->offset_values().type());
+
+    for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < values.size(); ++chunk_offset) {
+      EXPECT_EQ(for_segment->get_typed_value(chunk_offset), values[chunk_offset]);
+    }
+
+    auto materialized_values = std::vector<int64_t>{};
+    create_iterable_from_segment<int64_t, false>(*for_segment).materialize_values(materialized_values);
+    EXPECT_EQ(materialized_values, std::vector<int64_t>(values.begin(), values.end()));
+  }
+
+  // Timestamps that lie close together do not need high offsets
+  const auto timestamp_segment = std::make_shared<ValueSegment<int64_t>>(
+      pmr_vector<int64_t>{1'600'000'000'000'000'000, 1'600'000'000'000'000'017, 1'600'000'000'000'001'000});
+  const auto encoded_timestamp_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(
+      this->encode_segment(timestamp_segment, DataType::Long, SegmentEncodingSpec{EncodingType::FrameOfReference}));
+  ASSERT_TRUE(encoded_timestamp_segment);
+  EXPECT_FALSE(encoded_timestamp_segment->high_offset_values());
+  EXPECT_EQ(encoded_timestamp_segment->get_typed_value(ChunkOffset{2}), 1'600'000'000'000'001'000);
+}
+
+TEST_F(EncodedSegmentTest, FrameOfReferenceFloatingPoint) {
+  // Floating-point values are encoded losslessly, including negative numbers and negative zero
+  const auto values = pmr_vector<double>{-17.5, -0.0, 0.0, 3.25, -1e100, 1e-100, 42.0};
+  const auto null_values = pmr_vector<bool>{false, false, false, true, false, false, false};
+  const auto value_segment =
+      std::make_shared<ValueSegment<double>>(pmr_vector<double>{values}, pmr_vector<bool>{null_values});
+
+  const auto for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<double>>(
+      this->encode_segment(value_segment, DataType::Double, SegmentEncodingSpec{EncodingType::FrameOfReference}));
+  ASSERT_TRUE(for_segment);
+  EXPECT_EQ(for_segment->block_minima().front(), -1e100);
+
+  auto chunk_offset = ChunkOffset{0u};
+  create_iterable_from_segment<double, false>(*for_segment).for_each([&](const auto& position) {
+    EXPECT_EQ(position.is_null(), null_values[chunk_offset]);
+    if (!position.is_null()) {
+      EXPECT_EQ(position.value(), values[chunk_offset]);
+      EXPECT_EQ(std::signbit(position.value()), std::signbit(values[chunk_offset]));
+    }
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, values.size());
+
+  // Mapping floats to unsigned integers preserves their order
+  const auto float_values = std::vector<float>{-std::numeric_limits<float>::infinity(), -2.5f, -0.0f, 0.0f, 1e-30f,
+                                               2.5f, std::numeric_limits<float>::max()};
+  for (auto index = size_t{1u}; index < float_values.size(); ++index) {
+    EXPECT_LT(FrameOfReferenceSegment<float>::to_ordered_unsigned(float_values[index - 1]),
+              FrameOfReferenceSegment<float>::to_ordered_unsigned(float_values[index]));
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Column "sorted" consists of runs of 100 equal values, column "random" of mostly unique values
+    const auto column_definitions =
+        TableColumnDefinitions{{"sorted", DataType::Int, false}, {"random", DataType::Long, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size);
+
+    auto random_value = uint64_t{17};
+    for (auto row_id = int32_t{0}; row_id < static_cast<int32_t>(3 * _chunk_size); ++row_id) {
+      random_value = random_value * 6'364'136'223'846'793'005u + 1'442'695'040'888'963'407u;
+      _table->append({row_id / 100, static_cast<int64_t>(random_value >> 24u)});
+    }
+  }
+
+ protected:
+  static size_t _estimated_memory_usage(const std::vector<EncodingAdvisor::SegmentRecommendation>& recommendations) {
+    return std::accumulate(recommendations.cbegin(), recommendations.cend(), size_t{0},
+                           [](const auto sum, const auto& recommendation) {
+                             return sum + recommendation.estimated_memory_usage;
+                           });
+  }
+
+  static constexpr auto _chunk_size = ChunkOffset{10'000};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingAdvisorTest, SampleSegment) {
+  const auto advisor = EncodingAdvisor{};
+
+  const auto sorted_statistics = advisor.sample_segment(*_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_EQ(sorted_statistics.row_count, _chunk_size);
+  EXPECT_EQ(sorted_statistics.sampled_row_count, EncodingAdvisor::DEFAULT_SAMPLE_SIZE);
+  EXPECT_EQ(sorted_statistics.null_count, 0u);
+  EXPECT_NEAR(static_cast<double>(sorted_statistics.run_count), 100.0, 10.0);
+  EXPECT_NEAR(static_cast<double>(sorted_statistics.distinct_count), 100.0, 10.0);
+  EXPECT_LT(sorted_statistics.max_block_offset, 2'048u / 100u + 1u);
+
+  const auto random_statistics = advisor.sample_segment(*_table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  EXPECT_EQ(random_statistics.run_count, _chunk_size);
+  EXPECT_GT(random_statistics.distinct_count, EncodingAdvisor::DEFAULT_SAMPLE_SIZE);
+  EXPECT_GT(random_statistics.max_block_offset, uint64_t{1} << 32u);
+
+  // Small segments are sampled completely
+  const auto value_segment =
+      std::make_shared<ValueSegment<pmr_string>>(pmr_vector<pmr_string>{"a", "a", "bb", "a", "ccc", "ccc"},
+                                                 pmr_vector<bool>{false, false, false, false, true, false});
+  const auto string_statistics = advisor.sample_segment(*value_segment);
+  EXPECT_EQ(string_statistics.sampled_row_count, 6u);
+  EXPECT_EQ(string_statistics.null_count, 1u);
+  EXPECT_EQ(string_statistics.distinct_count, 3u);
+  EXPECT_EQ(string_statistics.run_count, 5u);
+  EXPECT_EQ(string_statistics.max_string_length, 3u);
+  EXPECT_DOUBLE_EQ(string_statistics.average_string_length, 8.0 / 5.0);
+}
+
+TEST_F(EncodingAdvisorTest, SamplingIsNotCountedAsAccess) {
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto access_counter = SegmentAccessCounter{segment->access_counter};
+
+  EncodingAdvisor{}.sample_segment(*segment);
+  EXPECT_EQ(segment->access_counter.to_string(), access_counter.to_string());
+}
+
+TEST_F(EncodingAdvisorTest, EstimateCandidates) {
+  const auto statistics = EncodingAdvisor{}.sample_segment(*_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  auto access_counter = SegmentAccessCounter{};
+  access_counter[SegmentAccessCounter::AccessType::Random] += 1'000;
+
+  const auto candidates = EncodingAdvisor::estimate_candidates(statistics, DataType::Int, access_counter);
+
+  // Unencoded, Dictionary and FrameOfReference with both vector compressions, and RunLength
+  ASSERT_EQ(candidates.size(), 6u);
+  for (const auto& candidate : candidates) {
+    EXPECT_NE(candidate.encoding_spec.encoding_type, EncodingType::LZ4);
+    EXPECT_NE(candidate.encoding_spec.encoding_type, EncodingType::FixedStringDictionary);
+
+    if (candidate.encoding_spec.encoding_type == EncodingType::Unencoded) {
+      EXPECT_EQ(candidate.estimated_memory_usage, _chunk_size * sizeof(int32_t));
+      EXPECT_DOUBLE_EQ(candidate.estimated_access_cost, 1'000.0);
+    } else {
+      EXPECT_LT(candidate.estimated_memory_usage, _chunk_size * sizeof(int32_t));
+      EXPECT_GT(candidate.estimated_access_cost, 1'000.0);
+    }
+  }
+
+  const auto smallest_candidate = std::min_element(candidates.cbegin(), candidates.cend(), [](const auto& lhs,
+                                                                                                const auto& rhs) {
+    return lhs.estimated_memory_usage < rhs.estimated_memory_usage;
+  });
+  EXPECT_EQ(smallest_candidate->encoding_spec, SegmentEncodingSpec{EncodingType::RunLength});
+}
+
+TEST_F(EncodingAdvisorTest, RecommendSmallestEncodingsForUnaccessedSegments) {
+  const auto recommendations = EncodingAdvisor{}.recommend({_table}, std::numeric_limits<size_t>::max());
+
+  // The last chunk is still mutable
+  ASSERT_EQ(recommendations.size(), 4u);
+  for (const auto& recommendation : recommendations) {
+    EXPECT_LT(recommendation.chunk_id, ChunkID{2});
+    if (recommendation.column_id == ColumnID{0}) {
+      EXPECT_EQ(recommendation.encoding_spec, SegmentEncodingSpec{EncodingType::RunLength});
+    } else {
+      EXPECT_EQ(recommendation.encoding_spec,
+                (SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128}));
+    }
+  }
+}
+
+TEST_F(EncodingAdvisorTest, RecommendWithinMemoryBudget) {
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+  segment->access_counter[SegmentAccessCounter::AccessType::Random] += 1'000'000;
+
+  const auto advisor = EncodingAdvisor{};
+  const auto smallest_memory_usage = _estimated_memory_usage(advisor.recommend({_table}, 0));
+
+  // With enough memory, the frequently accessed segment is not compressed at all
+  const auto unlimited_recommendations = advisor.recommend({_table}, std::numeric_limits<size_t>::max());
+  EXPECT_EQ(unlimited_recommendations[2].chunk_id, ChunkID{0});
+  EXPECT_EQ(unlimited_recommendations[2].column_id, ColumnID{1});
+  EXPECT_EQ(unlimited_recommendations[2].encoding_spec, SegmentEncodingSpec{EncodingType::Unencoded});
+  EXPECT_EQ(unlimited_recommendations[3].encoding_spec,
+            (SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128}));
+
+  // With a small additional budget, the segment gets an encoding that is cheaper to access than SimdBp128 but still
+  // compresses the values
+  const auto memory_budget = smallest_memory_usage + 2 * _chunk_size;
+  const auto recommendations = advisor.recommend({_table}, memory_budget);
+  EXPECT_LE(_estimated_memory_usage(recommendations), memory_budget);
+  EXPECT_EQ(recommendations[2].encoding_spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+}
+
+TEST_F(EncodingAdvisorTest, SkipIndexedSegments) {
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), SegmentEncodingSpec{EncodingType::Dictionary});
+  chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+
+  const auto recommendations = EncodingAdvisor{}.recommend({_table}, std::numeric_limits<size_t>::max());
+  ASSERT_EQ(recommendations.size(), 3u);
+  EXPECT_EQ(recommendations[0].chunk_id, ChunkID{1});
+  EXPECT_EQ(recommendations[0].column_id, ColumnID{0});
+}
+
+TEST_F(EncodingAdvisorTest, Apply) {
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  segment->access_counter[SegmentAccessCounter::AccessType::Sequential] += 42;
+
+  const auto recommendations = EncodingAdvisor{}.recommend({_table}, std::numeric_limits<size_t>::max());
+  EXPECT_EQ(EncodingAdvisor::apply(recommendations), 4u);
+
+  for (const auto& recommendation : recommendations) {
+    const auto encoded_segment = _table->get_chunk(recommendation.chunk_id)->get_segment(recommendation.column_id);
+    EXPECT_EQ(get_segment_encoding_spec(encoded_segment), recommendation.encoding_spec);
+  }
+
+  const auto encoded_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ(encoded_segment->access_counter[SegmentAccessCounter::AccessType::Sequential].load(), 42u);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _chunk_size; chunk_offset += 99) {
+    EXPECT_EQ((*encoded_segment)[chunk_offset], AllTypeVariant{static_cast<int32_t>(chunk_offset / 100)});
+  }
+
+  // Segments that already have the recommended encoding are not encoded again
+  EXPECT_EQ(EncodingAdvisor::apply(recommendations), 0u);
+}
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 
 #include "storage/vector_compression/simd_bp128/simd_bp128_compressor.hpp"
 #include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "storage/vector_compression/scan_compressed_vector_range.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "types.hpp"
 
@@ -56,7 +57,7 @@ class SimdBp128Test : public BaseTest, public ::testing::WithParamInterface<uint
     return compressed_vector;
   }
 
- private:
+ protected:
   uint8_t _bit_size;
   uint32_t _min;
   uint32_t _max;
@@ -150,4 +151,28 @@ TEST_P(SimdBp128Test, CompressEmptySequence) {
   ASSERT_EQ(decompressor->size(), 0u);
 }
 
+// Evaluates ranges on the packed blocks of all bit sizes. The sequence covers a full meta block and a partial one.
+TEST_P(SimdBp128Test, ScanRange) {
+  const auto sequence = generate_sequence(SimdBp128Packing::meta_block_size + 300);
+  const auto compressed_sequence = compress(sequence);
+
+  const auto middle = static_cast<uint32_t>(_min + (_max - _min) / 2u);
+  const auto ranges = std::vector<std::pair<uint32_t, uint32_t>>{
+      {0u, _min}, {_min, _min + 1u}, {middle, middle + 1u}, {_min, middle}, {middle, _max}, {0u, _max}, {_max, _max}};
+
+  for (const auto& [lower, upper] : ranges) {
+    auto expected_positions = std::vector<size_t>{};
+    for (auto index = size_t{0u}; index < sequence.size(); ++index) {
+      if (sequence[index] >= lower && sequence[index] < upper) expected_positions.emplace_back(index);
+    }
+
+    auto positions = std::vector<size_t>{};
+    scan_compressed_vector_range(*compressed_sequence, lower, upper, [&](const size_t first_index, uint64_t mask) {
+      for (; mask; mask &= mask - 1u) positions.emplace_back(first_index + __builtin_ctzll(mask));
+    });
+
+    EXPECT_EQ(positions, expected_positions) << "Range [" << lower << ", " << upper << ")";
+  }
+}
+
 }  // namespace opossum
@@ -7,6 +7,7 @@
 
 #include "hyrise.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/table.hpp"
 #include "utils/meta_table_manager.hpp"
 
@@ -53,6 +54,18 @@ TEST_F(StorageManagerTest, StatisticCreationOnAddTable) {
   EXPECT_EQ(chunk->pruning_statistics()->at(1)->data_type, DataType::Float);
 }
 
+TEST_F(StorageManagerTest, AddTableWithStatistics) {
+  auto& sm = Hyrise::get().storage_manager;
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl");
+  const auto table_statistics = TableStatistics::from_table(*table);
+  table_statistics->row_count = 42.0f;
+
+  // The given statistics are used instead of being built from the table
+  sm.add_table("int_float", table, table_statistics);
+  EXPECT_EQ(sm.get_table("int_float")->table_statistics(), table_statistics);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->pruning_statistics().has_value());
+}
+
 TEST_F(StorageManagerTest, GetTable) {
   auto& sm = Hyrise::get().storage_manager;
   auto t3 = sm.get_table("first_table");